@@ -0,0 +1,121 @@
+# scripts/embed_web_assets.py
+# Pré-build PlatformIO : web/* → src/Web/Assets/WebAssets.h (gzip, PROGMEM)
+#
+# - index.html servi sur "/", les autres fichiers sur "/assets/<nom>"
+# - {{nom}} dans index.html remplacé par le hash court de l'asset
+#   (URL versionnée → cache navigateur "immutable" pour les assets)
+# - gzip déterministe (mtime = 0) : en-tête régénéré seulement si le contenu change
+#
+# Utilisable seul : python3 scripts/embed_web_assets.py
+
+import gzip
+import hashlib
+import os
+import re
+
+try:
+    Import("env")  # noqa: F821 (fourni par PlatformIO)
+    PROJECT_DIR = env["PROJECT_DIR"]  # noqa: F821
+except NameError:
+    PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+WEB_DIR = os.path.join(PROJECT_DIR, "web")
+OUT_FILE = os.path.join(PROJECT_DIR, "src", "Web", "Assets", "WebAssets.h")
+
+MIME_TYPES = {
+    ".html": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".svg": "image/svg+xml",
+    ".ico": "image/x-icon",
+}
+
+
+def short_hash(data):
+    return hashlib.sha1(data).hexdigest()[:8]
+
+
+def symbol(name):
+    return "ASSET_" + re.sub(r"[^A-Za-z0-9]", "_", name).upper()
+
+
+def c_array(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    names = sorted(n for n in os.listdir(WEB_DIR)
+                   if os.path.isfile(os.path.join(WEB_DIR, n)) and not n.startswith("."))
+
+    raw = {}
+    for name in names:
+        with open(os.path.join(WEB_DIR, name), "rb") as f:
+            raw[name] = f.read()
+
+    hashes = {name: short_hash(data) for name, data in raw.items() if name != "index.html"}
+
+    # Versionnage des URLs dans la page
+    if "index.html" in raw:
+        html = raw["index.html"].decode("utf-8")
+        html = re.sub(r"\{\{([^}]+)\}\}", lambda m: hashes[m.group(1)], html)
+        raw["index.html"] = html.encode("utf-8")
+
+    out = [
+        "// Web/Assets/WebAssets.h",
+        "// GÉNÉRÉ par scripts/embed_web_assets.py depuis web/ — ne pas modifier",
+        "",
+        "#pragma once",
+        "#include <Arduino.h>",
+        "",
+        "struct WebAsset {",
+        "    const char*    path;       // URL servie",
+        "    const char*    mime;",
+        "    const uint8_t* data;       // Contenu gzip (PROGMEM)",
+        "    size_t         length;",
+        "    const char*    etag;       // Hash du contenu (guillemets inclus)",
+        "    bool           immutable;  // URL versionnée (?v=hash) → cache long",
+        "};",
+        "",
+    ]
+
+    entries = []
+    for name in names:
+        data = raw[name]
+        gz = gzip.compress(data, compresslevel=9, mtime=0)
+        sym = symbol(name)
+        ext = os.path.splitext(name)[1]
+        is_index = name == "index.html"
+        path = "/" if is_index else "/assets/" + name
+
+        out.append("// %s : %d octets → %d octets gzip" % (name, len(data), len(gz)))
+        out.append("static const uint8_t %s[] PROGMEM = {" % sym)
+        out.append(c_array(gz))
+        out.append("};")
+        out.append("")
+        entries.append('    { "%s", "%s", %s, sizeof(%s), "\\"%s\\"", %s },'
+                       % (path, MIME_TYPES.get(ext, "application/octet-stream"), sym, sym,
+                          short_hash(data), "false" if is_index else "true"))
+
+    out.append("static const WebAsset WEB_ASSETS[] = {")
+    out.extend(entries)
+    out.append("};")
+    out.append("")
+    out.append("static constexpr size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);")
+    out.append("")
+
+    text = "\n".join(out)
+    if os.path.exists(OUT_FILE):
+        with open(OUT_FILE, "r", encoding="utf-8") as f:
+            if f.read() == text:
+                return
+
+    os.makedirs(os.path.dirname(OUT_FILE), exist_ok=True)
+    with open(OUT_FILE, "w", encoding="utf-8") as f:
+        f.write(text)
+    print("WebAssets.h régénéré (%d fichiers)" % len(names))
+
+
+main()
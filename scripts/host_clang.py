@@ -0,0 +1,18 @@
+# scripts/host_clang.py
+# Pré-build PlatformIO (env:fuzz) : compilation hôte par clang avec libFuzzer
+#
+# - CC / CXX / édition de liens remplacés par clang / clang++ (gcc n'a pas libFuzzer)
+# - -fsanitize=fuzzer,address,undefined à la compilation et à l'édition de liens :
+#   libFuzzer fournit main(), le test définit LLVMFuzzerTestOneInput (HOST_LIBFUZZER)
+# - Surcharge possible : HOST_CLANG=clang-17 pio test -e fuzz ...
+
+import os
+
+Import("env")  # noqa: F821 (fourni par PlatformIO)
+
+CLANG = os.environ.get("HOST_CLANG", "clang")
+CLANGXX = CLANG.replace("clang", "clang++", 1)
+SANITIZERS = ["-fsanitize=fuzzer,address,undefined", "-fno-omit-frame-pointer", "-g", "-O1"]
+
+env.Replace(CC=CLANG, CXX=CLANGXX, LINK=CLANGXX)  # noqa: F821
+env.Append(CCFLAGS=SANITIZERS, LINKFLAGS=SANITIZERS)  # noqa: F821
@@ -38,9 +38,28 @@ static constexpr const char* CELLULAR_APN = "domotec82.fr";
 static constexpr const char* CELLULAR_USER = "";
 static constexpr const char* CELLULAR_PASS = "";
 
+// Mode radio (AT+CNMP) : 38 = LTE uniquement
+static constexpr int CELLULAR_NETWORK_MODE = 38;
+
+// Mode LTE préféré (AT+CMNB) : 1 = Cat-M, 2 = NB-IoT, 3 = les deux
+static constexpr int CELLULAR_PREFERRED_MODE = 1;
+
 // Centre serveur SMS (non utilisé actuellement, SMSC fourni par la SIM)
 static constexpr const char* CELLULAR_SMSC = "+32495005580";
 
+// =============================================================================
+// Cellular - MQTT (pile MQTT native SIM7080G : AT+SMCONF / AT+SMPUB)
+// Broker vide = uplink désactivé
+// =============================================================================
+static constexpr const char* MQTT_BROKER_HOST     = "";
+static constexpr uint16_t    MQTT_BROKER_PORT     = 1883;
+static constexpr const char* MQTT_CLIENT_ID       = "serre-sim7080g";
+static constexpr const char* MQTT_USERNAME        = "";
+static constexpr const char* MQTT_PASSWORD        = "";
+static constexpr const char* MQTT_TOPIC_TELEMETRY = "serre/telemetry";
+static constexpr uint16_t    MQTT_KEEPALIVE_S     = 60;
+static constexpr uint8_t     MQTT_QOS             = 1;
+
 // =============================================================================
 // Cellular - SMS - Numéros de destination
 // Format international avec "+" (validé avec code fonctionnel)
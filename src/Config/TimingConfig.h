@@ -92,6 +92,83 @@
  */
 #define MODEM_STABILIZE_DELAY_MS   2500
 
+// =============================================================================
+// Modem SIM7080G — duty-cycle radio (veille DTR + eDRX / PSM)
+// =============================================================================
+/*
+ * Mise en veille du modem entre deux fenêtres d'activité.
+ *
+ * En veille : CSCLK=1 + DTR haut, le modem reste enregistré (eDRX/PSM
+ * négociés avec le réseau) mais l'UART est coupé. Les travaux sortants
+ * (SMS, uplink MQTT, heure) réveillent le modem via requestWake() ou
+ * attendent le réveil périodique.
+ *
+ * 0 = modem toujours éveillé (comportement historique)
+ */
+#define MODEM_DUTY_CYCLE_ENABLED        1
+
+/*
+ * Duty-cycle uniquement sur batterie : alimentation externe présente
+ * (PowerManager) = modem toujours éveillé, latence minimale.
+ */
+#define MODEM_DUTY_CYCLE_BATTERY_ONLY   1
+
+/*
+ * Compromis latence / énergie :
+ *  - WAKE_INTERVAL : réveil périodique (vérification réseau, travaux groupés)
+ *  - WAKE_WINDOW   : durée minimale d'éveil après un réveil (laisse les
+ *                    modules grouper leurs envois dans la même fenêtre)
+ *  - IDLE_BEFORE_SLEEP : inactivité requise (file AT, ticket) avant la veille
+ */
+#define MODEM_WAKE_INTERVAL_MS          900000UL   // 15 minutes
+#define MODEM_WAKE_WINDOW_MS            30000UL
+#define MODEM_IDLE_BEFORE_SLEEP_MS      10000UL
+
+/*
+ * Délai entre DTR bas et le premier AT (sortie de veille UART).
+ */
+#define MODEM_DTR_WAKE_DELAY_MS         100
+
+/*
+ * Timers réseau (codage 3GPP TS 24.008, chaînes de bits AT+CEDRXS / AT+CPSMS).
+ *
+ * eDRX "0101" = 81.92 s (Cat-M) : le modem n'écoute le paging qu'une fois
+ * par cycle. PSM désactivé par défaut : en PSM le modem n'est plus
+ * joignable (ni SMS entrant, ni réponse UART) jusqu'au TAU suivant.
+ *  - TAU     "00100001" = 1 h  (T3412 étendu)
+ *  - Active  "00000010" = 4 s  (T3324)
+ */
+#define MODEM_EDRX_VALUE                "0101"
+#define MODEM_PSM_ENABLED               0
+#define MODEM_PSM_TAU                   "00100001"
+#define MODEM_PSM_ACTIVE_TIME           "00000010"
+
+// =============================================================================
+// Uplink MQTT (store-and-forward)
+// =============================================================================
+/*
+ * Intervalle entre deux fenêtres de connexion MQTT.
+ *
+ * Chaque fenêtre publie tout l'arriéré du journal depuis le dernier
+ * point de reprise : on amortit le coût radio Cat-M en envoyant
+ * rarement mais beaucoup.
+ */
+#define MQTT_UPLINK_INTERVAL_MS        900000UL   // 15 minutes
+
+/*
+ * Délai max d'attente d'une étape AT (SMCONF, SMCONN, SMPUB, SMDISC).
+ * Au-delà, la fenêtre est abandonnée (changement d'état modem, ticket
+ * SMS prolongé, etc.) et le point de reprise est conservé.
+ */
+#define MQTT_UPLINK_STEP_TIMEOUT_MS    45000UL
+
+/*
+ * Période de la tâche de publication (lecture journal + encodage).
+ * Hors de la tâche 20 ms (UART / file AT) : les callbacks AT ne font
+ * que signaler qu'un message est dû.
+ */
+#define MQTT_UPLINK_PUMP_PERIOD_MS     100UL
+
 // =============================================================================
 // Réservé – extensions futures
 // =============================================================================
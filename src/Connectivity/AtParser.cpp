@@ -0,0 +1,191 @@
+// src/Connectivity/AtParser.cpp
+
+#include "Connectivity/AtParser.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Années acceptées : bornes des horloges modem / NTP plausibles, et garde
+// contre les débordements de daysFromCivil sur une ligne corrompue
+static constexpr int CIVIL_MIN_YEAR = 1970;
+static constexpr int CIVIL_MAX_YEAR = 2199;
+
+// Fuseau horaire en quarts d'heure (UTC−12 … UTC+14)
+static constexpr int TZ_MAX_QUARTERS = 56;
+
+// =============================================================================
+// CHAMPS NUMÉRIQUES
+// =============================================================================
+
+// (atoi transformait "+CSQ: ,x" ou du bruit UART en 0, valeur valide)
+bool AtParser::parseIntField(const char* s, long& out)
+{
+    while (*s == ' ') s++;
+    char* end;
+    out = strtol(s, &end, 10);
+    if (end == s) return false;
+    return *end == '\0' || *end == ',' || *end == ' ';
+}
+
+int AtParser::parseCeregStat(const char* line)
+{
+    const char* comma = strchr(line, ',');
+    long v;
+    if (comma && parseIntField(comma + 1, v) && v >= 0 && v <= 5) return (int)v;
+    return -1;
+}
+
+int AtParser::parseCgatt(const char* line)
+{
+    const char* colon = strchr(line, ':');
+    long v;
+    if (colon && parseIntField(colon + 1, v) && (v == 0 || v == 1)) return (int)v;
+    return -1;
+}
+
+int AtParser::parseCsq(const char* line)
+{
+    const char* colon = strchr(line, ':');
+    long v;
+    if (colon && parseIntField(colon + 1, v) && v >= 0 && v <= 31) return (int)v;
+    return 99;
+}
+
+// =============================================================================
+// CHAMPS ENTRE GUILLEMETS
+// =============================================================================
+
+String AtParser::parseCopsOperator(const char* line)
+{
+    const char* q1 = strchr(line, '"');
+    if (!q1) return "";
+    q1++;  // Après le premier guillemet
+    const char* q2 = strchr(q1, '"');
+    if (!q2) return "";
+
+    char buf[32];
+    size_t len = q2 - q1;
+    if (len >= sizeof(buf)) len = sizeof(buf) - 1;
+    memcpy(buf, q1, len);
+    buf[len] = '\0';
+    return String(buf);
+}
+
+IPAddress AtParser::parseCnactIP(const char* line)
+{
+    const char* q1 = strchr(line, '"');
+    if (!q1) return IPAddress(0, 0, 0, 0);
+    q1++;
+    const char* q2 = strchr(q1, '"');
+    if (!q2) return IPAddress(0, 0, 0, 0);
+
+    // Plus long que "255.255.255.255" : invalide (pas de troncature)
+    char buf[16];
+    size_t len = q2 - q1;
+    if (len >= sizeof(buf)) return IPAddress(0, 0, 0, 0);
+    memcpy(buf, q1, len);
+    buf[len] = '\0';
+
+    // fromString remplit les octets au fil de l'eau : résultat partiel si échec
+    IPAddress ip;
+    if (!ip.fromString(buf)) return IPAddress(0, 0, 0, 0);
+    return ip;
+}
+
+bool AtParser::isPdpDeactivated(const char* args)
+{
+    const char* comma = strchr(args, ',');
+    long cid;
+    if (!comma || !parseIntField(args, cid) || cid != 0) {
+        return false;  // Seul le contexte 0 est utilisé
+    }
+    return strncmp(comma + 1, "DEACTIVE", 8) == 0;
+}
+
+// =============================================================================
+// HEURE RÉSEAU
+// (algorithme days_from_civil : indépendant de TZ et de mktime)
+// =============================================================================
+
+static int32_t daysFromCivil(int y, int m, int d)
+{
+    y -= (m <= 2) ? 1 : 0;
+    const int era = (y >= 0 ? y : y - 399) / 400;
+    const int yoe = y - era * 400;                                  // [0, 399]
+    const int doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1; // [0, 365]
+    const int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;          // [0, 146096]
+    return era * 146097 + doe - 719468;
+}
+
+time_t AtParser::civilToUtc(int year, int month, int day, int hour, int minute, int second)
+{
+    if (year >= 0 && year < 100) year += 2000;  // Année sur 2 chiffres (AT+CCLK)
+    if (year < CIVIL_MIN_YEAR || year > CIVIL_MAX_YEAR ||
+        month < 1 || month > 12 || day < 1 || day > 31 ||
+        hour < 0 || hour > 23 || minute < 0 || minute > 59 ||
+        second < 0 || second > 60) {
+        return 0;
+    }
+    return static_cast<time_t>(daysFromCivil(year, month, day)) * 86400 +
+           hour * 3600 + minute * 60 + second;
+}
+
+time_t AtParser::parseCclk(const char* line)
+{
+    const char* q = strchr(line, '"');
+    if (!q) return 0;
+
+    int yy, mo, dd, hh, mi, ss, tz = 0;
+    char sign = '+';
+    int n = sscanf(q + 1, "%d/%d/%d,%d:%d:%d%c%d", &yy, &mo, &dd, &hh, &mi, &ss, &sign, &tz);
+    if (n < 6) return 0;
+
+    time_t local = civilToUtc(yy, mo, dd, hh, mi, ss);
+    if (local == 0) return 0;
+
+    if (n == 8 && (tz < 0 || tz > TZ_MAX_QUARTERS)) return 0;
+    int32_t offsetS = (n == 8) ? tz * 15 * 60 : 0;
+    return (sign == '-') ? local + offsetS : local - offsetS;
+}
+
+time_t AtParser::parsePsuttz(const char* args)
+{
+    int yy, mo, dd, hh, mi, ss;
+    if (sscanf(args, "%d,%d,%d,%d,%d,%d", &yy, &mo, &dd, &hh, &mi, &ss) != 6) return 0;
+    return civilToUtc(yy, mo, dd, hh, mi, ss);
+}
+
+// =============================================================================
+// FILTRAGE DES LIGNES MODEM
+// =============================================================================
+
+bool AtParser::isNumericLine(const char* line)
+{
+    if (!line || *line == '\0') return false;
+
+    size_t len = 0;
+    for (const char* p = line; *p; p++) {
+        if (*p < '0' || *p > '9') return false;
+        len++;
+    }
+
+    // CCID: ~20 digits, IMEI: 15 digits, IMSI: 15 digits
+    return (len >= 10 && len <= 25);
+}
+
+bool AtParser::isEchoOrUrc(const char* line)
+{
+    if (!line || *line == '\0') return false;
+
+    // Échos AT
+    if (strncmp(line, "AT", 2) == 0) return true;
+
+    // URC commençant par +, *, ou mots-clés
+    if (line[0] == '+' || line[0] == '*') return true;
+    if (strncmp(line, "SMS", 3) == 0) return true;
+    if (strncmp(line, "Call", 4) == 0) return true;
+    if (strncmp(line, "RING", 4) == 0) return true;
+
+    return false;
+}
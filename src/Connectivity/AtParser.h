@@ -0,0 +1,54 @@
+// src/Connectivity/AtParser.h
+// Parseurs des réponses et URC AT du SIM7080G (sans état, sans allocation
+// hors valeurs de retour String)
+//
+// Partagés par CellularManager (CEREG, CGATT, CSQ, COPS, CNACT, APP PDP,
+// filtrage des lignes CCID/IMEI) et ManagerUTC (CCLK, PSUTTZ). Regroupés ici
+// pour être testés et fuzzés sur l'hôte (test/test_fuzz) : chaque fonction
+// accepte n'importe quelle ligne terminée par '\0' (bruit UART compris) et
+// renvoie la valeur « invalide » documentée plutôt qu'un résultat partiel.
+
+#pragma once
+
+#include <Arduino.h>
+#include <IPAddress.h>
+#include <time.h>
+
+class AtParser {
+public:
+    // Entier décimal strict : chiffres obligatoires, suivis de fin / ',' / espace
+    static bool parseIntField(const char* s, long& out);
+
+    // +CEREG: <n>,<stat> → stat (0-5), -1 si invalide
+    static int parseCeregStat(const char* line);
+
+    // +CGATT: <state> → 0 ou 1, -1 si invalide
+    static int parseCgatt(const char* line);
+
+    // +CSQ: <rssi>,<ber> → rssi (0-31), 99 si inconnu ou invalide
+    static int parseCsq(const char* line);
+
+    // +COPS: <mode>,<format>,"<oper>",<act> → opérateur (31 car. max), "" si absent
+    static String parseCopsOperator(const char* line);
+
+    // +CNACT: 0,<status>,"<ip>" → adresse, 0.0.0.0 si invalide
+    static IPAddress parseCnactIP(const char* line);
+
+    // +APP PDP: <cid>,<status> (args après le préfixe) → contexte 0 désactivé ?
+    static bool isPdpDeactivated(const char* args);
+
+    // +CCLK: "yy/MM/dd,hh:mm:ss±zz" (heure locale, zz en quarts d'heure) → UTC, 0 si invalide
+    static time_t parseCclk(const char* line);
+
+    // *PSUTTZ: yyyy,MM,dd,hh,mm,ss,"±zz",dst (args, heure universelle) → UTC, 0 si invalide
+    static time_t parsePsuttz(const char* args);
+
+    // Date civile → UTC (indépendant de TZ et de mktime), 0 si hors plage
+    static time_t civilToUtc(int year, int month, int day, int hour, int minute, int second);
+
+    // Ligne entièrement numérique de 10 à 25 chiffres (CCID / IMEI / IMSI)
+    static bool isNumericLine(const char* line);
+
+    // Écho AT ou URC (+…, *…, SMS, Call, RING) : à ignorer comme réponse
+    static bool isEchoOrUrc(const char* line);
+};
@@ -1,6 +1,7 @@
 // src/Connectivity/CellularEvent.cpp
 // Phase 2 : Parsing lignes via callback octet
 // Reçoit octets de CellularStream, reconstruit lignes, classifie, dispatch
+// URC : trie de préfixes compilé à l'enregistrement, une seule passe par ligne
 
 #include "Connectivity/CellularEvent.h"
 #include "Connectivity/CellularStream.h"
@@ -13,13 +14,21 @@ static const char* TAG = "CellEvent";
 // -----------------------------------------------------------------------------
 char CellularEvent::lineBuffer[LINE_BUFFER_SIZE];
 uint16_t CellularEvent::lineLen = 0;
+bool CellularEvent::lineOverflow = false;
 
 CellularLineCallback CellularEvent::lineCallback = nullptr;
+
+CellularEvent::UrcNode CellularEvent::urcNodes[MAX_URC_NODES];
+uint16_t CellularEvent::urcNodeCount = 0;
+CellularEvent::UrcHandler CellularEvent::urcHandlers[MAX_URC_HANDLERS];
+uint8_t CellularEvent::urcHandlerCount = 0;
 bool CellularEvent::lineParsingEnabled = false;
 
 uint32_t CellularEvent::statsPollCount = 0;
 uint32_t CellularEvent::statsLinesReceived = 0;
 uint32_t CellularEvent::statsBufferOverflows = 0;
+uint32_t CellularEvent::statsUrcDispatched = 0;
+PerfCounter CellularEvent::statsDispatch;
 
 // -----------------------------------------------------------------------------
 // Initialisation
@@ -28,6 +37,7 @@ void CellularEvent::init()
 {
     lineLen = 0;
     lineBuffer[0] = '\0';
+    lineOverflow = false;
     
     lineParsingEnabled = false;
     lineCallback = nullptr;
@@ -35,6 +45,13 @@ void CellularEvent::init()
     statsPollCount = 0;
     statsLinesReceived = 0;
     statsBufferOverflows = 0;
+    statsUrcDispatched = 0;
+    statsDispatch = PerfCounter();
+    
+    // Trie URC : racine seule
+    urcNodes[0] = { '\0', URC_NONE, URC_NONE, URC_NONE };
+    urcNodeCount = 1;
+    urcHandlerCount = 0;
     
     Logger::info(TAG, "CellularEvent initialisé (Phase 2 - parsing lignes)");
 }
@@ -47,6 +64,73 @@ void CellularEvent::setLineCallback(CellularLineCallback cb)
     lineCallback = cb;
 }
 
+// -----------------------------------------------------------------------------
+// Recherche d'un enfant portant le caractère c (URC_NONE si absent)
+// -----------------------------------------------------------------------------
+uint8_t CellularEvent::findChild(uint8_t node, char c)
+{
+    uint8_t child = urcNodes[node].firstChild;
+    while (child != URC_NONE && urcNodes[child].c != c) {
+        child = urcNodes[child].nextSibling;
+    }
+    return child;
+}
+
+// -----------------------------------------------------------------------------
+// Abonnement URC : insertion du préfixe dans le trie
+// -----------------------------------------------------------------------------
+bool CellularEvent::registerUrcHandler(const char* prefix, CellularUrcCallback cb)
+{
+    if (!prefix || *prefix == '\0' || !cb) {
+        return false;
+    }
+    
+    if (urcHandlerCount >= MAX_URC_HANDLERS) {
+        LOG_WARN(TAG, "Table URC pleine, abonnement refusé: %s", prefix);
+        return false;
+    }
+    
+    // Vérifier la place disponible avant toute modification du trie
+    uint8_t node = 0;
+    const char* p = prefix;
+    while (*p) {
+        uint8_t child = findChild(node, *p);
+        if (child == URC_NONE) break;
+        node = child;
+        p++;
+    }
+    if (urcNodeCount + strlen(p) > MAX_URC_NODES) {
+        LOG_WARN(TAG, "Trie URC plein, abonnement refusé: %s", prefix);
+        return false;
+    }
+    
+    // Créer les nœuds manquants
+    while (*p) {
+        uint8_t child = (uint8_t)urcNodeCount++;
+        urcNodes[child] = { *p, URC_NONE, urcNodes[node].firstChild, URC_NONE };
+        urcNodes[node].firstChild = child;
+        node = child;
+        p++;
+    }
+    
+    // Ajouter l'abonné en fin de chaîne (ordre d'enregistrement conservé)
+    uint8_t h = urcHandlerCount++;
+    urcHandlers[h] = { cb, URC_NONE };
+    
+    if (urcNodes[node].handler == URC_NONE) {
+        urcNodes[node].handler = h;
+    } else {
+        uint8_t last = urcNodes[node].handler;
+        while (urcHandlers[last].next != URC_NONE) {
+            last = urcHandlers[last].next;
+        }
+        urcHandlers[last].next = h;
+    }
+    
+    Logger::debug(TAG, String("Abonnement URC: ") + prefix);
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 // Contrôle du parsing
 // -----------------------------------------------------------------------------
@@ -56,6 +140,7 @@ void CellularEvent::enableLineParsing(bool enable)
         // Reset buffer au démarrage du parsing
         lineLen = 0;
         lineBuffer[0] = '\0';
+        lineOverflow = false;
     }
     
     lineParsingEnabled = enable;
@@ -85,6 +170,16 @@ uint32_t CellularEvent::getBufferOverflows()
     return statsBufferOverflows;
 }
 
+uint32_t CellularEvent::getUrcDispatched()
+{
+    return statsUrcDispatched;
+}
+
+const PerfCounter& CellularEvent::getDispatchPerf()
+{
+    return statsDispatch;
+}
+
 // -----------------------------------------------------------------------------
 // Poll - Appelé toutes les 20ms par TaskManager
 // -----------------------------------------------------------------------------
@@ -92,13 +187,13 @@ void CellularEvent::poll()
 {
     statsPollCount++;
     
-    // Forcer le pompage de Serial1 vers le ring buffer
+    // Forcer le pompage de l'UART vers le ring buffer
     // Les octets arrivent via onByte() appelé par CellularStream
     CellularStream::instance().pump();
 }
 
 // -----------------------------------------------------------------------------
-// Réception octet (appelé par CellularStream::pumpSerial1)
+// Réception octet (appelé par CellularStream::pumpUart)
 // -----------------------------------------------------------------------------
 void CellularEvent::onByte(uint8_t c)
 {
@@ -116,13 +211,17 @@ void CellularEvent::onByte(uint8_t c)
 void CellularEvent::processChar(uint8_t c)
 {
     // Ignorer \r (on gère uniquement \n comme fin de ligne)
-    if (c == '\r') {
+    // et NUL (tronquerait silencieusement la ligne côté parseurs)
+    if (c == '\r' || c == '\0') {
         return;
     }
     
     // Fin de ligne : \n
     if (c == '\n') {
-        if (lineLen > 0) {
+        if (lineOverflow) {
+            // Fin de la ligne trop longue : rien à dispatcher
+            lineOverflow = false;
+        } else if (lineLen > 0) {
             dispatchLine();
         }
         // Reset buffer
@@ -131,6 +230,12 @@ void CellularEvent::processChar(uint8_t c)
         return;
     }
     
+    // Reste d'une ligne trop longue : sans ce filtre, sa fin serait
+    // dispatchée comme une ligne à part entière (faux "OK", faux URC…)
+    if (lineOverflow) {
+        return;
+    }
+    
     // Détection prompt SMS : '>' arrive souvent SANS \n
     if (c == '>') {
         // Vérifier si buffer vide ou juste espaces
@@ -161,8 +266,9 @@ void CellularEvent::processChar(uint8_t c)
         lineBuffer[lineLen++] = (char)c;
         lineBuffer[lineLen] = '\0';
     } else {
-        // Overflow - ligne trop longue, drop et reset
+        // Overflow - ligne trop longue, drop jusqu'au prochain \n
         statsBufferOverflows++;
+        lineOverflow = true;
         lineLen = 0;
         lineBuffer[0] = '\0';
     }
@@ -192,6 +298,8 @@ void CellularEvent::dispatchLine()
         return;
     }
     
+    uint32_t t0 = micros();
+    
     // Construire ligne trimée (in-place si nécessaire)
     if (start > 0) {
         memmove(lineBuffer, lineBuffer + start, end - start);
@@ -208,6 +316,45 @@ void CellularEvent::dispatchLine()
     if (lineCallback) {
         lineCallback(type, lineBuffer);
     }
+    
+    // Dispatch URC (lignes normales uniquement)
+    if (type == CellularLineType::LINE) {
+        dispatchUrc(lineBuffer);
+    }
+    
+    statsDispatch.record(micros() - t0);
+}
+
+// -----------------------------------------------------------------------------
+// Dispatch URC : parcours unique du trie, notification du préfixe le plus long
+// -----------------------------------------------------------------------------
+void CellularEvent::dispatchUrc(const char* line)
+{
+    uint8_t node = 0;
+    uint8_t matched = URC_NONE;
+    size_t matchedLen = 0;
+    
+    for (size_t i = 0; line[i] != '\0'; i++) {
+        node = findChild(node, line[i]);
+        if (node == URC_NONE) break;
+        if (urcNodes[node].handler != URC_NONE) {
+            matched = urcNodes[node].handler;
+            matchedLen = i + 1;
+        }
+    }
+    
+    if (matched == URC_NONE) {
+        return;
+    }
+    
+    const char* args = line + matchedLen;
+    while (*args == ' ') args++;
+    
+    statsUrcDispatched++;
+    
+    for (uint8_t h = matched; h != URC_NONE; h = urcHandlers[h].next) {
+        urcHandlers[h].cb(line, args);
+    }
 }
 
 // -----------------------------------------------------------------------------
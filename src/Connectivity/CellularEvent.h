@@ -1,11 +1,13 @@
 // src/Connectivity/CellularEvent.h
 // Gestionnaire d'événements modem - Phase 2 : parsing lignes
 // Rôle : Recevoir octets via callback, reconstruire lignes, classifier, dispatcher
+//        + dispatch des URC vers les modules abonnés (trie de préfixes)
 
 #ifndef CELLULAREVENT_H
 #define CELLULAREVENT_H
 
 #include <Arduino.h>
+#include "Utils/PerfCounter.h"
 
 // Forward declaration
 class CellularStream;
@@ -25,6 +27,13 @@ enum class CellularLineType {
 // -----------------------------------------------------------------------------
 typedef void (*CellularLineCallback)(CellularLineType type, const char* line);
 
+// -----------------------------------------------------------------------------
+// Callback URC (abonnement par préfixe : "+CEREG:", "+APP PDP:", etc.)
+// line : ligne complète trimée
+// args : pointeur dans line, juste après le préfixe (espaces de tête sautés)
+// -----------------------------------------------------------------------------
+typedef void (*CellularUrcCallback)(const char* line, const char* args);
+
 // -----------------------------------------------------------------------------
 // CellularEvent - Gestionnaire événements modem
 // -----------------------------------------------------------------------------
@@ -46,6 +55,15 @@ public:
     // -------------------------------------------------------------------------
     static void setLineCallback(CellularLineCallback cb);
     
+    // -------------------------------------------------------------------------
+    // Abonnement URC par préfixe (à appeler pendant setup/init uniquement)
+    // Dispatch en une seule passe via un trie : coût par ligne indépendant
+    // du nombre d'abonnés. Plusieurs abonnés possibles sur un même préfixe.
+    // Seul le préfixe le plus long qui matche est notifié.
+    // Retourne false si les tables sont pleines.
+    // -------------------------------------------------------------------------
+    static bool registerUrcHandler(const char* prefix, CellularUrcCallback cb);
+    
     // -------------------------------------------------------------------------
     // Contrôle du parsing
     // -------------------------------------------------------------------------
@@ -58,6 +76,11 @@ public:
     static uint32_t getPollCount();
     static uint32_t getLinesReceived();
     static uint32_t getBufferOverflows();
+    static uint32_t getUrcDispatched();
+    
+    // Durée de traitement d'une ligne complète (classification, callback
+    // ligne et URC inclus) : débit CPU = calls / totalUs
+    static const PerfCounter& getDispatchPerf();
     
 private:
     // -------------------------------------------------------------------------
@@ -66,12 +89,38 @@ private:
     static constexpr uint16_t LINE_BUFFER_SIZE = 256;
     static char lineBuffer[LINE_BUFFER_SIZE];
     static uint16_t lineLen;
+    static bool lineOverflow;   // Ligne trop longue : octets ignorés jusqu'au \n
     
     // -------------------------------------------------------------------------
     // Callback
     // -------------------------------------------------------------------------
     static CellularLineCallback lineCallback;
     
+    // -------------------------------------------------------------------------
+    // Trie URC (tables statiques, aucune allocation)
+    // Nœud 0 = racine. Enfants chaînés via firstChild / nextSibling.
+    // -------------------------------------------------------------------------
+    static constexpr uint8_t URC_NONE = 0xFF;
+    static constexpr uint16_t MAX_URC_NODES = 192;
+    static constexpr uint8_t MAX_URC_HANDLERS = 16;
+    
+    struct UrcNode {
+        char c;
+        uint8_t firstChild;
+        uint8_t nextSibling;
+        uint8_t handler;      // Premier abonné (URC_NONE si nœud non terminal)
+    };
+    
+    struct UrcHandler {
+        CellularUrcCallback cb;
+        uint8_t next;         // Abonné suivant sur le même préfixe
+    };
+    
+    static UrcNode urcNodes[MAX_URC_NODES];
+    static uint16_t urcNodeCount;
+    static UrcHandler urcHandlers[MAX_URC_HANDLERS];
+    static uint8_t urcHandlerCount;
+    
     // -------------------------------------------------------------------------
     // Contrôle parsing
     // -------------------------------------------------------------------------
@@ -83,6 +132,8 @@ private:
     static uint32_t statsPollCount;
     static uint32_t statsLinesReceived;
     static uint32_t statsBufferOverflows;
+    static uint32_t statsUrcDispatched;
+    static PerfCounter statsDispatch;
     
     // -------------------------------------------------------------------------
     // Méthodes internes
@@ -90,6 +141,8 @@ private:
     static void processChar(uint8_t c);
     static void dispatchLine();
     static CellularLineType classifyLine(const char* line);
+    static void dispatchUrc(const char* line);
+    static uint8_t findChild(uint8_t node, char c);
 };
 
 #endif // CELLULAREVENT_H
\ No newline at end of file
@@ -1,9 +1,12 @@
 // src/Connectivity/CellularManager.cpp
 // Version finale : 100% non-bloquant — aucun appel TinyGSM bloquant
-// Tous les échanges AT passent par le système pending (SEND/WAIT)
+// Tous les échanges AT passent par la file AT → système pending (SEND/WAIT)
 // Budget garanti : handle() < 100 ms à chaque cycle
+// Enchaînement : la file envoie la commande suivante dès la réponse (poll 20ms)
+// et la machine d'états avance sans attendre le cycle suivant de 2s
 
 #include "Connectivity/CellularManager.h"
+#include "Connectivity/AtParser.h"
 #include "Connectivity/CellularStream.h" 
 #include "Core/PowerManager.h"
 #include "Utils/Logger.h"
@@ -52,10 +55,15 @@ IPAddress CellularManager::localIP = IPAddress(0, 0, 0, 0);
 int CellularManager::subStep = 0;
 int CellularManager::bearerCycleCount = 0;
 unsigned long CellularManager::handleStartTime = 0;
+unsigned long CellularManager::handleMaxDurationMs = 0;
+uint32_t CellularManager::budgetOverruns = 0;
 
 // Timestamp pour séquences PWRKEY non-bloquantes
 unsigned long CellularManager::powerStepStartMs = 0;
 
+// Perte bearer signalée par URC (traitée dans handleConnected)
+bool CellularManager::bearerLost = false;
+
 // Système pending
 bool CellularManager::pendingActive = false;
 CellularManager::PendingKind CellularManager::pendingKind = PendingKind::NONE;
@@ -65,6 +73,19 @@ bool CellularManager::pendingDone = false;
 bool CellularManager::pendingSuccess = false;
 char CellularManager::pendingData[64] = {0};
 char CellularManager::pendingPrefix[16] = {0};
+const uint8_t* CellularManager::pendingPayload = nullptr;
+size_t CellularManager::pendingPayloadLen = 0;
+bool CellularManager::pendingPayloadSent = false;
+
+// File AT
+CellularManager::AtRequest CellularManager::atQueue[AT_QUEUE_SIZE];
+uint8_t CellularManager::atQueueHead = 0;
+uint8_t CellularManager::atQueueCount = 0;
+bool CellularManager::atInFlight = false;
+bool CellularManager::atQueueFailed = false;
+bool CellularManager::atLastSuccess = false;
+char CellularManager::atLastData[64] = {0};
+char CellularManager::atFailedCommand[64] = {0};
 
 // Gestion ticket modem
 bool CellularManager::modemLocked = false;
@@ -82,9 +103,16 @@ static constexpr int ERROR_WAIT_CYCLES = 150;  // 5 minutes (150 * 2s)
 
 // Timeouts en nombre de cycles (2s par cycle)
 static constexpr int TIMEOUT_NETWORK_WAIT = 60;     // 120s pour enregistrement réseau
+static constexpr int TIMEOUT_NETWORK_WAIT_FAST = 15; // 30s en fast path avant repli config complète
+
+// Fast path re-attach : configuration inchangée depuis la dernière connexion
+static String simIccid;             // ICCID lu en SIM_CHECK
+static String storedFingerprint;    // Empreinte NVS (chargée au boot)
+static bool fastPathAttempt = false;
 
 // Retry limits
 static constexpr int MODEM_RETRY_MAX = 6;           // Nombre de retry AT avant power cycle
+static int cpinRetryCount = 0;                      // Remis à zéro à l'entrée en SIM_CHECK
 static constexpr int BEARER_RETRY_MAX = 5;          // Nombre de retry bearer avant erreur
 
 // Timeouts pending (en ms)
@@ -92,6 +120,32 @@ static constexpr unsigned long PENDING_TIMEOUT_MS     = 2000;  // 2s par défaut
 static constexpr unsigned long PENDING_TIMEOUT_BEARER_MS = 5000;  // 5s pour activation bearer
 static constexpr unsigned long PENDING_TIMEOUT_COPS_MS = 3000;  // 3s pour opérateur
 
+// Enchaînement d'étapes dans un même appel (SIM_CHECK → SLEEPING uniquement)
+static constexpr int MAX_CHAINED_STEPS = 8;
+static bool yieldToNextCycle = false;  // Retry volontairement espacé d'un cycle
+
+// Surveillance en CONNECTED (CSQ + CGATT)
+static constexpr unsigned long CONNECTED_POLL_INTERVAL_MS = 8000;
+static unsigned long lastConnectedPollMs = 0;
+
+// Résultat CGATT du dernier lot (-1 = pas de réponse)
+static int gprsAttached = -1;
+
+// Duty-cycle radio (veille DTR)
+static bool inStateMachine = false;      // Commandes internes : pas une "activité"
+static bool wakeRequested = false;
+static bool dtrSleep = false;            // DTR haut = UART modem en veille
+static bool sleepConfigured = false;     // CEDRXS/CPSMS/CSCLK envoyés depuis l'allumage
+static bool sleepSupported = true;       // CSCLK accepté par le modem
+static bool csclkAccepted = false;       // Résultat de AT+CSCLK=1 (callback dédié)
+static bool wakeCheckDone = false;       // CGATT vérifié depuis le réveil
+static int wakeProbeCount = 0;
+static unsigned long dtrWakeMs = 0;
+static unsigned long sleepStartMs = 0;
+static unsigned long wakeStartMs = 0;
+static unsigned long lastActivityMs = 0;
+static constexpr int WAKE_PROBE_MAX = 3;
+
 // Instance modem avec CellularStream (proxy ring buffer)
 #ifdef DUMP_AT_COMMANDS
 static StreamDebugger debugger(CellularStream::instance(), Serial);
@@ -108,78 +162,13 @@ TinyGsm& getModem()
     return modem;
 }
 
-// =============================================================================
-// HELPERS DE PARSING (réponses AT capturées par WAIT_PREFIX)
-// =============================================================================
-
-// Parse +CEREG: <n>,<stat> → retourne stat (0-5), ou -1 si invalide
-static int parseCeregStat(const char* line)
-{
-    const char* comma = strchr(line, ',');
-    if (comma) return atoi(comma + 1);
-    return -1;
-}
-
-// Parse +CGATT: <state> → retourne 0 ou 1, ou -1 si invalide
-static int parseCgatt(const char* line)
-{
-    const char* colon = strchr(line, ':');
-    if (colon) return atoi(colon + 1);
-    return -1;
-}
-
-// Parse +CSQ: <rssi>,<ber> → retourne rssi (0-31, 99=inconnu)
-static int parseCsq(const char* line)
-{
-    const char* colon = strchr(line, ':');
-    if (colon) return atoi(colon + 1);
-    return 99;
-}
-
-// Parse +COPS: <mode>,<format>,"<oper>",<act> → retourne nom opérateur
-static String parseCopsOperator(const char* line)
-{
-    const char* q1 = strchr(line, '"');
-    if (!q1) return "";
-    q1++;  // Après le premier guillemet
-    const char* q2 = strchr(q1, '"');
-    if (!q2) return "";
-    
-    char buf[32];
-    size_t len = q2 - q1;
-    if (len >= sizeof(buf)) len = sizeof(buf) - 1;
-    memcpy(buf, q1, len);
-    buf[len] = '\0';
-    return String(buf);
-}
-
-// Parse +CNACT: 0,<status>,"<ip>" → retourne IPAddress
-static IPAddress parseCnactIP(const char* line)
-{
-    const char* q1 = strchr(line, '"');
-    if (!q1) return IPAddress(0, 0, 0, 0);
-    q1++;
-    const char* q2 = strchr(q1, '"');
-    if (!q2) return IPAddress(0, 0, 0, 0);
-    
-    char buf[20];
-    size_t len = q2 - q1;
-    if (len >= sizeof(buf)) len = sizeof(buf) - 1;
-    memcpy(buf, q1, len);
-    buf[len] = '\0';
-    
-    IPAddress ip;
-    ip.fromString(buf);
-    return ip;
-}
-
 // -----------------------------------------------------------------------------
 // Helper : budget temps dépassé ?
 // -----------------------------------------------------------------------------
 bool CellularManager::budgetExceeded()
 {
     if ((millis() - handleStartTime) >= BUDGET_MS) {
-        Logger::debug(TAG, "Budget temps dépassé, report au cycle suivant");
+        LOG_DEBUG(TAG, "Budget temps dépassé, report au cycle suivant");
         return true;
     }
     return false;
@@ -239,6 +228,9 @@ void CellularManager::clearPending()
     pendingDone = false;
     pendingSuccess = false;
     pendingPrefix[0] = '\0';
+    pendingPayload = nullptr;
+    pendingPayloadLen = 0;
+    pendingPayloadSent = false;
     
     // Réactiver la bufferisation RX vers TinyGSM
     CellularStream::instance().setRxBufferingEnabled(true);
@@ -265,39 +257,198 @@ bool CellularManager::isPendingActive()
 }
 
 // =============================================================================
-// HELPERS DE FILTRAGE LIGNES MODEM
+// FILE AT (enchaînement des commandes sans attendre handle())
 // =============================================================================
 
-// Vérifie si une ligne est numérique (pour CCID/IMEI/IMSI)
-static bool isNumericLine(const char* line)
+// -----------------------------------------------------------------------------
+// Ajouter une commande à la file
+// Un nouveau lot commence quand la file est vide : l'indicateur d'échec est remis à zéro
+// -----------------------------------------------------------------------------
+bool CellularManager::enqueueAt(const char* command, PendingKind kind, unsigned long timeoutMs,
+                                AtCallback cb, const char* prefix, bool abortOnError)
 {
-    if (!line || *line == '\0') return false;
+    if (atQueueCount >= AT_QUEUE_SIZE) {
+        LOG_WARN(TAG, "File AT pleine, commande ignorée: AT%s", command);
+        return false;
+    }
     
-    size_t len = 0;
-    for (const char* p = line; *p; p++) {
-        if (*p < '0' || *p > '9') return false;
-        len++;
+    // Modules externes : une commande = activité (retarde la veille)
+    // Modem en veille : l'UART est coupé, réveil puis nouvelle tentative
+    if (!inStateMachine) {
+        if (currentState == State::SLEEPING) {
+            requestWake();
+            return false;
+        }
+        lastActivityMs = millis();
     }
     
-    // CCID: ~20 digits, IMEI: 15 digits, IMSI: 15 digits
-    return (len >= 10 && len <= 25);
+    if (isAtQueueIdle()) {
+        atQueueFailed = false;
+        atFailedCommand[0] = '\0';
+    }
+    
+    AtRequest& r = atQueue[(atQueueHead + atQueueCount) % AT_QUEUE_SIZE];
+    strncpy(r.command, command, sizeof(r.command) - 1);
+    r.command[sizeof(r.command) - 1] = '\0';
+    if (prefix) {
+        strncpy(r.prefix, prefix, sizeof(r.prefix) - 1);
+        r.prefix[sizeof(r.prefix) - 1] = '\0';
+    } else {
+        r.prefix[0] = '\0';
+    }
+    r.kind = kind;
+    r.timeoutMs = timeoutMs;
+    r.cb = cb;
+    r.abortOnError = abortOnError;
+    r.internal = inStateMachine;
+    r.payload = nullptr;
+    r.payloadLen = 0;
+    
+    atQueueCount++;
+    return true;
 }
 
-// Vérifie si une ligne est un écho AT ou une URC à ignorer
-static bool isEchoOrURC(const char* line)
+// -----------------------------------------------------------------------------
+// Ajouter une commande à prompt ">" + charge utile (ex: AT+SMPUB)
+// Jamais bloquante pour le lot : l'appelant décide de la suite dans le callback
+// -----------------------------------------------------------------------------
+bool CellularManager::enqueueAtWithPayload(const char* command, const uint8_t* payload, size_t payloadLen,
+                                           unsigned long timeoutMs, AtCallback cb)
 {
-    if (!line || *line == '\0') return false;
+    if (!enqueueAt(command, PendingKind::WAIT_PROMPT_PAYLOAD, timeoutMs, cb, nullptr, false)) {
+        return false;
+    }
     
-    // Échos AT
-    if (strncmp(line, "AT", 2) == 0) return true;
+    AtRequest& r = atQueue[(atQueueHead + atQueueCount - 1) % AT_QUEUE_SIZE];
+    r.payload = payload;
+    r.payloadLen = payloadLen;
+    return true;
+}
+
+bool CellularManager::isAtQueueIdle()
+{
+    return atQueueCount == 0 && !atInFlight;
+}
+
+bool CellularManager::hasAtQueueFailed()
+{
+    return atQueueFailed;
+}
+
+// -----------------------------------------------------------------------------
+// Purger la file (changement d'état : les commandes restantes sont obsolètes)
+// Les modules externes sont notifiés (échec) pour ne pas attendre leur timeout.
+// Callbacks appelés après la purge : ils peuvent ré-enfiler une commande
+// -----------------------------------------------------------------------------
+void CellularManager::flushAtQueue()
+{
+    AtCallback dropped[AT_QUEUE_SIZE];
+    uint8_t droppedCount = 0;
+    for (uint8_t i = 0; i < atQueueCount; i++) {
+        const AtRequest& r = atQueue[(atQueueHead + i) % AT_QUEUE_SIZE];
+        if (!r.internal && r.cb) {
+            dropped[droppedCount++] = r.cb;
+        }
+    }
     
-    // URC commençant par +, *, ou mots-clés
-    if (line[0] == '+' || line[0] == '*') return true;
-    if (strncmp(line, "SMS", 3) == 0) return true;
-    if (strncmp(line, "Call", 4) == 0) return true;
-    if (strncmp(line, "RING", 4) == 0) return true;
+    atQueueHead = 0;
+    atQueueCount = 0;
+    atInFlight = false;
     
-    return false;
+    // Commandes enfilées par ces callbacks : externes, pas internes
+    bool wasInStateMachine = inStateMachine;
+    inStateMachine = false;
+    for (uint8_t i = 0; i < droppedCount; i++) {
+        dropped[i](false, "");
+    }
+    inStateMachine = wasInStateMachine;
+}
+
+// -----------------------------------------------------------------------------
+// Échec bloquant : retire les commandes restantes de la machine d'états
+// (ordre conservé pour les commandes des modules externes)
+// -----------------------------------------------------------------------------
+void CellularManager::purgeInternalRequests()
+{
+    uint8_t kept = 0;
+    for (uint8_t i = 0; i < atQueueCount; i++) {
+        const AtRequest& r = atQueue[(atQueueHead + i) % AT_QUEUE_SIZE];
+        if (!r.internal) {
+            if (kept != i) {
+                atQueue[(atQueueHead + kept) % AT_QUEUE_SIZE] = r;
+            }
+            kept++;
+        }
+    }
+    atQueueCount = kept;
+}
+
+// -----------------------------------------------------------------------------
+// Terminer la commande en vol : résultat, callback, purge si échec bloquant
+// -----------------------------------------------------------------------------
+void CellularManager::completeAtRequest()
+{
+    AtRequest r = atQueue[atQueueHead];
+    atQueueHead = (atQueueHead + 1) % AT_QUEUE_SIZE;
+    atQueueCount--;
+    atInFlight = false;
+    
+    atLastSuccess = pendingSuccess;
+    strncpy(atLastData, pendingData, sizeof(atLastData) - 1);
+    atLastData[sizeof(atLastData) - 1] = '\0';
+    clearPending();
+    
+    if (!atLastSuccess && r.abortOnError && r.internal) {
+        atQueueFailed = true;
+        strncpy(atFailedCommand, r.command, sizeof(atFailedCommand) - 1);
+        atFailedCommand[sizeof(atFailedCommand) - 1] = '\0';
+        purgeInternalRequests();
+    }
+    
+    // Commande d'un module externe terminée : activité (retarde la veille,
+    // la fenêtre d'inactivité part de la fin de l'échange, pas de l'envoi)
+    if (!r.internal) {
+        lastActivityMs = millis();
+    }
+    
+    if (r.cb) {
+        r.cb(atLastSuccess, atLastData);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Poll — appelé toutes les 20ms après CellularEvent::poll()
+// 1. Termine la commande en vol (réponse reçue ou timeout)
+// 2. Si le lot est terminé : avance la machine d'états immédiatement
+// 3. Envoie la commande suivante
+// -----------------------------------------------------------------------------
+void CellularManager::poll()
+{
+    if (atInFlight) {
+        checkPendingTimeout();
+        if (!pendingDone) {
+            return;
+        }
+        
+        completeAtRequest();
+        
+        if (atQueueCount == 0 && enabled && !modemLocked) {
+            handleStartTime = millis();
+            advanceStateMachine();
+            recordHandleDuration(millis() - handleStartTime);
+        }
+    }
+    
+    if (atQueueCount == 0 || atInFlight || pendingActive || modemLocked || dtrSleep) {
+        return;
+    }
+    
+    const AtRequest& r = atQueue[atQueueHead];
+    modem.sendAT(r.command);
+    startPending(r.kind, r.timeoutMs, r.prefix[0] != '\0' ? r.prefix : nullptr);
+    pendingPayload = r.payload;
+    pendingPayloadLen = r.payloadLen;
+    atInFlight = true;
 }
 
 // =============================================================================
@@ -348,7 +499,7 @@ void CellularManager::onModemLine(CellularLineType type, const char* line)
             
         case PendingKind::WAIT_NUMERIC:
             if (type == CellularLineType::LINE) {
-                if (!isEchoOrURC(line) && isNumericLine(line)) {
+                if (!AtParser::isEchoOrUrc(line) && AtParser::isNumericLine(line)) {
                     strncpy(pendingData, line, sizeof(pendingData) - 1);
                     pendingData[sizeof(pendingData) - 1] = '\0';
                 }
@@ -393,38 +544,78 @@ void CellularManager::onModemLine(CellularLineType type, const char* line)
             }
             break;
             
+        // -----------------------------------------------------------------
+        // WAIT_PROMPT_PAYLOAD : ">" → écriture charge utile → OK
+        // L'écriture passe par CellularStream (même UART que TinyGSM)
+        // -----------------------------------------------------------------
+        case PendingKind::WAIT_PROMPT_PAYLOAD:
+            if (type == CellularLineType::PROMPT && !pendingPayloadSent) {
+                if (pendingPayload && pendingPayloadLen > 0) {
+                    CellularStream::instance().write(pendingPayload, pendingPayloadLen);
+                }
+                pendingPayloadSent = true;
+            }
+            if (type == CellularLineType::OK && pendingPayloadSent) {
+                pendingDone = true;
+                pendingSuccess = true;
+            }
+            if (type == CellularLineType::ERROR) {
+                pendingDone = true;
+                pendingSuccess = false;
+            }
+            break;
+            
         default:
             break;
     }
 }
 
+// =============================================================================
+// URC ABONNÉES (dispatch par CellularEvent, hors système pending)
+// =============================================================================
+
+// +APP PDP: <pdpidx>,<statusstr> — ACTIVE / DEACTIVE
+void CellularManager::onUrcAppPdp(const char* line, const char* args)
+{
+    // Seul le contexte 0 est utilisé
+    if (AtParser::isPdpDeactivated(args) && currentState == State::CONNECTED) {
+        bearerLost = true;
+    }
+}
+
 // =============================================================================
 // GESTION TICKET MODEM (pour SmsManager, etc.)
 // =============================================================================
 
 bool CellularManager::isModemAvailable()
 {
-    return connected && !modemLocked;
+    return connected && !modemLocked && isAtQueueIdle() && currentState != State::SLEEPING;
 }
 
 bool CellularManager::requestModem()
 {
     if (modemLocked) {
         if ((millis() - modemLockTime) >= MODEM_LOCK_TIMEOUT_MS) {
-            Logger::warn(TAG, "Timeout ticket modem - libération forcée");
+            LOG_WARN(TAG, "Timeout ticket modem - libération forcée");
             modemLocked = false;
         } else {
             return false;
         }
     }
 
-    if (!connected) {
+    if (currentState == State::SLEEPING) {
+        requestWake();
+        return false;
+    }
+
+    if (!connected || !isAtQueueIdle()) {
         return false;
     }
 
     modemLocked = true;
+    lastActivityMs = millis();
     modemLockTime = millis();
-    Logger::debug(TAG, "Ticket modem accordé");
+    LOG_DEBUG(TAG, "Ticket modem accordé");
     return true;
 }
 
@@ -432,7 +623,8 @@ void CellularManager::freeModem()
 {
     if (modemLocked) {
         modemLocked = false;
-        Logger::debug(TAG, "Ticket modem libéré");
+        lastActivityMs = millis();
+        LOG_DEBUG(TAG, "Ticket modem libéré");
     }
 }
 
@@ -443,7 +635,56 @@ void CellularManager::loadPreferences()
 {
     preferences.begin("cellular", false);
     enabled = preferences.getBool("enabled", true);
+    storedFingerprint = preferences.getString("fp", "");
+    preferences.end();
+}
+
+// =============================================================================
+// EMPREINTE DE CONFIGURATION (fast path re-attach)
+// =============================================================================
+// CNMP/CMNB/CGDCONT/CNCFG sont conservés par le modem entre deux allumages :
+// si la SIM et la configuration n'ont pas changé, NETWORK_CONFIG est inutile
+// -----------------------------------------------------------------------------
+String CellularManager::buildFingerprint()
+{
+    return simIccid + "|" + CELLULAR_APN + "|" + String(CELLULAR_NETWORK_MODE) + "|" + String(CELLULAR_PREFERRED_MODE);
+}
+
+void CellularManager::saveFingerprint()
+{
+    String fp = buildFingerprint();
+    if (simIccid.length() == 0 || fp == storedFingerprint) return;
+    
+    preferences.begin("cellular", false);
+    preferences.putString("fp", fp);
     preferences.end();
+    storedFingerprint = fp;
+    LOG_DEBUG(TAG, "Empreinte configuration sauvegardée");
+}
+
+void CellularManager::clearFingerprint()
+{
+    if (storedFingerprint.length() == 0) return;
+    
+    preferences.begin("cellular", false);
+    preferences.remove("fp");
+    preferences.end();
+    storedFingerprint = "";
+}
+
+// -----------------------------------------------------------------------------
+// Échec en fast path : invalider l'empreinte et refaire la configuration
+// complète plutôt que de passer en ERROR. Retourne true si le repli a eu lieu.
+// -----------------------------------------------------------------------------
+bool CellularManager::fallbackFromFastPath(const char* reason)
+{
+    if (!fastPathAttempt) return false;
+    
+    LOG_WARN(TAG, "Fast path échoué (%s) → configuration complète", reason);
+    fastPathAttempt = false;
+    clearFingerprint();
+    changeState(State::NETWORK_CONFIG, "NETWORK_CONFIG");
+    return true;
 }
 
 // =============================================================================
@@ -451,23 +692,31 @@ void CellularManager::loadPreferences()
 // =============================================================================
 void CellularManager::init()
 {
-    Logger::info(TAG, "Initialisation modem SIM7080G...");
+    LOG_INFO(TAG, "Initialisation modem SIM7080G...");
 
     loadPreferences();
-    Logger::info(TAG, String("GSM ") + (enabled ? "activé" : "désactivé") + " (préférence)");
+    LOG_INFO(TAG, "GSM %s (préférence)", enabled ? "activé" : "désactivé");
+
+    // DTR bas = modem éveillé (veille pilotée uniquement par le duty-cycle)
+    pinMode(MODEM_DTR_PIN, OUTPUT);
+    setModemSleepPin(false);
 
     Serial1.begin(MODEM_UART_BAUD, SERIAL_8N1, MODEM_RX_PIN, MODEM_TX_PIN);
+    CellularStream::instance().begin(Serial1);
 
     clearPending();
 
-    Logger::info(TAG, " Initialisation matérielle terminée");
+    // Abonnements URC (CellularEvent::init() déjà appelé par main.cpp)
+    CellularEvent::registerUrcHandler("+APP PDP:", onUrcAppPdp);
+
+    LOG_INFO(TAG, " Initialisation matérielle terminée");
 
     if (enabled) {
         currentState = State::MODEM_INIT;
-        Logger::info(TAG, "Démarrage GSM (modem allumé par PMU)...");
+        LOG_INFO(TAG, "Démarrage GSM (modem allumé par PMU)...");
     } else {
         currentState = State::IDLE;
-        Logger::info(TAG, "GSM désactivé");
+        LOG_INFO(TAG, "GSM désactivé");
     }
 
     lastStateChange = millis();
@@ -482,7 +731,7 @@ void CellularManager::setEnabled(bool newEnabled)
     preferences.putBool("enabled", newEnabled);
     preferences.end();
 
-    Logger::info(TAG, String("GSM ") + (newEnabled ? "activé" : "désactivé") + " - sauvegardé");
+    LOG_INFO(TAG, "GSM %s - sauvegardé", newEnabled ? "activé" : "désactivé");
 
     enabled = newEnabled;
 
@@ -496,6 +745,7 @@ void CellularManager::setEnabled(bool newEnabled)
     } else {
         if (currentState == State::IDLE || 
             currentState == State::CONNECTED || 
+            currentState == State::SLEEPING ||
             currentState == State::ERROR ||
             currentState == State::POWERING_ON ||
             currentState == State::POWERING_OFF) {
@@ -507,7 +757,7 @@ void CellularManager::setEnabled(bool newEnabled)
             pendingDisable = false;
             
         } else {
-            Logger::info(TAG, "Désactivation différée (attente état sûr)");
+            LOG_INFO(TAG, "Désactivation différée (attente état sûr)");
             pendingDisable = true;
             connected = false;
         }
@@ -532,7 +782,7 @@ void CellularManager::handle()
     // Si modem locké par un client, ne rien faire (sauf vérifier timeout)
     if (modemLocked) {
         if ((millis() - modemLockTime) >= MODEM_LOCK_TIMEOUT_MS) {
-            Logger::warn(TAG, "Timeout ticket modem - libération forcée");
+            LOG_WARN(TAG, "Timeout ticket modem - libération forcée");
             modemLocked = false;
         }
         return;
@@ -540,6 +790,74 @@ void CellularManager::handle()
 
     stateCycleCount++;
 
+    advanceStateMachine();
+    
+    // Surveillance budget temps
+    recordHandleDuration(millis() - handleStartTime);
+}
+
+// -----------------------------------------------------------------------------
+// Surveillance budget : durée max observée + nombre de dépassements
+// (handle() et avancement déclenché par poll())
+// -----------------------------------------------------------------------------
+void CellularManager::recordHandleDuration(unsigned long durationMs)
+{
+    if (durationMs > handleMaxDurationMs) {
+        handleMaxDurationMs = durationMs;
+    }
+    
+    if (durationMs > BUDGET_MS) {
+        budgetOverruns++;
+        LOG_INFO(TAG, "⏱️ handle() total: %lums (state=%d, budget=100ms)", durationMs, static_cast<int>(currentState));
+    }
+}
+
+unsigned long CellularManager::getHandleMaxDurationMs()
+{
+    return handleMaxDurationMs;
+}
+
+uint32_t CellularManager::getBudgetOverruns()
+{
+    return budgetOverruns;
+}
+
+// =============================================================================
+// AVANCEMENT MACHINE D'ÉTATS
+// Enchaîne les étapes tant qu'elles progressent sans attendre le modem
+// (SIM_CHECK → SLEEPING uniquement : les séquences PWRKEY et la
+// temporisation ERROR restent cadencées par le cycle de 2s)
+// =============================================================================
+static bool isChainableState(CellularManager::State s)
+{
+    return s == CellularManager::State::SIM_CHECK ||
+           s == CellularManager::State::NETWORK_CONFIG ||
+           s == CellularManager::State::NETWORK_WAIT ||
+           s == CellularManager::State::CONNECTED ||
+           s == CellularManager::State::SLEEPING;
+}
+
+void CellularManager::advanceStateMachine()
+{
+    yieldToNextCycle = false;
+    
+    for (int i = 0; i < MAX_CHAINED_STEPS; i++) {
+        State stateBefore = currentState;
+        int stepBefore = subStep;
+        
+        inStateMachine = true;
+        runStateMachine();
+        inStateMachine = false;
+        
+        if (yieldToNextCycle || modemLocked || !isAtQueueIdle()) break;
+        if (!isChainableState(stateBefore) || !isChainableState(currentState)) break;
+        if (currentState == stateBefore && subStep == stepBefore) break;
+        if ((millis() - handleStartTime) >= BUDGET_MS) break;
+    }
+}
+
+void CellularManager::runStateMachine()
+{
     switch (currentState) {
         case State::IDLE:           break;
         case State::POWERING_ON:    handlePoweringOn();     break;
@@ -549,14 +867,9 @@ void CellularManager::handle()
         case State::NETWORK_CONFIG: handleNetworkConfig();  break;
         case State::NETWORK_WAIT:   handleNetworkWait();    break;
         case State::CONNECTED:      handleConnected();      break;
+        case State::SLEEPING:       handleSleeping();       break;
         case State::ERROR:          handleError();          break;
     }
-    
-    // Surveillance budget temps
-    unsigned long handleDuration = millis() - handleStartTime;
-    if (handleDuration > 100) {
-        Logger::info(TAG, String("⏱️ handle() total: ") + handleDuration + "ms (state=" + static_cast<int>(currentState) + ", budget=100ms)");
-    }
 }
 
 // =============================================================================
@@ -564,14 +877,35 @@ void CellularManager::handle()
 // =============================================================================
 void CellularManager::changeState(State newState, const char* stateName)
 {
-    Logger::debug(TAG, String("État: ") + stateName);
+    LOG_DEBUG(TAG, "État: %s", stateName);
+    
+    // Toute sortie de veille (réveil, erreur, extinction) : DTR bas, demande
+    // de réveil satisfaite ou caduque (sinon requestWake() resterait bloqué)
+    if (currentState == State::SLEEPING && newState != State::SLEEPING) {
+        setModemSleepPin(false);
+        wakeRequested = false;
+    }
+    
+    // Nouvel allumage : configuration veille à renvoyer
+    if (newState == State::MODEM_INIT) {
+        sleepConfigured = false;
+        sleepSupported = true;
+    }
+    
+    // Les retry CPIN repassent par le subStep 0 : compteur remis à zéro ici
+    if (newState == State::SIM_CHECK) {
+        cpinRetryCount = 0;
+    }
+    
     currentState = newState;
     lastStateChange = millis();
     stateCycleCount = 0;
     subStep = 0;
     powerStepStartMs = 0;
+    bearerLost = false;
     
-    // Clear pending lors d'un changement d'état
+    // Clear pending et file AT lors d'un changement d'état
+    flushAtQueue();
     clearPending();
 }
 
@@ -583,7 +917,7 @@ void CellularManager::handlePoweringOn()
     // Séquence : LOW (1100ms) → HIGH (100ms) → LOW (2000ms repos)
 
     if (stateCycleCount == 1 && subStep == 0) {
-        Logger::info(TAG, "Allumage modem (PWRKEY)...");
+        LOG_INFO(TAG, "Allumage modem (PWRKEY)...");
     }
 
     switch (subStep) {
@@ -611,7 +945,7 @@ void CellularManager::handlePoweringOn()
             
         case 3:
             if ((millis() - powerStepStartMs) >= 2000) {
-                Logger::debug(TAG, "Séquence allumage terminée");
+                LOG_DEBUG(TAG, "Séquence allumage terminée");
                 changeState(State::MODEM_INIT, "MODEM_INIT");
             }
             return;
@@ -626,7 +960,7 @@ void CellularManager::handlePoweringOff()
     // Séquence : LOW (2000ms) → HIGH (100ms) → LOW (1000ms repos)
 
     if (stateCycleCount == 1 && subStep == 0) {
-        Logger::info(TAG, "Extinction modem (PWRKEY)...");
+        LOG_INFO(TAG, "Extinction modem (PWRKEY)...");
     }
 
     switch (subStep) {
@@ -654,15 +988,15 @@ void CellularManager::handlePoweringOff()
             
         case 3:
             if ((millis() - powerStepStartMs) >= 1000) {
-                Logger::debug(TAG, "Séquence extinction terminée");
+                LOG_DEBUG(TAG, "Séquence extinction terminée");
                 
                 if (recoveryInProgress && enabled) {
-                    Logger::info(TAG, "Recovery : redémarrage modem...");
+                    LOG_INFO(TAG, "Recovery : redémarrage modem...");
                     recoveryInProgress = false;
                     changeState(State::POWERING_ON, "POWERING_ON (recovery)");
                 } else {
                     if (recoveryInProgress) {
-                        Logger::info(TAG, "Recovery annulé (GSM désactivé par utilisateur)");
+                        LOG_INFO(TAG, "Recovery annulé (GSM désactivé par utilisateur)");
                         recoveryInProgress = false;
                     }
                     changeState(State::IDLE, "IDLE");
@@ -698,7 +1032,7 @@ void CellularManager::handleModemInit()
     // 3 = power-cycle : pin LOW (état repos), fin séquence
 
     if (stateCycleCount == 1 && subStep == 0) {
-        Logger::info(TAG, "Démarrage modem...");
+        LOG_INFO(TAG, "Démarrage modem...");
     }
 
     // Power-cycle en cours (séquence non-bloquante)
@@ -706,19 +1040,19 @@ void CellularManager::handleModemInit()
         switch (subStep) {
             case 1:
                 digitalWrite(MODEM_PWR_PIN, LOW);
-                Logger::debug(TAG, "Power-cycle: LOW");
+                LOG_DEBUG(TAG, "Power-cycle: LOW");
                 subStep = 2;
                 return;
                 
             case 2:
                 digitalWrite(MODEM_PWR_PIN, HIGH);
-                Logger::debug(TAG, "Power-cycle: HIGH");
+                LOG_DEBUG(TAG, "Power-cycle: HIGH");
                 subStep = 3;
                 return;
                 
             case 3:
                 digitalWrite(MODEM_PWR_PIN, LOW);
-                Logger::debug(TAG, "Power-cycle: terminé");
+                LOG_DEBUG(TAG, "Power-cycle: terminé");
                 subStep = 0;
                 stateCycleCount = 0;
                 return;
@@ -728,38 +1062,41 @@ void CellularManager::handleModemInit()
     if (budgetExceeded()) return;
 
     // Test AT (TinyGSM bloquant — nécessaire pour synchronisation UART modem)
+    // Octets reçus hors échange (ex. dernier "OK" d'avant une panne) :
+    // testAT() les prendrait pour la réponse d'un modem muet
+    CellularStream::instance().discardRx();
     unsigned long t0 = millis();
     bool atOk = modem.testAT(1000);
     unsigned long dt = millis() - t0;
     
     if (dt > 100) {
-        Logger::info(TAG, String("⏱️ [MODEM_INIT] testAT: ") + dt + "ms (result=" + (atOk ? "OK" : "FAIL") + ")");
+        LOG_INFO(TAG, "⏱️ [MODEM_INIT] testAT: %lums (result=%s)", dt, atOk ? "OK" : "FAIL");
     }
     
     if (atOk) {
-        Logger::info(TAG, " Modem répond aux commandes AT");
+        LOG_INFO(TAG, " Modem répond aux commandes AT");
         changeState(State::SIM_CHECK, "SIM_CHECK");
         return;
     }
 
     // Retry progressif avant power-cycle
     if (stateCycleCount >= MODEM_RETRY_MAX) {
-        Logger::info(TAG, "Démarrage power-cycle modem...");
+        LOG_INFO(TAG, "Démarrage power-cycle modem...");
         subStep = 1;
     } else {
-        Logger::debug(TAG, "Attente modem... (" + String(stateCycleCount) + "/" + String(MODEM_RETRY_MAX) + ")");
+        LOG_DEBUG(TAG, "Attente modem... (%d/%d)", stateCycleCount, MODEM_RETRY_MAX);
     }
 }
 
 // =============================================================================
-// ÉTAT : SIM_CHECK (NON-BLOQUANT via pending — inchangé)
+// ÉTAT : SIM_CHECK (NON-BLOQUANT via file AT)
+// =============================================================================
+// Substeps :
+//   0/1 = AT+CPIN?  → SIM prête (retry si NOT READY)
+//   2/3 = lot AT+CCID / AT+GSN / AT+CIMI / AT+CLTS=1 (aucun échec bloquant)
 // =============================================================================
 void CellularManager::handleSimCheck()
 {
-    // Substeps pairs = SEND, impairs = WAIT
-    // 0/1 = CPIN, 2/3 = CCID, 4/5 = IMEI, 6/7 = IMSI
-
-    static int cpinRetryCount = 0;
     static constexpr int CPIN_MAX_RETRY = 5;
     static constexpr unsigned long CPIN_TIMEOUT_MS = 3000;
     static constexpr unsigned long NUMERIC_TIMEOUT_MS = 2000;
@@ -770,267 +1107,157 @@ void CellularManager::handleSimCheck()
         
         // ----- CPIN -----
         case 0:
-            Logger::info(TAG, "Vérification carte SIM...");
-            cpinRetryCount = 0;
-            modem.sendAT("+CPIN?");
-            startPending(PendingKind::WAIT_CPIN, CPIN_TIMEOUT_MS);
+            LOG_INFO(TAG, "Vérification carte SIM...");
+            enqueueAt("+CPIN?", PendingKind::WAIT_CPIN, CPIN_TIMEOUT_MS, nullptr, nullptr, false);
             subStep = 1;
             return;
             
         case 1:
-            if (!pendingDone) return;
+            if (!isAtQueueIdle()) return;
             
-            if (pendingSuccess) {
-                if (strcmp(pendingData, "READY") == 0) {
-                    Logger::info(TAG, " Carte SIM détectée");
-                    clearPending();
+            if (atLastSuccess) {
+                if (strcmp(atLastData, "READY") == 0) {
+                    LOG_INFO(TAG, " Carte SIM détectée");
                     subStep = 2;
-                } else if (strcmp(pendingData, "NOT READY") == 0) {
+                } else if (strcmp(atLastData, "NOT READY") == 0) {
                     cpinRetryCount++;
                     if (cpinRetryCount < CPIN_MAX_RETRY) {
-                        Logger::debug(TAG, String("SIM NOT READY, retry ") + cpinRetryCount + "/" + CPIN_MAX_RETRY);
-                        clearPending();
+                        LOG_DEBUG(TAG, "SIM NOT READY, retry %d/%d", cpinRetryCount, CPIN_MAX_RETRY);
                         subStep = 0;
+                        yieldToNextCycle = true;
                     } else {
-                        Logger::error(TAG, "SIM NOT READY après " + String(CPIN_MAX_RETRY) + " tentatives");
-                        clearPending();
+                        LOG_ERROR(TAG, "SIM NOT READY après %d tentatives", CPIN_MAX_RETRY);
                         changeState(State::ERROR, "ERROR");
                     }
                 } else {
-                    Logger::error(TAG, String("Carte SIM non prête: ") + pendingData);
-                    clearPending();
+                    LOG_ERROR(TAG, "Carte SIM non prête: %s", atLastData);
                     changeState(State::ERROR, "ERROR");
                 }
             } else {
                 cpinRetryCount++;
                 if (cpinRetryCount < CPIN_MAX_RETRY) {
-                    Logger::debug(TAG, String("CPIN timeout/error, retry ") + cpinRetryCount + "/" + CPIN_MAX_RETRY);
-                    clearPending();
+                    LOG_DEBUG(TAG, "CPIN timeout/error, retry %d/%d", cpinRetryCount, CPIN_MAX_RETRY);
                     subStep = 0;
+                    yieldToNextCycle = true;
                 } else {
-                    Logger::error(TAG, "Erreur vérification SIM");
-                    clearPending();
+                    LOG_ERROR(TAG, "Erreur vérification SIM");
                     changeState(State::ERROR, "ERROR");
                 }
             }
             return;
             
-        // ----- CCID -----
+        // ----- CCID / IMEI / IMSI / CLTS (un seul lot) -----
         case 2:
-            modem.sendAT("+CCID");
-            startPending(PendingKind::WAIT_NUMERIC, NUMERIC_TIMEOUT_MS);
+            enqueueAt("+CCID", PendingKind::WAIT_NUMERIC, NUMERIC_TIMEOUT_MS, onCcidResult, nullptr, false);
+            enqueueAt("+GSN",  PendingKind::WAIT_NUMERIC, NUMERIC_TIMEOUT_MS, onImeiResult, nullptr, false);
+            enqueueAt("+CIMI", PendingKind::WAIT_NUMERIC, NUMERIC_TIMEOUT_MS, onImsiResult, nullptr, false);
+            // Mise à jour horloge modem par le réseau (NITZ → +CCLK, URC *PSUTTZ)
+            enqueueAt("+CLTS=1", PendingKind::WAIT_OK_OR_ERROR, PENDING_TIMEOUT_MS, nullptr, nullptr, false);
             subStep = 3;
             return;
             
         case 3:
-            if (!pendingDone) return;
+            if (!isAtQueueIdle()) return;
             
-            if (pendingSuccess && pendingData[0] != '\0') {
-                Logger::info(TAG, String("CCID: ") + pendingData);
-            } else {
-                Logger::warn(TAG, "CCID non disponible");
-            }
-            clearPending();
-            subStep = 4;
-            return;
-            
-        // ----- IMEI -----
-        case 4:
-            modem.sendAT("+GSN");
-            startPending(PendingKind::WAIT_NUMERIC, NUMERIC_TIMEOUT_MS);
-            subStep = 5;
-            return;
-            
-        case 5:
-            if (!pendingDone) return;
-            
-            if (pendingSuccess && pendingData[0] != '\0') {
-                Logger::info(TAG, String("IMEI: ") + pendingData);
-            } else {
-                Logger::warn(TAG, "IMEI non disponible");
-            }
-            clearPending();
-            subStep = 6;
-            return;
-            
-        // ----- IMSI -----
-        case 6:
-            modem.sendAT("+CIMI");
-            startPending(PendingKind::WAIT_NUMERIC, NUMERIC_TIMEOUT_MS);
-            subStep = 7;
-            return;
-            
-        case 7:
-            if (!pendingDone) return;
-            
-            if (pendingSuccess && pendingData[0] != '\0') {
-                Logger::info(TAG, String("IMSI: ") + pendingData);
+            fastPathAttempt = simIccid.length() > 0 && buildFingerprint() == storedFingerprint;
+            if (fastPathAttempt) {
+                LOG_INFO(TAG, " Configuration inchangée → fast path (vérification bearer)");
+                changeState(State::NETWORK_WAIT, "NETWORK_WAIT");
             } else {
-                Logger::warn(TAG, "IMSI non disponible");
+                changeState(State::NETWORK_CONFIG, "NETWORK_CONFIG");
             }
-            clearPending();
-            changeState(State::NETWORK_CONFIG, "NETWORK_CONFIG");
             return;
     }
 }
 
+// -----------------------------------------------------------------------------
+// Callbacks lot SIM_CHECK (informatifs)
+// -----------------------------------------------------------------------------
+void CellularManager::onCcidResult(bool success, const char* data)
+{
+    if (success && data[0] != '\0') {
+        simIccid = data;
+        LOG_INFO(TAG, "CCID: %s", data);
+    } else {
+        simIccid = "";
+        LOG_WARN(TAG, "CCID non disponible");
+    }
+}
+
+void CellularManager::onImeiResult(bool success, const char* data)
+{
+    if (success && data[0] != '\0') {
+        LOG_INFO(TAG, "IMEI: %s", data);
+    } else {
+        LOG_WARN(TAG, "IMEI non disponible");
+    }
+}
+
+void CellularManager::onImsiResult(bool success, const char* data)
+{
+    if (success && data[0] != '\0') {
+        LOG_INFO(TAG, "IMSI: %s", data);
+    } else {
+        LOG_WARN(TAG, "IMSI non disponible");
+    }
+}
+
 // =============================================================================
-// ÉTAT : NETWORK_CONFIG (NON-BLOQUANT via pending — inchangé)
+// ÉTAT : NETWORK_CONFIG (NON-BLOQUANT via file AT)
+// =============================================================================
+// Substeps :
+//   0 = lot CFUN=0, CNMP, CMNB, CGDCONT, CNCFG, CFUN=1 (échec = ERROR)
+//       + CNETLIGHT (optionnel)
+//   1 = attente fin du lot → NETWORK_WAIT
 // =============================================================================
 void CellularManager::handleNetworkConfig()
 {
-    // Substeps pairs = SEND, impairs = WAIT
-    // 0/1 = CFUN=0, 2/3 = CNMP, 4/5 = CMNB, 6/7 = CGDCONT
-    // 8/9 = CNCFG, 10/11 = CFUN=1, 12 = CNETLIGHT (fire-and-forget)
-
     if (budgetExceeded()) return;
 
     switch (subStep) {
         
-        // ----- CFUN=0 -----
         case 0:
-            Logger::info(TAG, "Configuration réseau...");
-            Logger::debug(TAG, "Désactivation RF...");
-            modem.sendAT("+CFUN=0");
-            startPending(PendingKind::WAIT_OK_OR_ERROR, PENDING_TIMEOUT_MS);
+            LOG_INFO(TAG, "Configuration réseau...");
+            enqueueAt("+CFUN=0", PendingKind::WAIT_OK_OR_ERROR, PENDING_TIMEOUT_MS);
+            enqueueAt((String("+CNMP=") + CELLULAR_NETWORK_MODE).c_str(),
+                      PendingKind::WAIT_OK_OR_ERROR, PENDING_TIMEOUT_MS);
+            enqueueAt((String("+CMNB=") + CELLULAR_PREFERRED_MODE).c_str(),
+                      PendingKind::WAIT_OK_OR_ERROR, PENDING_TIMEOUT_MS);
+            enqueueAt((String("+CGDCONT=1,\"IP\",\"") + CELLULAR_APN + "\"").c_str(),
+                      PendingKind::WAIT_OK_OR_ERROR, PENDING_TIMEOUT_MS);
+            enqueueAt((String("+CNCFG=0,1,\"") + CELLULAR_APN + "\"").c_str(),
+                      PendingKind::WAIT_OK_OR_ERROR, PENDING_TIMEOUT_MS);
+            enqueueAt("+CFUN=1", PendingKind::WAIT_OK_OR_ERROR, PENDING_TIMEOUT_MS);
+            enqueueAt("+CNETLIGHT=1", PendingKind::WAIT_OK_OR_ERROR, PENDING_TIMEOUT_MS,
+                      nullptr, nullptr, false);
             subStep = 1;
             return;
             
         case 1:
-            if (!pendingDone) return;
-            if (pendingSuccess) {
-                Logger::debug(TAG, "RF désactivée");
-                clearPending();
-                subStep = 2;
-            } else {
-                Logger::error(TAG, "Erreur désactivation RF");
-                clearPending();
-                changeState(State::ERROR, "ERROR");
-            }
-            return;
-            
-        // ----- CNMP=38 -----
-        case 2:
-            Logger::debug(TAG, "Configuration Cat-M...");
-            modem.sendAT("+CNMP=38");
-            startPending(PendingKind::WAIT_OK_OR_ERROR, PENDING_TIMEOUT_MS);
-            subStep = 3;
-            return;
-            
-        case 3:
-            if (!pendingDone) return;
-            if (pendingSuccess) {
-                clearPending();
-                subStep = 4;
-            } else {
-                Logger::error(TAG, "Erreur configuration mode réseau");
-                clearPending();
-                changeState(State::ERROR, "ERROR");
-            }
-            return;
-            
-        // ----- CMNB=1 -----
-        case 4:
-            modem.sendAT("+CMNB=1");
-            startPending(PendingKind::WAIT_OK_OR_ERROR, PENDING_TIMEOUT_MS);
-            subStep = 5;
-            return;
+            if (!isAtQueueIdle()) return;
             
-        case 5:
-            if (!pendingDone) return;
-            if (pendingSuccess) {
-                Logger::info(TAG, " Cat-M configuré");
-                clearPending();
-                subStep = 6;
-            } else {
-                Logger::error(TAG, "Erreur configuration préférence");
-                clearPending();
-                changeState(State::ERROR, "ERROR");
-            }
-            return;
-            
-        // ----- CGDCONT -----
-        case 6:
-            Logger::debug(TAG, "Configuration APN...");
-            modem.sendAT("+CGDCONT=1,\"IP\",\"", CELLULAR_APN, "\"");
-            startPending(PendingKind::WAIT_OK_OR_ERROR, PENDING_TIMEOUT_MS);
-            subStep = 7;
-            return;
-            
-        case 7:
-            if (!pendingDone) return;
-            if (pendingSuccess) {
-                Logger::debug(TAG, "APN CGDCONT OK");
-                clearPending();
-                subStep = 8;
-            } else {
-                Logger::error(TAG, "Erreur configuration APN (CGDCONT)");
-                clearPending();
-                changeState(State::ERROR, "ERROR");
-            }
-            return;
-            
-        // ----- CNCFG -----
-        case 8:
-            modem.sendAT("+CNCFG=0,1,\"", CELLULAR_APN, "\"");
-            startPending(PendingKind::WAIT_OK_OR_ERROR, PENDING_TIMEOUT_MS);
-            subStep = 9;
-            return;
-            
-        case 9:
-            if (!pendingDone) return;
-            if (pendingSuccess) {
-                Logger::debug(TAG, "APN CNCFG OK");
-                Logger::info(TAG, "APN configuré: " + String(CELLULAR_APN));
-                clearPending();
-                subStep = 10;
-            } else {
-                Logger::error(TAG, "Erreur configuration APN (CNCFG)");
-                clearPending();
-                changeState(State::ERROR, "ERROR");
-            }
-            return;
-            
-        // ----- CFUN=1 -----
-        case 10:
-            modem.sendAT("+CFUN=1");
-            startPending(PendingKind::WAIT_OK_OR_ERROR, PENDING_TIMEOUT_MS);
-            subStep = 11;
-            return;
-            
-        case 11:
-            if (!pendingDone) return;
-            if (pendingSuccess) {
-                Logger::info(TAG, "RF activée");
-                clearPending();
-                subStep = 12;
-            } else {
-                Logger::error(TAG, "Erreur activation RF");
-                clearPending();
+            if (hasAtQueueFailed()) {
+                LOG_ERROR(TAG, "Erreur configuration réseau (AT%s)", atFailedCommand);
                 changeState(State::ERROR, "ERROR");
+                return;
             }
-            return;
             
-        // ----- CNETLIGHT (fire-and-forget) -----
-        case 12:
-            modem.sendAT("+CNETLIGHT=1");
-            Logger::debug(TAG, "LED réseau activée (fire-and-forget)");
-            Logger::info(TAG, " Configuration terminée");
+            LOG_INFO(TAG, " Cat-M configuré");
+            LOG_INFO(TAG, "APN configuré: %s", CELLULAR_APN);
+            LOG_INFO(TAG, "RF activée");
+            LOG_INFO(TAG, " Configuration terminée");
             changeState(State::NETWORK_WAIT, "NETWORK_WAIT");
             return;
     }
 }
 
 // =============================================================================
-// ÉTAT : NETWORK_WAIT (NON-BLOQUANT via SEND/WAIT)
+// ÉTAT : NETWORK_WAIT (NON-BLOQUANT via file AT)
 // =============================================================================
 // Substeps :
-//   0/1   = AT+CEREG?  → enregistrement réseau (retry jusqu'à timeout)
-//   2/3   = AT+CNACT=0,1 → activation bearer (retry si échec)
-//   4/5   = AT+CGATT?  → vérification GPRS attaché
-//   6/7   = AT+COPS?   → récupération opérateur
-//   8/9   = AT+CNACT?  → récupération IP
-//  10/11  = AT+CSQ     → signal → transition CONNECTED
+//   0/1 = AT+CEREG?    → enregistrement réseau (retry 1x/cycle jusqu'à timeout)
+//   2/3 = AT+CNACT=0,1 → activation bearer (retry 1x/cycle si échec)
+//   4/5 = lot CGATT? (bloquant), COPS?, CNACT?, CSQ → transition CONNECTED
 // =============================================================================
 void CellularManager::handleNetworkWait()
 {
@@ -1042,22 +1269,20 @@ void CellularManager::handleNetworkWait()
         // CEREG : enregistrement réseau
         // =====================================================================
         case 0:
-            modem.sendAT("+CEREG?");
-            startPending(PendingKind::WAIT_PREFIX, PENDING_TIMEOUT_MS, "+CEREG:");
+            enqueueAt("+CEREG?", PendingKind::WAIT_PREFIX, PENDING_TIMEOUT_MS, nullptr, "+CEREG:", false);
             subStep = 1;
             return;
             
         case 1: {
-            if (!pendingDone) return;
+            if (!isAtQueueIdle()) return;
             
-            if (pendingSuccess && pendingData[0] != '\0') {
-                int stat = parseCeregStat(pendingData);
+            if (atLastSuccess && atLastData[0] != '\0') {
+                int stat = AtParser::parseCeregStat(atLastData);
                 
                 if (stat == 1 || stat == 5) {
                     // 1 = home, 5 = roaming
                     const char* info = (stat >= 0 && stat <= 5) ? register_info[stat] : "Unknown";
-                    Logger::info(TAG, String(" Enregistré sur réseau: ") + info);
-                    clearPending();
+                    LOG_INFO(TAG, " Enregistré sur réseau: %s", info);
                     bearerCycleCount = 0;  // Reset pour étape bearer
                     subStep = 2;
                     return;
@@ -1065,22 +1290,25 @@ void CellularManager::handleNetworkWait()
                 
                 // Pas encore enregistré
                 const char* info = (stat >= 0 && stat <= 5) ? register_info[stat] : "Unknown";
-                Logger::debug(TAG, "Recherche réseau... (" + String(stateCycleCount) + "/" + String(TIMEOUT_NETWORK_WAIT) + ") - " + String(info));
+                LOG_DEBUG(TAG, "Recherche réseau... (%d/%d) - %s", stateCycleCount, TIMEOUT_NETWORK_WAIT, info);
             } else {
-                Logger::debug(TAG, "CEREG: pas de réponse, retry...");
+                LOG_DEBUG(TAG, "CEREG: pas de réponse, retry...");
             }
             
             // Timeout global ?
+            if (fastPathAttempt && stateCycleCount >= TIMEOUT_NETWORK_WAIT_FAST) {
+                fallbackFromFastPath("enregistrement réseau");
+                return;
+            }
             if (stateCycleCount >= TIMEOUT_NETWORK_WAIT) {
-                Logger::error(TAG, "Timeout enregistrement réseau");
-                clearPending();
+                LOG_ERROR(TAG, "Timeout enregistrement réseau");
                 changeState(State::ERROR, "ERROR");
                 return;
             }
             
             // Réessayer au prochain cycle
-            clearPending();
             subStep = 0;
+            yieldToNextCycle = true;
             return;
         }
         
@@ -1088,211 +1316,308 @@ void CellularManager::handleNetworkWait()
         // CNACT=0,1 : activation bearer
         // =====================================================================
         case 2:
-            Logger::debug(TAG, "Activation bearer...");
-            modem.sendAT("+CNACT=0,1");
-            startPending(PendingKind::WAIT_OK_OR_ERROR, PENDING_TIMEOUT_BEARER_MS);
+            LOG_DEBUG(TAG, "Activation bearer...");
+            enqueueAt("+CNACT=0,1", PendingKind::WAIT_OK_OR_ERROR, PENDING_TIMEOUT_BEARER_MS, nullptr, nullptr, false);
             subStep = 3;
             return;
             
         case 3:
-            if (!pendingDone) return;
+            if (!isAtQueueIdle()) return;
             
-            if (pendingSuccess) {
-                Logger::debug(TAG, "Bearer activé");
-                clearPending();
+            if (atLastSuccess) {
+                LOG_DEBUG(TAG, "Bearer activé");
                 subStep = 4;
             } else {
                 bearerCycleCount++;
                 if (bearerCycleCount >= BEARER_RETRY_MAX) {
-                    Logger::error(TAG, "Erreur activation bearer après " + String(BEARER_RETRY_MAX) + " tentatives");
-                    clearPending();
+                    if (fallbackFromFastPath("activation bearer")) return;
+                    LOG_ERROR(TAG, "Erreur activation bearer après %d tentatives", BEARER_RETRY_MAX);
                     changeState(State::ERROR, "ERROR");
                 } else {
-                    Logger::debug(TAG, "Bearer retry " + String(bearerCycleCount) + "/" + String(BEARER_RETRY_MAX));
-                    clearPending();
-                    subStep = 2;  // Réessayer
+                    LOG_DEBUG(TAG, "Bearer retry %d/%d", bearerCycleCount, BEARER_RETRY_MAX);
+                    subStep = 2;  // Réessayer au prochain cycle
+                    yieldToNextCycle = true;
                 }
             }
             return;
             
         // =====================================================================
-        // CGATT : vérification GPRS attaché
+        // Lot : CGATT (GPRS attaché), COPS (opérateur), CNACT? (IP), CSQ
         // =====================================================================
         case 4:
-            modem.sendAT("+CGATT?");
-            startPending(PendingKind::WAIT_PREFIX, PENDING_TIMEOUT_MS, "+CGATT:");
+            gprsAttached = -1;
+            enqueueAt("+CGATT?", PendingKind::WAIT_PREFIX, PENDING_TIMEOUT_MS, onCgattResult, "+CGATT:");
+            enqueueAt("+COPS?", PendingKind::WAIT_PREFIX, PENDING_TIMEOUT_COPS_MS, onCopsResult, "+COPS:", false);
+            // CNACT? : filtre sur PDP context 0
+            enqueueAt("+CNACT?", PendingKind::WAIT_PREFIX, PENDING_TIMEOUT_MS, onCnactResult, "+CNACT: 0,", false);
+            enqueueAt("+CSQ", PendingKind::WAIT_PREFIX, PENDING_TIMEOUT_MS, onCsqResult, "+CSQ:", false);
             subStep = 5;
             return;
             
         case 5:
-            if (!pendingDone) return;
+            if (!isAtQueueIdle()) return;
             
-            if (pendingSuccess && pendingData[0] != '\0') {
-                int attached = parseCgatt(pendingData);
-                if (attached == 1) {
-                    Logger::debug(TAG, "GPRS connecté");
-                    clearPending();
-                    subStep = 6;
-                    return;
-                }
+            if (hasAtQueueFailed() || gprsAttached != 1) {
+                if (fallbackFromFastPath("GPRS")) return;
+                LOG_ERROR(TAG, "Pas de connexion GPRS");
+                changeState(State::ERROR, "ERROR");
+                return;
             }
             
-            // Pas attaché ou erreur
-            Logger::error(TAG, "Pas de connexion GPRS");
-            clearPending();
-            changeState(State::ERROR, "ERROR");
-            return;
+            LOG_DEBUG(TAG, "GPRS connecté");
+            LOG_INFO(TAG, "Opérateur: %s", operatorName.length() > 0 ? operatorName.c_str() : "(inconnu)");
+            LOG_INFO(TAG, "IP locale: %s", localIP.toString().c_str());
+            LOG_INFO(TAG, "Signal: %d/31 (%d dBm)", signalQuality, signalTodBm(signalQuality));
             
-        // =====================================================================
-        // COPS : récupération opérateur
-        // =====================================================================
-        case 6:
-            modem.sendAT("+COPS?");
-            startPending(PendingKind::WAIT_PREFIX, PENDING_TIMEOUT_COPS_MS, "+COPS:");
-            subStep = 7;
+            connected = true;
+            recoveryCount = 0;
+            fastPathAttempt = false;
+            saveFingerprint();
+            wakeStartMs = millis();
+            lastActivityMs = wakeStartMs;
+            wakeCheckDone = true;
+            LOG_INFO(TAG, " Modem connecté");
+            changeState(State::CONNECTED, "CONNECTED");
             return;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Callbacks requêtes réseau (NETWORK_WAIT / CONNECTED)
+// -----------------------------------------------------------------------------
+void CellularManager::onCgattResult(bool success, const char* data)
+{
+    gprsAttached = (success && data[0] != '\0') ? AtParser::parseCgatt(data) : -1;
+}
+
+void CellularManager::onCopsResult(bool success, const char* data)
+{
+    operatorName = (success && data[0] != '\0') ? AtParser::parseCopsOperator(data) : "";
+}
+
+void CellularManager::onCnactResult(bool success, const char* data)
+{
+    localIP = (success && data[0] != '\0') ? AtParser::parseCnactIP(data) : IPAddress(0, 0, 0, 0);
+}
+
+void CellularManager::onCsclkResult(bool success, const char* data)
+{
+    csclkAccepted = success;
+}
+
+void CellularManager::onCsqResult(bool success, const char* data)
+{
+    if (success && data[0] != '\0') {
+        signalQuality = AtParser::parseCsq(data);
+    } else if (currentState != State::CONNECTED) {
+        signalQuality = 99;  // En CONNECTED, on garde la dernière valeur connue
+    }
+}
+
+// =============================================================================
+// ÉTAT : CONNECTED (NON-BLOQUANT via file AT)
+// =============================================================================
+// Substeps :
+//   0 = lot AT+CSQ (mise à jour signal) + AT+CGATT? (vérification GPRS)
+//       toutes les CONNECTED_POLL_INTERVAL_MS
+//   1 = évaluation → perte de connexion = NETWORK_WAIT
+// =============================================================================
+void CellularManager::handleConnected()
+{
+    if (budgetExceeded()) return;
+
+    // Bearer désactivé par le réseau (URC) : inutile d'attendre CGATT
+    if (bearerLost && isAtQueueIdle()) {
+        LOG_WARN(TAG, "Bearer désactivé par le réseau (URC)");
+        connected = false;
+        changeState(State::NETWORK_WAIT, "NETWORK_WAIT");
+        return;
+    }
+
+    switch (subStep) {
+        
+        // ----- SEND CSQ + CGATT -----
+        case 0:
+            // Traiter désactivation différée si demandée
+            if (pendingDisable) {
+                LOG_INFO(TAG, "Traitement désactivation différée");
+                pendingDisable = false;
+                connected = false;
+                changeState(State::POWERING_OFF, "POWERING_OFF");
+                return;
+            }
             
-        case 7:
-            if (!pendingDone) return;
-            
-            if (pendingSuccess && pendingData[0] != '\0') {
-                operatorName = parseCopsOperator(pendingData);
-            } else {
-                operatorName = "";
+            // Duty-cycle : veille dès que la fenêtre d'éveil est écoulée sans activité
+            // File vide exigée : une commande externe en vol (SMCONN 20 s, SMPUB
+            // 10 s) peut dépasser MODEM_IDLE_BEFORE_SLEEP_MS
+            if (dutyCycleActive() && wakeCheckDone && !wakeRequested && isAtQueueIdle() &&
+                (millis() - wakeStartMs) >= MODEM_WAKE_WINDOW_MS &&
+                (millis() - lastActivityMs) >= MODEM_IDLE_BEFORE_SLEEP_MS) {
+                
+                if (!sleepConfigured) {
+                    // Une fois par allumage : timers réseau + veille UART pilotée par DTR
+                    enqueueAt((String("+CEDRXS=1,4,\"") + MODEM_EDRX_VALUE + "\"").c_str(),
+                              PendingKind::WAIT_OK_OR_ERROR, PENDING_TIMEOUT_MS, nullptr, nullptr, false);
+                    if (MODEM_PSM_ENABLED) {
+                        enqueueAt((String("+CPSMS=1,,,\"") + MODEM_PSM_TAU + "\",\"" + MODEM_PSM_ACTIVE_TIME + "\"").c_str(),
+                                  PendingKind::WAIT_OK_OR_ERROR, PENDING_TIMEOUT_MS, nullptr, nullptr, false);
+                    } else {
+                        enqueueAt("+CPSMS=0", PendingKind::WAIT_OK_OR_ERROR, PENDING_TIMEOUT_MS, nullptr, nullptr, false);
+                    }
+                    csclkAccepted = false;
+                    enqueueAt("+CSCLK=1", PendingKind::WAIT_OK_OR_ERROR, PENDING_TIMEOUT_MS, onCsclkResult, nullptr, false);
+                    subStep = 2;
+                    return;
+                }
+                
+                LOG_INFO(TAG, "Mise en veille modem (DTR)");
+                setModemSleepPin(true);
+                sleepStartMs = millis();
+                changeState(State::SLEEPING, "SLEEPING");
+                return;
             }
-            Logger::info(TAG, "Opérateur: " + (operatorName.length() > 0 ? operatorName : "(inconnu)"));
-            clearPending();
-            subStep = 8;
-            return;
             
-        // =====================================================================
-        // CNACT? : récupération IP (filtre sur PDP context 0)
-        // =====================================================================
-        case 8:
-            modem.sendAT("+CNACT?");
-            startPending(PendingKind::WAIT_PREFIX, PENDING_TIMEOUT_MS, "+CNACT: 0,");
-            subStep = 9;
+            if ((millis() - lastConnectedPollMs) < CONNECTED_POLL_INTERVAL_MS) return;
+            lastConnectedPollMs = millis();
+            
+            gprsAttached = -1;
+            enqueueAt("+CSQ", PendingKind::WAIT_PREFIX, PENDING_TIMEOUT_MS, onCsqResult, "+CSQ:", false);
+            enqueueAt("+CGATT?", PendingKind::WAIT_PREFIX, PENDING_TIMEOUT_MS, onCgattResult, "+CGATT:", false);
+            subStep = 1;
             return;
             
-        case 9:
-            if (!pendingDone) return;
+        // ----- WAIT CSQ + CGATT -----
+        case 1:
+            if (!isAtQueueIdle()) return;
             
-            if (pendingSuccess && pendingData[0] != '\0') {
-                localIP = parseCnactIP(pendingData);
-            } else {
-                localIP = IPAddress(0, 0, 0, 0);
+            if (gprsAttached == -1) {
+                // Pas de réponse → considérer comme perte de connexion
+                LOG_WARN(TAG, "CGATT sans réponse - connexion perdue ?");
+                connected = false;
+                changeState(State::NETWORK_WAIT, "NETWORK_WAIT");
+                return;
             }
-            Logger::info(TAG, "IP locale: " + localIP.toString());
-            clearPending();
-            subStep = 10;
-            return;
             
-        // =====================================================================
-        // CSQ : signal → transition CONNECTED
-        // =====================================================================
-        case 10:
-            modem.sendAT("+CSQ");
-            startPending(PendingKind::WAIT_PREFIX, PENDING_TIMEOUT_MS, "+CSQ:");
-            subStep = 11;
-            return;
+            if (gprsAttached != 1) {
+                LOG_WARN(TAG, "Connexion perdue !");
+                connected = false;
+                changeState(State::NETWORK_WAIT, "NETWORK_WAIT");
+                return;
+            }
             
-        case 11:
-            if (!pendingDone) return;
+            // Cycle complet → recommencer
+            wakeCheckDone = true;
+            subStep = 0;
+            return;
             
-            if (pendingSuccess && pendingData[0] != '\0') {
-                signalQuality = parseCsq(pendingData);
-            } else {
-                signalQuality = 99;
+        // ----- WAIT configuration veille (CEDRXS / CPSMS / CSCLK) -----
+        case 2:
+            if (!isAtQueueIdle()) return;
+            
+            // Résultat capté par le callback de AT+CSCLK=1 : atLastSuccess peut
+            // venir d'une commande externe enfilée après le lot
+            sleepConfigured = true;
+            sleepSupported = csclkAccepted;
+            if (!sleepSupported) {
+                LOG_WARN(TAG, "AT+CSCLK refusé - duty-cycle désactivé jusqu'au prochain allumage");
             }
-            Logger::info(TAG, "Signal: " + String(signalQuality) + "/31 (" + String(signalTodBm(signalQuality)) + " dBm)");
-            
-            connected = true;
-            recoveryCount = 0;
-            Logger::info(TAG, " Modem connecté");
-            clearPending();
-            changeState(State::CONNECTED, "CONNECTED");
+            subStep = 0;
             return;
     }
 }
 
 // =============================================================================
-// ÉTAT : CONNECTED (NON-BLOQUANT via SEND/WAIT)
+// ÉTAT : SLEEPING (modem enregistré, UART en veille via DTR)
 // =============================================================================
 // Substeps :
-//   0/1 = AT+CSQ    → mise à jour signal
-//   2/3 = AT+CGATT? → vérification connexion GPRS
-// Cycle complet = 4 substeps = 4 appels handle() = ~8 secondes
+//   0 = veille jusqu'à requestWake(), réveil périodique ou fin du duty-cycle
+//   1 = DTR bas depuis MODEM_DTR_WAKE_DELAY_MS → sonde AT
+//   2 = réponse sonde → CONNECTED (vérification CSQ/CGATT immédiate)
 // =============================================================================
-void CellularManager::handleConnected()
+void CellularManager::handleSleeping()
 {
-    if (budgetExceeded()) return;
-
     switch (subStep) {
         
-        // ----- SEND CSQ -----
         case 0:
-            modem.sendAT("+CSQ");
-            startPending(PendingKind::WAIT_PREFIX, PENDING_TIMEOUT_MS, "+CSQ:");
+            if (!wakeRequested && dutyCycleActive() &&
+                (millis() - sleepStartMs) < MODEM_WAKE_INTERVAL_MS) {
+                return;
+            }
+            
+            LOG_INFO(TAG, "%s", wakeRequested ? "Réveil modem (demande)" : "Réveil modem (périodique)");
+            if (dtrSleep) {
+                setModemSleepPin(false);  // Déjà bas si requestWake()
+            }
+            wakeProbeCount = 0;
             subStep = 1;
             return;
             
-        // ----- WAIT CSQ -----
         case 1:
-            if (!pendingDone) return;
-            
-            if (pendingSuccess && pendingData[0] != '\0') {
-                signalQuality = parseCsq(pendingData);
-            }
-            clearPending();
+            if ((millis() - dtrWakeMs) < MODEM_DTR_WAKE_DELAY_MS) return;
+            enqueueAt("", PendingKind::WAIT_OK, PENDING_TIMEOUT_MS, nullptr, nullptr, false);
             subStep = 2;
             return;
             
-        // ----- SEND CGATT -----
         case 2:
-            modem.sendAT("+CGATT?");
-            startPending(PendingKind::WAIT_PREFIX, PENDING_TIMEOUT_MS, "+CGATT:");
-            subStep = 3;
-            return;
-            
-        // ----- WAIT CGATT -----
-        case 3:
-            if (!pendingDone) return;
-            
-            if (pendingSuccess && pendingData[0] != '\0') {
-                int attached = parseCgatt(pendingData);
-                if (attached != 1) {
-                    Logger::warn(TAG, "Connexion perdue !");
-                    connected = false;
-                    clearPending();
-                    changeState(State::NETWORK_WAIT, "NETWORK_WAIT");
-                    return;
-                }
-            } else {
-                // Pas de réponse → considérer comme perte de connexion
-                Logger::warn(TAG, "CGATT sans réponse - connexion perdue ?");
-                connected = false;
-                clearPending();
-                changeState(State::NETWORK_WAIT, "NETWORK_WAIT");
+            if (!isAtQueueIdle()) return;
+            
+            if (atLastSuccess) {
+                wakeCheckDone = false;
+                wakeStartMs = millis();
+                lastActivityMs = wakeStartMs;
+                lastConnectedPollMs = wakeStartMs - CONNECTED_POLL_INTERVAL_MS;  // Vérification immédiate
+                changeState(State::CONNECTED, "CONNECTED");
                 return;
             }
             
-            clearPending();
-            
-            // Traiter désactivation différée si demandée
-            if (pendingDisable) {
-                Logger::info(TAG, "Traitement désactivation différée");
-                pendingDisable = false;
-                connected = false;
-                changeState(State::POWERING_OFF, "POWERING_OFF");
+            wakeProbeCount++;
+            if (wakeProbeCount < WAKE_PROBE_MAX) {
+                subStep = 1;
+                yieldToNextCycle = true;
                 return;
             }
             
-            // Cycle complet → recommencer
-            subStep = 0;
+            LOG_ERROR(TAG, "Modem muet après réveil");
+            connected = false;
+            changeState(State::ERROR, "ERROR");
             return;
     }
 }
 
+// -----------------------------------------------------------------------------
+// Duty-cycle : actif selon configuration, support modem et alimentation
+// -----------------------------------------------------------------------------
+bool CellularManager::dutyCycleActive()
+{
+    if (!MODEM_DUTY_CYCLE_ENABLED || !sleepSupported) return false;
+    if (MODEM_DUTY_CYCLE_BATTERY_ONLY && PowerManager::isExternalPowerPresent()) return false;
+    return true;
+}
+
+void CellularManager::setModemSleepPin(bool sleep)
+{
+    digitalWrite(MODEM_DTR_PIN, sleep ? HIGH : LOW);
+    dtrSleep = sleep;
+    if (!sleep) {
+        dtrWakeMs = millis();
+    }
+}
+
+void CellularManager::requestWake()
+{
+    if (currentState != State::SLEEPING || wakeRequested) return;
+    
+    // DTR bas immédiatement : le délai de sortie de veille court pendant
+    // l'attente du prochain cycle de handle()
+    wakeRequested = true;
+    setModemSleepPin(false);
+}
+
+bool CellularManager::isSleeping()
+{
+    return currentState == State::SLEEPING;
+}
+
 // =============================================================================
 // ÉTAT : ERROR (avec recovery automatique NON-BLOQUANT)
 // =============================================================================
@@ -1302,7 +1627,7 @@ void CellularManager::handleError()
 
     // Traiter pendingDisable prioritairement
     if (pendingDisable) {
-        Logger::info(TAG, "Traitement désactivation différée (depuis ERROR)");
+        LOG_INFO(TAG, "Traitement désactivation différée (depuis ERROR)");
         pendingDisable = false;
         changeState(State::POWERING_OFF, "POWERING_OFF");
         return;
@@ -1311,12 +1636,12 @@ void CellularManager::handleError()
     // Premier cycle : log de l'erreur
     if (stateCycleCount == 1) {
         if (recoveryCount >= MAX_RECOVERY_ATTEMPTS) {
-            Logger::error(TAG, "Modem en erreur - recovery max atteint (" + 
-                         String(MAX_RECOVERY_ATTEMPTS) + " tentatives)");
-            Logger::error(TAG, "Mode dégradé : GSM indisponible");
+            LOG_ERROR(TAG, "Modem en erreur - recovery max atteint (%d tentatives)",
+                      MAX_RECOVERY_ATTEMPTS);
+            LOG_ERROR(TAG, "Mode dégradé : GSM indisponible");
         } else {
-            Logger::error(TAG, "Modem en erreur - recovery dans 5 min (tentative " + 
-                         String(recoveryCount + 1) + "/" + String(MAX_RECOVERY_ATTEMPTS) + ")");
+            LOG_ERROR(TAG, "Modem en erreur - recovery dans 5 min (tentative %d/%d)",
+                      recoveryCount + 1, MAX_RECOVERY_ATTEMPTS);
         }
     }
 
@@ -1327,7 +1652,7 @@ void CellularManager::handleError()
 
     // Attendre 5 minutes avant recovery
     if (stateCycleCount >= ERROR_WAIT_CYCLES) {
-        Logger::info(TAG, "Tentative de recovery modem...");
+        LOG_INFO(TAG, "Tentative de recovery modem...");
         recoveryCount++;
         recoveryInProgress = true;
         changeState(State::POWERING_OFF, "POWERING_OFF (recovery)");
@@ -1391,7 +1716,7 @@ String CellularManager::getStatus()
         return "Recherche réseau...";
     }
 
-    String status = "Connecté";
+    String status = (currentState == State::SLEEPING) ? "Connecté (veille)" : "Connecté";
 
     if (operatorName.length() > 0) {
         status += " (" + operatorName + ")";
@@ -1,7 +1,10 @@
 // src/Connectivity/CellularManager.h
 // Gestionnaire modem SIM7080G — 100% non-bloquant
-// Tous les appels AT passent par le système pending (SEND/WAIT)
-// TinyGSM conservé uniquement comme wrapper haut niveau (SMS, futur MQTT)
+// Tous les appels AT passent par la file AT (enchaînement sans attendre handle())
+// La file alimente un unique pending (SEND/WAIT) : le modem ne traite qu'une
+// commande à la fois sur l'UART
+// TinyGSM conservé uniquement comme wrapper haut niveau (SMS)
+// MQTT : pile native du modem via la file AT (voir MqttUplink)
 
 #ifndef CELLULARMANAGER_H
 #define CELLULARMANAGER_H
@@ -26,6 +29,7 @@ public:
         NETWORK_CONFIG,   // Configuration Cat-M + APN
         NETWORK_WAIT,     // Attente enregistrement réseau + activation bearer
         CONNECTED,        // Modem connecté et opérationnel
+        SLEEPING,         // Connecté, modem en veille (DTR haut, eDRX/PSM)
         ERROR             // Erreur avec recovery automatique
     };
 
@@ -50,6 +54,61 @@ public:
     // -----------------------------------------------------------------------------
     static void onModemLine(CellularLineType type, const char* line);
 
+    // -----------------------------------------------------------------------------
+    // URC abonnées (appelées par CellularEvent via le trie de préfixes)
+    // -----------------------------------------------------------------------------
+    static void onUrcAppPdp(const char* line, const char* args);  // "+APP PDP: 0,DEACTIVE"
+
+    // -----------------------------------------------------------------------------
+    // Types de réponse attendue (système pending)
+    // -----------------------------------------------------------------------------
+    // WAIT_OK           : commande SET simple (ex: AT)
+    // WAIT_OK_OR_ERROR  : commande SET avec ERROR possible (ex: AT+CFUN=0)
+    // WAIT_CPIN         : capture +CPIN: xxx puis OK (SIM_CHECK)
+    // WAIT_NUMERIC      : capture ligne 100% digits puis OK (CCID/IMEI/IMSI)
+    // WAIT_PREFIX       : capture première ligne matchant pendingPrefix puis OK
+    //                     Utilisé pour toute commande QUERY (AT+CEREG?, AT+CSQ, etc.)
+    // WAIT_PROMPT_PAYLOAD : attend ">" puis envoie la charge utile, puis OK
+    //                     (AT+SMPUB, envoi de données brutes)
+    // -----------------------------------------------------------------------------
+    enum class PendingKind {
+        NONE,
+        WAIT_OK,
+        WAIT_OK_OR_ERROR,
+        WAIT_CPIN,
+        WAIT_NUMERIC,
+        WAIT_PREFIX,        // Générique : capture ligne matchant un préfixe configurable
+        WAIT_PROMPT_PAYLOAD // Prompt ">" → envoi charge utile → OK
+    };
+
+    // -----------------------------------------------------------------------------
+    // File AT (commandes enchaînées sans attendre le cycle de 2s)
+    // -----------------------------------------------------------------------------
+    // Chaque commande est envoyée dès que la précédente est terminée (OK, ERROR
+    // ou timeout). Le callback reçoit le résultat et les données capturées
+    // (pendingData). abortOnError : un échec purge les commandes restantes de
+    // la machine d'états et lève hasAtQueueFailed() jusqu'au prochain lot.
+    // Les commandes des modules externes ne sont jamais purgées par l'échec
+    // d'une autre ; si la file est vidée (changement d'état), leur callback
+    // est appelé avec success = false.
+    // command : sans le préfixe "AT" (ex: "+CSQ")
+    // Modem en veille : commande refusée (false) et réveil demandé
+    // -----------------------------------------------------------------------------
+    typedef void (*AtCallback)(bool success, const char* data);
+
+    static constexpr uint8_t AT_QUEUE_SIZE = 12;
+
+    static bool enqueueAt(const char* command, PendingKind kind, unsigned long timeoutMs,
+                          AtCallback cb = nullptr, const char* prefix = nullptr,
+                          bool abortOnError = true);
+    // Commande à prompt ">" suivie d'une charge utile brute (WAIT_PROMPT_PAYLOAD)
+    // payload : non copié, doit rester valide jusqu'à l'appel du callback
+    static bool enqueueAtWithPayload(const char* command, const uint8_t* payload, size_t payloadLen,
+                                     unsigned long timeoutMs, AtCallback cb = nullptr);
+    static bool isAtQueueIdle();       // File vide ET aucune commande en vol
+    static bool hasAtQueueFailed();    // Lot courant interrompu par un échec
+    static void poll();                // Appelé toutes les 20ms (après CellularEvent::poll)
+
     // -----------------------------------------------------------------------------
     // Contrôle ON/OFF (persistant)
     // -----------------------------------------------------------------------------
@@ -57,6 +116,12 @@ public:
     static bool isEnabled();               // État activé/désactivé
     static bool isConnected();             // État connecté (réseau + IP)
 
+    // -----------------------------------------------------------------------------
+    // Duty-cycle radio (voir MODEM_DUTY_CYCLE_* dans TimingConfig.h)
+    // -----------------------------------------------------------------------------
+    static void requestWake();             // Réveil anticipé (travail sortant en attente)
+    static bool isSleeping();              // Modem en veille
+
     // -----------------------------------------------------------------------------
     // Gestion ticket modem (pour SmsManager, etc.)
     // -----------------------------------------------------------------------------
@@ -72,6 +137,12 @@ public:
     static IPAddress getLocalIP();       // IP locale
     static bool isPendingActive();       // Pending en cours ?
 
+    // -----------------------------------------------------------------------------
+    // Statistiques budget temps (BUDGET_MS)
+    // -----------------------------------------------------------------------------
+    static unsigned long getHandleMaxDurationMs();  // Durée max observée d'un cycle
+    static uint32_t getBudgetOverruns();            // Cycles > BUDGET_MS
+
     // -----------------------------------------------------------------------------
     // Helpers
     // -----------------------------------------------------------------------------
@@ -97,27 +168,14 @@ private:
     static int subStep;
     static int bearerCycleCount;
     static unsigned long handleStartTime;
+    static unsigned long handleMaxDurationMs;
+    static uint32_t budgetOverruns;
     static unsigned long powerStepStartMs;  // Timestamp pour séquences PWRKEY
+    static bool bearerLost;                 // Levé par URC "+APP PDP: 0,DEACTIVE"
 
     // -----------------------------------------------------------------------------
     // Système pending (SEND/WAIT non-bloquant)
     // -----------------------------------------------------------------------------
-    // WAIT_OK           : commande SET simple (ex: AT)
-    // WAIT_OK_OR_ERROR  : commande SET avec ERROR possible (ex: AT+CFUN=0)
-    // WAIT_CPIN         : capture +CPIN: xxx puis OK (SIM_CHECK)
-    // WAIT_NUMERIC      : capture ligne 100% digits puis OK (CCID/IMEI/IMSI)
-    // WAIT_PREFIX       : capture première ligne matchant pendingPrefix puis OK
-    //                     Utilisé pour toute commande QUERY (AT+CEREG?, AT+CSQ, etc.)
-    // -----------------------------------------------------------------------------
-    enum class PendingKind {
-        NONE,
-        WAIT_OK,
-        WAIT_OK_OR_ERROR,
-        WAIT_CPIN,
-        WAIT_NUMERIC,
-        WAIT_PREFIX         // Générique : capture ligne matchant un préfixe configurable
-    };
-    
     static bool pendingActive;
     static PendingKind pendingKind;
     static unsigned long pendingStartMs;
@@ -126,6 +184,33 @@ private:
     static bool pendingSuccess;
     static char pendingData[64];    // Données extraites (ligne complète pour WAIT_PREFIX)
     static char pendingPrefix[16];  // Préfixe attendu pour WAIT_PREFIX (ex: "+CEREG:")
+    static const uint8_t* pendingPayload;  // Charge utile WAIT_PROMPT_PAYLOAD
+    static size_t pendingPayloadLen;
+    static bool pendingPayloadSent;
+
+    // -----------------------------------------------------------------------------
+    // File AT (ring buffer statique, aucune allocation)
+    // -----------------------------------------------------------------------------
+    struct AtRequest {
+        char command[64];
+        PendingKind kind;
+        char prefix[16];
+        unsigned long timeoutMs;
+        AtCallback cb;
+        bool abortOnError;
+        bool internal;              // Machine d'états (false = module externe)
+        const uint8_t* payload;     // WAIT_PROMPT_PAYLOAD uniquement
+        size_t payloadLen;
+    };
+
+    static AtRequest atQueue[AT_QUEUE_SIZE];
+    static uint8_t atQueueHead;
+    static uint8_t atQueueCount;
+    static bool atInFlight;             // Le pending courant appartient à la file
+    static bool atQueueFailed;
+    static bool atLastSuccess;          // Résultat de la dernière commande terminée
+    static char atLastData[64];         // Données capturées par la dernière commande
+    static char atFailedCommand[64];    // Commande ayant interrompu le lot
 
     // -----------------------------------------------------------------------------
     // Gestion ticket modem
@@ -148,14 +233,41 @@ private:
     static void handleNetworkConfig();
     static void handleNetworkWait();
     static void handleConnected();
+    static void handleSleeping();
     static void handleError();
+    static void runStateMachine();
+    static void advanceStateMachine();
+
+    // -----------------------------------------------------------------------------
+    // Callbacks file AT (résultats des lots)
+    // -----------------------------------------------------------------------------
+    static void onCcidResult(bool success, const char* data);
+    static void onImeiResult(bool success, const char* data);
+    static void onImsiResult(bool success, const char* data);
+    static void onCgattResult(bool success, const char* data);
+    static void onCopsResult(bool success, const char* data);
+    static void onCnactResult(bool success, const char* data);
+    static void onCsqResult(bool success, const char* data);
+    static void onCsclkResult(bool success, const char* data);
 
     // -----------------------------------------------------------------------------
     // Helpers internes
     // -----------------------------------------------------------------------------
     static void changeState(State newState, const char* stateName);
     static bool budgetExceeded();
+    static void recordHandleDuration(unsigned long durationMs);
     static void loadPreferences();
+    static bool dutyCycleActive();
+    static void setModemSleepPin(bool sleep);
+
+    // -----------------------------------------------------------------------------
+    // Empreinte de configuration (fast path re-attach)
+    // ICCID|APN|CNMP|CMNB de la dernière connexion réussie, stockée en NVS
+    // -----------------------------------------------------------------------------
+    static String buildFingerprint();
+    static void saveFingerprint();
+    static void clearFingerprint();
+    static bool fallbackFromFastPath(const char* reason);
 
     // -----------------------------------------------------------------------------
     // Helpers pending
@@ -164,6 +276,13 @@ private:
     static void startPending(PendingKind kind, unsigned long timeoutMs, const char* prefix = nullptr);
     static void clearPending();
     static void checkPendingTimeout();
+
+    // -----------------------------------------------------------------------------
+    // Helpers file AT
+    // -----------------------------------------------------------------------------
+    static void completeAtRequest();
+    static void flushAtQueue();
+    static void purgeInternalRequests();
 };
 
 // -----------------------------------------------------------------------------
@@ -1,6 +1,6 @@
 // src/Connectivity/CellularStream.cpp
 // Implémentation du proxy Stream avec pompage automatique
-// Chaque appel à available()/read()/peek() pompe Serial1 d'abord
+// Chaque appel à available()/read()/peek() pompe l'UART d'abord
 
 #include "Connectivity/CellularStream.h"
 
@@ -13,6 +13,14 @@ CellularStream& CellularStream::instance()
     return inst;
 }
 
+// -----------------------------------------------------------------------------
+// Liaison UART
+// -----------------------------------------------------------------------------
+void CellularStream::begin(Stream& uartStream)
+{
+    uart = &uartStream;
+}
+
 // -----------------------------------------------------------------------------
 // Configuration callback octet
 // -----------------------------------------------------------------------------
@@ -30,12 +38,23 @@ void CellularStream::setRxBufferingEnabled(bool enabled)
 }
 
 // -----------------------------------------------------------------------------
-// Pompage Serial1 → ring buffer (appelé automatiquement)
+// Vidage RX (l'UART est pompé d'abord : le tap voit tous les octets)
 // -----------------------------------------------------------------------------
-void CellularStream::pumpSerial1()
+void CellularStream::discardRx()
 {
-    while (Serial1.available()) {
-        uint8_t c = Serial1.read();
+    pumpUart();
+    rxTail = rxHead;
+}
+
+// -----------------------------------------------------------------------------
+// Pompage UART → ring buffer (appelé automatiquement)
+// -----------------------------------------------------------------------------
+void CellularStream::pumpUart()
+{
+    if (!uart) return;
+    
+    while (uart->available()) {
+        uint8_t c = uart->read();
         
         // Compteur systématique (indépendant du callback et du gating)
         statsTapBytes++;
@@ -57,7 +76,7 @@ void CellularStream::pumpSerial1()
 // -----------------------------------------------------------------------------
 void CellularStream::pump()
 {
-    pumpSerial1();
+    pumpUart();
 }
 
 // -----------------------------------------------------------------------------
@@ -113,8 +132,8 @@ uint32_t CellularStream::getTapBytesCount() const
 // -----------------------------------------------------------------------------
 int CellularStream::available()
 {
-    // Pomper Serial1 d'abord
-    pumpSerial1();
+    // Pomper l'UART d'abord
+    pumpUart();
     
     // Calculer taille disponible
     uint16_t head = rxHead;
@@ -132,8 +151,8 @@ int CellularStream::available()
 // -----------------------------------------------------------------------------
 int CellularStream::read()
 {
-    // Pomper Serial1 d'abord
-    pumpSerial1();
+    // Pomper l'UART d'abord
+    pumpUart();
     
     // Buffer vide ?
     if (rxTail == rxHead) {
@@ -150,8 +169,8 @@ int CellularStream::read()
 // -----------------------------------------------------------------------------
 int CellularStream::peek()
 {
-    // Pomper Serial1 d'abord
-    pumpSerial1();
+    // Pomper l'UART d'abord
+    pumpUart();
     
     // Buffer vide ?
     if (rxTail == rxHead) {
@@ -162,19 +181,19 @@ int CellularStream::peek()
 }
 
 // -----------------------------------------------------------------------------
-// Stream : write (forward vers Serial1)
+// Stream : write (forward vers l'UART)
 // -----------------------------------------------------------------------------
 size_t CellularStream::write(uint8_t c)
 {
-    return Serial1.write(c);
+    return uart ? uart->write(c) : 0;
 }
 
 size_t CellularStream::write(const uint8_t* buf, size_t len)
 {
-    return Serial1.write(buf, len);
+    return uart ? uart->write(buf, len) : 0;
 }
 
 void CellularStream::flush()
 {
-    Serial1.flush();
+    if (uart) uart->flush();
 }
\ No newline at end of file
@@ -1,7 +1,9 @@
 // src/Connectivity/CellularStream.h
 // Proxy Stream pour TinyGSM avec ring buffer RX et pompage automatique
 // Rôle : Permettre à TinyGSM de fonctionner sans bloquer TaskManager
-//        Le pompage Serial1 se fait à chaque appel available()/read()/peek()
+//        Le pompage UART se fait à chaque appel available()/read()/peek()
+//        L'UART est injecté par begin() (Serial1 en production, tout autre
+//        Stream pour rejouer un dialogue modem)
 
 #ifndef CELLULARSTREAM_H
 #define CELLULARSTREAM_H
@@ -15,6 +17,12 @@ public:
     // -------------------------------------------------------------------------
     static CellularStream& instance();
     
+    // -------------------------------------------------------------------------
+    // Liaison UART (appelé par CellularManager::init après Serial1.begin)
+    // Aucune lecture/écriture tant que begin() n'a pas été appelé
+    // -------------------------------------------------------------------------
+    void begin(Stream& uart);
+    
     // -------------------------------------------------------------------------
     // Pompage manuel (appelé par CellularEvent)
     // -------------------------------------------------------------------------
@@ -31,6 +39,12 @@ public:
     // -------------------------------------------------------------------------
     void setRxBufferingEnabled(bool enabled);
     
+    // -------------------------------------------------------------------------
+    // Vider le ring buffer RX avant un échange TinyGSM : les octets reçus hors
+    // échange (URC, réponses tardives) satisferaient le prochain waitResponse()
+    // -------------------------------------------------------------------------
+    void discardRx();
+    
     // -------------------------------------------------------------------------
     // Statistiques
     // -------------------------------------------------------------------------
@@ -41,14 +55,14 @@ public:
     
     // -------------------------------------------------------------------------
     // Stream : lecture (utilisé par TinyGSM)
-    // Chaque appel pompe d'abord Serial1
+    // Chaque appel pompe d'abord l'UART
     // -------------------------------------------------------------------------
     int available() override;
     int read() override;
     int peek() override;
     
     // -------------------------------------------------------------------------
-    // Stream : écriture (forward vers Serial1)
+    // Stream : écriture (forward vers l'UART)
     // -------------------------------------------------------------------------
     size_t write(uint8_t c) override;
     size_t write(const uint8_t* buf, size_t len) override;
@@ -63,11 +77,16 @@ private:
     CellularStream& operator=(const CellularStream&) = delete;
     
     // -------------------------------------------------------------------------
-    // Pompage interne Serial1 → ring buffer
+    // Pompage interne UART → ring buffer
     // -------------------------------------------------------------------------
-    void pumpSerial1();
+    void pumpUart();
     void pushByte(uint8_t c);
     
+    // -------------------------------------------------------------------------
+    // UART modem (injecté)
+    // -------------------------------------------------------------------------
+    Stream* uart = nullptr;
+    
     // -------------------------------------------------------------------------
     // Ring buffer RX
     // -------------------------------------------------------------------------
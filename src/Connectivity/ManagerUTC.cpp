@@ -1,12 +1,18 @@
 // Connectivity/ManagerUTC.cpp
 
 #include "Connectivity/ManagerUTC.h"
+#include "Connectivity/AtParser.h"
+#include "Connectivity/CellularManager.h"
+#include "Connectivity/CellularEvent.h"
 #include <WiFi.h>
 #include <time.h>
+#include <sys/time.h>
 #include "lwip/apps/sntp.h"
 #include "Config/Config.h"
 #include "Utils/Logger.h"
 
+static const char* TAG = "UTC";
+
 // ─────────────────────────────────────────────
 // Paramètres temporels (validés)
 // ─────────────────────────────────────────────
@@ -19,23 +25,55 @@ static constexpr uint32_t RESYNC_PERIOD_MS          = 3UL * 60UL * 60UL * 1000UL
 static constexpr uint32_t EXPIRED_RETRY_PERIOD_MS   = 60UL * 60UL * 1000UL;      // 1 h
 static constexpr uint32_t UTC_EXPIRATION_MS         = 25UL * 60UL * 60UL * 1000UL; // 25 h
 
+// Dérive estimée : horloge corrigée → synchros plus espacées
+static constexpr uint32_t DRIFT_RESYNC_PERIOD_MS    = 24UL * 60UL * 60UL * 1000UL;      // 24 h
+static constexpr uint32_t DRIFT_EXPIRATION_MS       = 7UL * 24UL * 60UL * 60UL * 1000UL; // 7 j
+
+// Estimation de dérive (régression sur l'historique des synchros NTP)
+// L'heure cellulaire (résolution 1 s) n'y entre pas : sur les ≤ 21 h
+// d'historique, ±0,5 s par point donne une pente fausse de plusieurs ppm,
+// soit des dizaines de secondes sur DRIFT_EXPIRATION_MS
+static constexpr uint8_t  DRIFT_MIN_POINTS          = 3;
+static constexpr uint32_t DRIFT_MIN_SPAN_MS         = 6UL * 60UL * 60UL * 1000UL; // 6 h
+static constexpr int32_t  DRIFT_MAX_PPB             = 200000;                    // ±200 ppm (quartz)
+
+// Correction d'offset : pas franc au-delà de 2 s, sinon rattrapage progressif
+static constexpr int64_t  SLEW_STEP_THRESHOLD_MS    = 2000;
+static constexpr int64_t  SLEW_RATE_DIVISOR         = 2000;  // 1 ms corrigée / 2 s (500 ppm)
+
 static constexpr time_t   UTC_MIN_VALID_TIMESTAMP   = 1700000000; // ~2023
 
+// Heure cellulaire : pas de délai de stabilité (NITZ reçu à l'enregistrement)
+static constexpr uint32_t CELL_RETRY_INTERVAL_MS    = 30UL * 1000UL;        // 30 s
+static constexpr unsigned long CCLK_TIMEOUT_MS      = 2000;
+
 // ─────────────────────────────────────────────
 // État interne
 // ─────────────────────────────────────────────
 
 bool     ManagerUTC::utcValid          = false;
 bool     ManagerUTC::everSynced        = false;
+UtcSource ManagerUTC::source           = UtcSource::None;
 
 uint32_t ManagerUTC::networkUpSinceMs  = 0;
 uint32_t ManagerUTC::lastAttemptMs     = 0;
 uint32_t ManagerUTC::lastSyncMs        = 0;
+uint32_t ManagerUTC::lastCellularQueryMs = 0;
+bool     ManagerUTC::cellularQueryRequested = false;
 
 uint8_t  ManagerUTC::bootAttempts      = 0;
 
 uint32_t ManagerUTC::syncRelMs         = 0;
-time_t   ManagerUTC::syncUtc           = 0;
+int64_t  ManagerUTC::syncUtcMs         = 0;
+int32_t  ManagerUTC::driftPpb          = 0;
+bool     ManagerUTC::driftKnown        = false;
+
+int64_t  ManagerUTC::slewOffsetMs      = 0;
+uint32_t ManagerUTC::slewDurationMs    = 0;
+
+ManagerUTC::SyncPoint ManagerUTC::history[ManagerUTC::HISTORY_SIZE];
+uint8_t  ManagerUTC::historyCount      = 0;
+uint8_t  ManagerUTC::historyHead       = 0;
 
 // ─────────────────────────────────────────────
 // Initialisation
@@ -45,6 +83,7 @@ void ManagerUTC::init()
 {
     utcValid         = false;
     everSynced       = false;
+    source           = UtcSource::None;
 
     networkUpSinceMs = 0;
     lastAttemptMs    = 0;
@@ -53,10 +92,23 @@ void ManagerUTC::init()
     bootAttempts     = 0;
 
     syncRelMs        = 0;
-    syncUtc          = 0;
+    syncUtcMs        = 0;
+    driftPpb         = 0;
+    driftKnown       = false;
+    slewOffsetMs     = 0;
+    slewDurationMs   = 0;
+    historyCount     = 0;
+    historyHead      = 0;
+
+    lastCellularQueryMs    = 0;
+    cellularQueryRequested = true;   // Première requête dès que le modem est prêt
 
     // On s'assure que SNTP est arrêté au démarrage
     sntp_stop();
+
+    // Heure réseau cellulaire (NITZ) poussée par le modem
+    CellularEvent::registerUrcHandler("*PSUTTZ:", onUrcPsuttz);
+    CellularEvent::registerUrcHandler("+CTZV:", onUrcCtzv);
 }
 
 // ─────────────────────────────────────────────
@@ -67,7 +119,16 @@ void ManagerUTC::handle()
 {
     const uint32_t nowMs = millis();
 
-    // ─── Gestion état réseau ──────────────────
+    // ─── Expiration sans resync (25h, 7j si dérive connue) ──
+    if (utcValid && nowMs - lastSyncMs >= expirationMs()) {
+        utcValid = false;
+        source   = UtcSource::None;
+    }
+
+    // ─── Source cellulaire (indépendante du Wi-Fi) ──
+    handleCellular(nowMs);
+
+    // ─── Gestion état réseau Wi-Fi ────────────
     if (WiFi.status() == WL_CONNECTED) {
         if (networkUpSinceMs == 0) {
             networkUpSinceMs = nowMs;
@@ -84,8 +145,8 @@ void ManagerUTC::handle()
         return;
     }
 
-    // ─── UTC invalide ─────────────────────────
-    if (!utcValid) {
+    // ─── UTC invalide ou issue d'une source moins bien classée ──
+    if (!utcValid || source != UtcSource::Ntp) {
 
         uint32_t retryInterval =
             (everSynced || bootAttempts >= BOOT_MAX_ATTEMPTS)
@@ -99,29 +160,224 @@ void ManagerUTC::handle()
                 bootAttempts++;
             }
 
-            if (trySync()) {
-                utcValid   = true;
-                everSynced = true;
-                lastSyncMs = nowMs;
-            }
+            trySync();
         }
 
         return;
     }
 
-    // ─── UTC valide : resync toutes les 3h ─────
-    if (nowMs - lastSyncMs >= RESYNC_PERIOD_MS) {
-        if (trySync()) {
-            lastSyncMs = nowMs;
-        }
+    // ─── UTC valide : resync toutes les 3h (24h si dérive connue) ──
+    // NTP injoignable : un essai par heure (trySync bloque jusqu'à 10 s)
+    if (nowMs - lastSyncMs >= resyncPeriodMs() &&
+        nowMs - lastAttemptMs >= EXPIRED_RETRY_PERIOD_MS) {
+        lastAttemptMs = nowMs;
+        trySync();
     }
+}
 
-    // ─── Expiration après 25h sans resync ─────
-    if (nowMs - lastSyncMs >= UTC_EXPIRATION_MS) {
-        utcValid = false;
+// ─────────────────────────────────────────────
+// Source cellulaire : AT+CCLK? via la file AT
+// - UTC invalide : toutes les 30 s tant que le modem est connecté
+// - UTC cellulaire : resync toutes les 3h / 24h (au réveil suivant si veille)
+// - UTC NTP : jamais (source mieux classée)
+// ─────────────────────────────────────────────
+
+void ManagerUTC::handleCellular(uint32_t nowMs)
+{
+    if (!CellularManager::isConnected()) return;
+
+    bool due;
+    if (!utcValid) {
+        due = cellularQueryRequested || (nowMs - lastCellularQueryMs >= CELL_RETRY_INTERVAL_MS);
+    } else if (source == UtcSource::Cellular) {
+        due = cellularQueryRequested || (nowMs - lastSyncMs >= resyncPeriodMs() &&
+                                         nowMs - lastCellularQueryMs >= CELL_RETRY_INTERVAL_MS);
+    } else {
+        due = false;
+    }
+    if (!due) return;
+
+    // Modem en veille : UTC manquante = réveil, sinon attendre le réveil périodique
+    if (CellularManager::isSleeping()) {
+        if (!utcValid) CellularManager::requestWake();
+        return;
+    }
+    if (!CellularManager::isModemAvailable()) return;
+
+    if (CellularManager::enqueueAt("+CCLK?", CellularManager::PendingKind::WAIT_PREFIX,
+                                   CCLK_TIMEOUT_MS, onCclkResult, "+CCLK:", false)) {
+        lastCellularQueryMs    = nowMs;
+        cellularQueryRequested = false;
+    }
+}
+
+void ManagerUTC::onCclkResult(bool success, const char* data)
+{
+    if (!success || data[0] == '\0') return;
+
+    // Avant réception NITZ, le modem renvoie son horloge par défaut (1980)
+    time_t utc = AtParser::parseCclk(data);
+    if (utc < UTC_MIN_VALID_TIMESTAMP) {
+        LOG_DEBUG(TAG, "Heure modem pas encore reçue du réseau");
+        return;
+    }
+
+    applyCellularTime(utc);
+}
+
+void ManagerUTC::onUrcPsuttz(const char* line, const char* args)
+{
+    time_t utc = AtParser::parsePsuttz(args);
+    if (utc >= UTC_MIN_VALID_TIMESTAMP) {
+        applyCellularTime(utc);
+    }
+}
+
+void ManagerUTC::onUrcCtzv(const char* line, const char* args)
+{
+    // Fuseau seul (pas d'heure) : l'horloge modem vient d'être mise à jour
+    cellularQueryRequested = true;
+}
+
+void ManagerUTC::applyCellularTime(time_t utc)
+{
+    const uint32_t nowMs = millis();
+
+    // Classement : ne pas écraser une synchro NTP encore fraîche
+    if (utcValid && source == UtcSource::Ntp && nowMs - lastSyncMs < resyncPeriodMs()) {
+        return;
+    }
+
+    bool firstSync = !utcValid;
+
+    applySync(nowMs, static_cast<int64_t>(utc) * 1000, UtcSource::Cellular);
+
+    // Horloge système (time()/localtime()) alignée, comme après SNTP.
+    // Sans effet sur la détection NTP : trySync() attend le statut SNTP,
+    // pas une horloge système plausible
+    struct timeval tv = { utc, 0 };
+    settimeofday(&tv, nullptr);
+    setenv("TZ", SYSTEM_TIMEZONE, 1);
+    tzset();
+
+    if (firstSync) {
+        LOG_INFO(TAG, "Synchro cellulaire (NITZ) réussie : %lu", (unsigned long)utc);
     }
 }
 
+// ─────────────────────────────────────────────
+// Modèle d'horloge
+//
+// utc(t) = syncUtcMs + Δ + Δ × driftPpb / 1e9 + slew(t)    (Δ = t − syncRelMs)
+//
+// - driftPpb : dérive du quartz, moindres carrés sur les HISTORY_SIZE
+//   dernières synchros d'une même source (écart total ≥ 6 h)
+// - slew(t)  : écart constaté à la dernière synchro, rattrapé linéairement
+//   (500 ppm max) → horodatages sans saut ni retour en arrière
+// - écart > 2 s ou première synchro : pas franc
+// ─────────────────────────────────────────────
+
+int64_t ManagerUTC::utcMsAt(uint32_t t_rel_ms)
+{
+    int64_t deltaMs = static_cast<int32_t>(t_rel_ms - syncRelMs);
+    int64_t utcMs   = syncUtcMs + deltaMs + deltaMs * driftPpb / 1000000000LL;
+
+    if (slewOffsetMs != 0 && deltaMs > 0) {
+        utcMs += (deltaMs >= slewDurationMs)
+                     ? slewOffsetMs
+                     : slewOffsetMs * deltaMs / slewDurationMs;
+    }
+    return utcMs;
+}
+
+void ManagerUTC::applySync(uint32_t relMs, int64_t utcMs, UtcSource src)
+{
+    // Changement de source : biais différents → historique non mélangé
+    if (src != source) {
+        historyCount = 0;
+        historyHead  = 0;
+        driftKnown   = false;
+        driftPpb     = 0;
+    }
+
+    history[historyHead] = { relMs, utcMs };
+    historyHead = (historyHead + 1) % HISTORY_SIZE;
+    if (historyCount < HISTORY_SIZE) historyCount++;
+
+    // Prédiction de l'ancien modèle (continuité des horodatages)
+    int64_t predictedMs = utcMsAt(relMs);
+    int64_t offsetMs    = utcMs - predictedMs;
+
+    if (src == UtcSource::Ntp) updateDrift();
+
+    if (!utcValid || offsetMs > SLEW_STEP_THRESHOLD_MS || offsetMs < -SLEW_STEP_THRESHOLD_MS) {
+        // Pas franc
+        syncUtcMs      = utcMs;
+        slewOffsetMs   = 0;
+        slewDurationMs = 0;
+    } else {
+        // Repart de la valeur prédite, l'écart est rattrapé progressivement
+        syncUtcMs      = predictedMs;
+        slewOffsetMs   = offsetMs;
+        slewDurationMs = static_cast<uint32_t>((offsetMs < 0 ? -offsetMs : offsetMs) * SLEW_RATE_DIVISOR);
+    }
+    syncRelMs = relMs;
+
+    utcValid   = true;
+    everSynced = true;
+    source     = src;
+    lastSyncMs = relMs;
+
+    if (driftKnown) {
+        LOG_DEBUG(TAG, "Écart %ld ms, dérive %.2f ppm", (long)offsetMs, driftPpb / 1000.0);
+    }
+}
+
+void ManagerUTC::updateDrift()
+{
+    if (historyCount < DRIFT_MIN_POINTS) return;
+
+    // Point le plus ancien = origine (écarts relatifs, pas de débordement)
+    const uint8_t oldest = (historyHead + HISTORY_SIZE - historyCount) % HISTORY_SIZE;
+    const uint8_t newest = (historyHead + HISTORY_SIZE - 1) % HISTORY_SIZE;
+    const SyncPoint& origin = history[oldest];
+
+    if (history[newest].relMs - origin.relMs < DRIFT_MIN_SPAN_MS) return;
+
+    // Moindres carrés : erreur (UTC − local) en fonction du temps local
+    double sumX = 0, sumY = 0, sumXX = 0, sumXY = 0;
+    for (uint8_t i = 0; i < historyCount; i++) {
+        const SyncPoint& p = history[(oldest + i) % HISTORY_SIZE];
+        double x = static_cast<double>(p.relMs - origin.relMs);
+        double y = static_cast<double>(p.utcMs - origin.utcMs) - x;
+        sumX  += x;
+        sumY  += y;
+        sumXX += x * x;
+        sumXY += x * y;
+    }
+
+    const double n     = historyCount;
+    const double denom = n * sumXX - sumX * sumX;
+    if (denom <= 0) return;
+
+    double ppb = (n * sumXY - sumX * sumY) / denom * 1e9;
+    if (ppb >  DRIFT_MAX_PPB) ppb =  DRIFT_MAX_PPB;
+    if (ppb < -DRIFT_MAX_PPB) ppb = -DRIFT_MAX_PPB;
+
+    driftPpb   = static_cast<int32_t>(ppb);
+    driftKnown = true;
+}
+
+uint32_t ManagerUTC::resyncPeriodMs()
+{
+    return driftKnown ? DRIFT_RESYNC_PERIOD_MS : RESYNC_PERIOD_MS;
+}
+
+uint32_t ManagerUTC::expirationMs()
+{
+    return driftKnown ? DRIFT_EXPIRATION_MS : UTC_EXPIRATION_MS;
+}
+
 // ─────────────────────────────────────────────
 // API publique
 // ─────────────────────────────────────────────
@@ -131,20 +387,28 @@ bool ManagerUTC::isUtcValid()
     return utcValid;
 }
 
+UtcSource ManagerUTC::getSource()
+{
+    return source;
+}
+
+float ManagerUTC::getDriftPpm()
+{
+    return driftKnown ? driftPpb / 1000.0f : 0.0f;
+}
+
 time_t ManagerUTC::nowUtc()
 {
     if (!utcValid) return 0;
 
-    uint32_t deltaMs = millis() - syncRelMs;
-    return syncUtc + static_cast<time_t>(deltaMs / 1000UL);
+    return static_cast<time_t>(utcMsAt(millis()) / 1000);
 }
 
 time_t ManagerUTC::convertFromRelative(uint32_t t_rel_ms)
 {
     if (!utcValid) return 0;
 
-    int32_t deltaMs = static_cast<int32_t>(t_rel_ms - syncRelMs);
-    return syncUtc + static_cast<time_t>(deltaMs / 1000L);
+    return static_cast<time_t>(utcMsAt(t_rel_ms) / 1000);
 }
 
 // ─────────────────────────────────────────────
@@ -157,28 +421,41 @@ bool ManagerUTC::trySync()
         return false;
     }
 
-    // Configuration des serveurs NTP
-    configTzTime(SYSTEM_TIMEZONE, "pool.ntp.org", "time.nist.gov", "europe.pool.ntp.org");
+    // Statut remis à zéro AVANT le démarrage : l'horloge système peut déjà
+    // être valide (synchro précédente, heure cellulaire) et ne prouve rien.
+    // Seul le passage à COMPLETED atteste une réponse SNTP reçue
+    sntp_set_sync_status(SNTP_SYNC_STATUS_RESET);
 
-    // Démarrage manuel du client SNTP
-    sntp_init();
+    // Configuration des serveurs NTP (démarre le client SNTP)
+    configTzTime(SYSTEM_TIMEZONE, "pool.ntp.org", "time.nist.gov", "europe.pool.ntp.org");
 
     const uint32_t startMs = millis();
-    time_t utcNow = 0;
+    struct timeval tv = { 0, 0 };
 
     // On laisse jusqu'à 10 secondes pour recevoir une réponse valide
     while (millis() - startMs < 10000) {
-        time(&utcNow);
-        if (utcNow >= UTC_MIN_VALID_TIMESTAMP) {
+        if (sntp_get_sync_status() == SNTP_SYNC_STATUS_COMPLETED) {
+            gettimeofday(&tv, nullptr);
             sntp_stop();  // Arrêt immédiat pour limiter les émissions
 
-            syncRelMs = millis();
-            syncUtc   = utcNow;
+            if (tv.tv_sec < UTC_MIN_VALID_TIMESTAMP) {
+                LOG_WARN(TAG, "Réponse SNTP incohérente, ignorée");
+                return false;
+            }
+
+            const bool promoted = utcValid && source == UtcSource::Cellular;
+
+            // Précision ms (SNTP) : points exploitables pour la dérive
+            applySync(millis(),
+                      static_cast<int64_t>(tv.tv_sec) * 1000 + tv.tv_usec / 1000,
+                      UtcSource::Ntp);
 
-            Logger::info("[UTC] Synchro NTP réussie après " + 
-                String(bootAttempts) + 
-                " essai(s) au boot (temps : " + 
-                String((millis() - networkUpSinceMs) / 1000) + " s depuis connexion WiFi)");
+            if (promoted) {
+                LOG_INFO(TAG, "Synchro NTP réussie : remplace l'heure cellulaire");
+            } else {
+                LOG_INFO(TAG, "Synchro NTP réussie après %u essai(s) au boot (temps : %lu s depuis connexion WiFi)",
+                         (unsigned)bootAttempts, (unsigned long)((millis() - networkUpSinceMs) / 1000));
+            }
             
             return true;
         }
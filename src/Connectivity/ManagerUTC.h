@@ -9,15 +9,26 @@
  *
  * Source unique de vérité du temps UTC.
  *
- * - Synchronisation NTP via Wi-Fi
+ * - Sources classées : NTP via Wi-Fi (préférée) > heure réseau cellulaire
+ *   (AT+CCLK? / URC *PSUTTZ, NITZ)
+ * - Une source moins bien classée ne remplace jamais une synchro récente
+ *   d'une source mieux classée
  * - UTC invalide par défaut
- * - UTC invalide après 25h sans NTP
- * - Aucune approximation temporelle
+ * - Dérive du quartz estimée sur l'historique des synchros NTP et compensée
+ * - Écarts de resync < 2 s rattrapés progressivement (pas de saut)
+ * - UTC invalide après 25h sans synchronisation (7 j si dérive connue)
  * - Aucune persistance après reboot
  *
  * Le système peut fonctionner entièrement sans UTC.
  */
 
+// Sources de temps (ordre = rang : plus grand = plus fiable)
+enum class UtcSource : uint8_t {
+    None,
+    Cellular,   // NITZ opérateur (précision ~1 s)
+    Ntp         // SNTP via Wi-Fi
+};
+
 class ManagerUTC {
 public:
     // Cycle de vie
@@ -31,23 +42,62 @@ public:
     // Conversion relatif → UTC (DataLogger)
     static time_t convertFromRelative(uint32_t t_rel_ms);
 
+    // Source de la dernière synchronisation
+    static UtcSource getSource();
+
+    // Dérive estimée de l'horloge locale (0 tant qu'inconnue)
+    static float getDriftPpm();
+
+    // URC modem (abonnées auprès de CellularEvent dans init())
+    static void onUrcPsuttz(const char* line, const char* args);
+    static void onUrcCtzv(const char* line, const char* args);
+
 private:
     // Synchronisation
     static bool trySync();
+    static void handleCellular(uint32_t nowMs);
+    static void applyCellularTime(time_t utc);
+    static void onCclkResult(bool success, const char* data);
+
+    // Modèle d'horloge
+    static void     applySync(uint32_t relMs, int64_t utcMs, UtcSource src);
+    static void     updateDrift();
+    static int64_t  utcMsAt(uint32_t t_rel_ms);
+    static uint32_t resyncPeriodMs();
+    static uint32_t expirationMs();
 
     // État UTC
     static bool     utcValid;
     static bool     everSynced;
+    static UtcSource source;
 
     // Timers
     static uint32_t networkUpSinceMs;
     static uint32_t lastAttemptMs;
     static uint32_t lastSyncMs;
+    static uint32_t lastCellularQueryMs;
+    static bool     cellularQueryRequested;
 
     // Politique
     static uint8_t  bootAttempts;
 
-    // Référence temporelle
+    // Référence temporelle (ancre du modèle)
     static uint32_t syncRelMs;
-    static time_t   syncUtc;
+    static int64_t  syncUtcMs;
+    static int32_t  driftPpb;       // Correction de dérive (milliardièmes)
+    static bool     driftKnown;
+
+    // Rattrapage progressif de l'écart constaté à la dernière synchro
+    static int64_t  slewOffsetMs;
+    static uint32_t slewDurationMs;
+
+    // Historique des synchros (mesures brutes)
+    struct SyncPoint {
+        uint32_t relMs;
+        int64_t  utcMs;
+    };
+    static constexpr uint8_t HISTORY_SIZE = 8;
+    static SyncPoint history[HISTORY_SIZE];
+    static uint8_t   historyCount;
+    static uint8_t   historyHead;
 };
@@ -0,0 +1,441 @@
+// src/Connectivity/MqttUplink.cpp
+// Uplink MQTT store-and-forward — enchaînement par callbacks de la file AT
+// (lecture du journal et encodage dans pump(), jamais dans un callback)
+// Une fenêtre = SMCONF → SMCONN → N × SMPUB → SMDISC
+// Le point de reprise n'avance qu'après OK du modem sur SMPUB (at-least-once)
+// Chaque message = une trame RecordCodec couvrant un bloc de lignes CSV complètes
+
+#include "Connectivity/MqttUplink.h"
+#include "Connectivity/CellularManager.h"
+#include "Config/NetworkConfig.h"
+#include "Config/TimingConfig.h"
+#include "Storage/DataLogger.h"
+#include "Storage/CsvLogReader.h"
+#include "Storage/FileSystem.h"
+#include "Utils/Logger.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Tag pour logs
+static const char* TAG = "MQTT";
+
+// -----------------------------------------------------------------------------
+// Membres statiques
+// -----------------------------------------------------------------------------
+MqttUplink::State MqttUplink::currentState = State::IDLE;
+unsigned long MqttUplink::stepStartMs = 0;
+unsigned long MqttUplink::lastWindowMs = 0;
+bool MqttUplink::firstWindowDone = false;
+bool MqttUplink::stepFailed = false;
+bool MqttUplink::publishDue = false;
+
+uint32_t MqttUplink::highWaterMark = 0;
+uint32_t MqttUplink::savedHighWaterMark = 0;
+size_t MqttUplink::chunkLen = 0;
+uint16_t MqttUplink::windowPublishCount = 0;
+
+uint32_t MqttUplink::publishedCount = 0;
+uint32_t MqttUplink::failedWindows = 0;
+
+uint8_t MqttUplink::payload[MAX_PAYLOAD];
+char MqttUplink::csvBuffer[CSV_BUFFER_SIZE];
+CodecSample MqttUplink::samples[MAX_SAMPLES];
+uint16_t MqttUplink::sampleEnd[MAX_SAMPLES];
+
+Preferences MqttUplink::preferences;
+
+// -----------------------------------------------------------------------------
+// Initialisation : chargement du point de reprise
+// -----------------------------------------------------------------------------
+void MqttUplink::init()
+{
+    preferences.begin("mqtt", false);
+    highWaterMark = preferences.getUInt("hwm", 0);
+    preferences.end();
+    savedHighWaterMark = highWaterMark;
+
+    currentState = State::IDLE;
+    firstWindowDone = false;
+
+    if (MQTT_BROKER_HOST[0] == '\0') {
+        Logger::info(TAG, "Uplink MQTT désactivé (broker non configuré)");
+        return;
+    }
+
+    LOG_INFO(TAG, "Uplink MQTT initialisé - reprise à l'offset %lu", (unsigned long)highWaterMark);
+}
+
+// -----------------------------------------------------------------------------
+// Handle : ouverture des fenêtres + surveillance des étapes
+// -----------------------------------------------------------------------------
+void MqttUplink::handle()
+{
+    if (MQTT_BROKER_HOST[0] == '\0') return;
+
+    // Fenêtre en cours : les étapes avancent par callbacks, ici uniquement
+    // le garde-fou (file AT purgée par un changement d'état modem, etc.)
+    if (currentState != State::IDLE) {
+        if (!CellularManager::isConnected()) {
+            LOG_WARN(TAG, "Connexion modem perdue - fenêtre abandonnée");
+            endWindow(false);
+        } else if ((millis() - stepStartMs) >= MQTT_UPLINK_STEP_TIMEOUT_MS) {
+            LOG_WARN(TAG, "Étape MQTT sans réponse - fenêtre abandonnée");
+            endWindow(false);
+        }
+        return;
+    }
+
+    // Fenêtre due ? (première dès que le modem est connecté)
+    if (firstWindowDone && (millis() - lastWindowMs) < MQTT_UPLINK_INTERVAL_MS) return;
+    if (!CellularManager::isConnected()) return;
+
+    // Modem en veille : réveil, la fenêtre s'ouvrira quand il sera disponible
+    if (CellularManager::isSleeping()) {
+        CellularManager::requestWake();
+        return;
+    }
+    if (!CellularManager::isModemAvailable()) return;
+
+    // Publier aussi les enregistrements encore en RAM
+    DataLogger::flush();
+
+    File file = FileSystem::fs().open("/datalog.csv", FILE_READ);
+    size_t logSize = file ? file.size() : 0;
+    if (file) file.close();
+
+    if (logSize < highWaterMark) {
+        if (highWaterMark - logSize <= DataLogger::getPerf().recoveredBytes) {
+            // Fin de fichier tronquée au boot (flush interrompu) : déjà publiée
+            LOG_WARN(TAG, "Journal tronqué après coupure - reprise à la nouvelle fin");
+            highWaterMark = logSize;
+        } else {
+            // Historique effacé depuis la dernière fenêtre
+            LOG_WARN(TAG, "Journal plus court que le point de reprise - reprise au début");
+            highWaterMark = 0;
+        }
+        saveHighWaterMark();
+    }
+
+    if (logSize == highWaterMark) {
+        // Rien à publier : pas de réveil radio inutile
+        lastWindowMs = millis();
+        firstWindowDone = true;
+        return;
+    }
+
+    LOG_INFO(TAG, "Fenêtre uplink : %lu octets en attente", (unsigned long)(logSize - highWaterMark));
+    startWindow();
+}
+
+// -----------------------------------------------------------------------------
+// Pump : lecture du journal et encodage hors du chemin des callbacks AT
+// (appelés depuis CellularManager::poll, tâche 20 ms)
+// -----------------------------------------------------------------------------
+void MqttUplink::pump()
+{
+    if (!publishDue || currentState != State::PUBLISHING) return;
+
+    publishDue = false;
+    publishNext();
+}
+
+// -----------------------------------------------------------------------------
+// Monitoring
+// -----------------------------------------------------------------------------
+bool MqttUplink::isBusy()
+{
+    return currentState != State::IDLE;
+}
+
+uint32_t MqttUplink::getHighWaterMark()
+{
+    return highWaterMark;
+}
+
+uint32_t MqttUplink::getPublishedCount()
+{
+    return publishedCount;
+}
+
+uint32_t MqttUplink::getFailedWindows()
+{
+    return failedWindows;
+}
+
+// =============================================================================
+// ÉTAPES DE LA FENÊTRE
+// =============================================================================
+
+void MqttUplink::setState(State newState)
+{
+    currentState = newState;
+    stepStartMs = millis();
+}
+
+// -----------------------------------------------------------------------------
+// CONFIGURING : lot SMCONF (SMDISC préalable = session propre après abandon)
+// -----------------------------------------------------------------------------
+void MqttUplink::startWindow()
+{
+    char cmd[6][64];
+    int count = 0;
+    bool truncated = false;
+
+    truncated |= snprintf(cmd[count++], sizeof(cmd[0]), "+SMCONF=\"URL\",\"%s\",%u",
+                          MQTT_BROKER_HOST, MQTT_BROKER_PORT) >= (int)sizeof(cmd[0]);
+    truncated |= snprintf(cmd[count++], sizeof(cmd[0]), "+SMCONF=\"CLIENTID\",\"%s\"",
+                          MQTT_CLIENT_ID) >= (int)sizeof(cmd[0]);
+    snprintf(cmd[count++], sizeof(cmd[0]), "+SMCONF=\"KEEPTIME\",%u", MQTT_KEEPALIVE_S);
+    snprintf(cmd[count++], sizeof(cmd[0]), "+SMCONF=\"CLEANSS\",1");
+    if (MQTT_USERNAME[0] != '\0') {
+        truncated |= snprintf(cmd[count++], sizeof(cmd[0]), "+SMCONF=\"USERNAME\",\"%s\"",
+                              MQTT_USERNAME) >= (int)sizeof(cmd[0]);
+        truncated |= snprintf(cmd[count++], sizeof(cmd[0]), "+SMCONF=\"PASSWORD\",\"%s\"",
+                              MQTT_PASSWORD) >= (int)sizeof(cmd[0]);
+    }
+
+    if (truncated) {
+        LOG_ERROR(TAG, "Paramètre MQTT trop long pour une commande AT (63 car. max)");
+        lastWindowMs = millis();
+        firstWindowDone = true;
+        failedWindows++;
+        return;
+    }
+
+    stepFailed = false;
+    publishDue = false;
+    windowPublishCount = 0;
+    setState(State::CONFIGURING);
+
+    // File pleine ou modem en veille : rien ne partirait, abandon immédiat
+    // (les commandes déjà enfilées voient l'état IDLE dans leur callback)
+    bool queued = CellularManager::enqueueAt("+SMDISC", CellularManager::PendingKind::WAIT_OK_OR_ERROR,
+                                             TIMEOUT_SMDISC_MS, nullptr, nullptr, false);
+    for (int i = 0; queued && i < count; i++) {
+        queued = CellularManager::enqueueAt(cmd[i], CellularManager::PendingKind::WAIT_OK_OR_ERROR,
+                                            TIMEOUT_SMCONF_MS,
+                                            (i == count - 1) ? onConfigDone : onConfigResult,
+                                            nullptr, false);
+    }
+    if (!queued) {
+        LOG_WARN(TAG, "File AT indisponible - fenêtre abandonnée");
+        endWindow(false);
+    }
+}
+
+void MqttUplink::onConfigResult(bool success, const char* data)
+{
+    if (currentState != State::CONFIGURING) return;
+    if (!success) stepFailed = true;
+}
+
+void MqttUplink::onConfigDone(bool success, const char* data)
+{
+    if (currentState != State::CONFIGURING) return;
+
+    if (!success || stepFailed) {
+        LOG_ERROR(TAG, "Erreur configuration MQTT (AT+SMCONF)");
+        endWindow(false);
+        return;
+    }
+
+    // CONNECTING
+    setState(State::CONNECTING);
+    if (!CellularManager::enqueueAt("+SMCONN", CellularManager::PendingKind::WAIT_OK_OR_ERROR,
+                                    TIMEOUT_SMCONN_MS, onConnectResult, nullptr, false)) {
+        LOG_WARN(TAG, "File AT indisponible - fenêtre abandonnée");
+        endWindow(false);
+    }
+}
+
+void MqttUplink::onConnectResult(bool success, const char* data)
+{
+    if (currentState != State::CONNECTING) return;
+
+    if (!success) {
+        LOG_ERROR(TAG, "Connexion broker MQTT échouée");
+        endWindow(false);
+        return;
+    }
+
+    Logger::info(TAG, " Connecté au broker");
+    setState(State::PUBLISHING);
+    publishDue = true;
+}
+
+// -----------------------------------------------------------------------------
+// PUBLISHING : un message = une trame binaire (bloc de lignes CSV complètes)
+// -----------------------------------------------------------------------------
+void MqttUplink::publishNext()
+{
+    if (windowPublishCount >= MAX_PUBLISH_PER_WINDOW) {
+        disconnect();
+        return;
+    }
+
+    size_t payloadLen = loadChunk();
+    if (payloadLen == 0) {
+        disconnect();
+        return;
+    }
+
+    char cmd[64];
+    snprintf(cmd, sizeof(cmd), "+SMPUB=\"%s\",%u,%u,0",
+             MQTT_TOPIC_TELEMETRY, (unsigned)payloadLen, MQTT_QOS);
+
+    stepStartMs = millis();
+    if (!CellularManager::enqueueAtWithPayload(cmd, payload, payloadLen, TIMEOUT_SMPUB_MS, onPublishResult)) {
+        // Point de reprise inchangé : le bloc repartira à la prochaine fenêtre
+        LOG_WARN(TAG, "File AT indisponible - publication abandonnée");
+        stepFailed = true;
+        disconnect();
+    }
+}
+
+void MqttUplink::onPublishResult(bool success, const char* data)
+{
+    if (currentState != State::PUBLISHING) return;
+
+    if (!success) {
+        LOG_WARN(TAG, "Publication refusée à l'offset %lu", (unsigned long)highWaterMark);
+        stepFailed = true;
+        disconnect();
+        return;
+    }
+
+    highWaterMark += chunkLen;
+    publishedCount++;
+    windowPublishCount++;
+    publishDue = true;
+}
+
+// -----------------------------------------------------------------------------
+// Encodage du prochain bloc depuis le point de reprise
+// Retourne la taille de la trame (0 = rien de complet à publier)
+// chunkLen = octets CSV couverts par la trame (avance du point de reprise)
+// -----------------------------------------------------------------------------
+size_t MqttUplink::loadChunk()
+{
+    File file = FileSystem::fs().open("/datalog.csv", FILE_READ);
+    if (!file) return 0;
+
+    while (true) {
+        if (highWaterMark >= file.size() || !file.seek(highWaterMark)) {
+            file.close();
+            return 0;
+        }
+
+        size_t n = file.read((uint8_t*)csvBuffer, CSV_BUFFER_SIZE);
+
+        // Découpage en lignes complètes uniquement
+        size_t count = 0;
+        size_t consumed = 0;
+        while (consumed < n && count < MAX_SAMPLES) {
+            char* nl = (char*)memchr(csvBuffer + consumed, '\n', n - consumed);
+            if (!nl) break;
+
+            *nl = '\0';
+            size_t lineEnd = (nl - csvBuffer) + 1;
+
+            // Parsing partagé avec DataLogger (texte dé-échappé en place)
+            CsvRecord rec;
+            if (CsvLogReader::parseLine(csvBuffer + consumed, rec)) {
+                CodecSample& s = samples[count];
+                s.timestamp = rec.timestamp;
+                s.type      = rec.type;
+                s.id        = rec.id;
+                s.isText    = rec.isText;
+                s.milli     = rec.isText ? 0 : RecordCodec::quantize(rec.value);
+                s.text      = rec.text;
+                s.textLen   = rec.textLen;
+                sampleEnd[count] = (uint16_t)lineEnd;
+                count++;
+            }
+            consumed = lineEnd;
+        }
+
+        if (count > 0) {
+            // Réduire le lot jusqu'à ce que la trame tienne dans un message
+            size_t k = count;
+            size_t len = 0;
+            while (k > 0 && (len = RecordCodec::encode(samples, k, payload, MAX_PAYLOAD)) == 0) {
+                k /= 2;
+            }
+            if (len > 0) {
+                file.close();
+                chunkLen = sampleEnd[k - 1];
+                return len;
+            }
+            // Un seul échantillon trop gros (texte > MAX_PAYLOAD) : ignoré
+            LOG_WARN(TAG, "Enregistrement trop long ignoré à l'offset %lu", (unsigned long)highWaterMark);
+            highWaterMark += sampleEnd[0];
+            continue;
+        }
+
+        if (consumed > 0) {
+            // Bloc de lignes mal formées : sautées
+            highWaterMark += consumed;
+            continue;
+        }
+
+        if (n < CSV_BUFFER_SIZE) {
+            // Dernière ligne incomplète (écriture en cours) : attendre
+            file.close();
+            return 0;
+        }
+
+        // Ligne plus longue que la fenêtre de lecture : impossible à publier, on la saute
+        LOG_WARN(TAG, "Ligne trop longue ignorée à l'offset %lu", (unsigned long)highWaterMark);
+        highWaterMark += n;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// DISCONNECTING
+// -----------------------------------------------------------------------------
+void MqttUplink::disconnect()
+{
+    setState(State::DISCONNECTING);
+    if (!CellularManager::enqueueAt("+SMDISC", CellularManager::PendingKind::WAIT_OK_OR_ERROR,
+                                    TIMEOUT_SMDISC_MS, onDisconnectResult, nullptr, false)) {
+        // Session laissée ouverte : la prochaine fenêtre commence par SMDISC
+        endWindow(false);
+    }
+}
+
+void MqttUplink::onDisconnectResult(bool success, const char* data)
+{
+    if (currentState != State::DISCONNECTING) return;
+    endWindow(!stepFailed);
+}
+
+// -----------------------------------------------------------------------------
+// Fin de fenêtre : persistance du point de reprise (une écriture NVS max)
+// -----------------------------------------------------------------------------
+void MqttUplink::endWindow(bool success)
+{
+    saveHighWaterMark();
+
+    if (!success) {
+        failedWindows++;
+    }
+
+    LOG_INFO(TAG, "Fenêtre terminée (%s) : %u message(s), offset %lu",
+             success ? "OK" : "échec", (unsigned)windowPublishCount, (unsigned long)highWaterMark);
+
+    lastWindowMs = millis();
+    firstWindowDone = true;
+    publishDue = false;
+    currentState = State::IDLE;
+}
+
+void MqttUplink::saveHighWaterMark()
+{
+    if (highWaterMark == savedHighWaterMark) return;
+
+    preferences.begin("mqtt", false);
+    preferences.putUInt("hwm", highWaterMark);
+    preferences.end();
+    savedHighWaterMark = highWaterMark;
+}
@@ -0,0 +1,91 @@
+// src/Connectivity/MqttUplink.h
+// Uplink télémétrie MQTT via la pile MQTT native du SIM7080G (AT+SMCONF/SMCONN/SMPUB)
+// Store-and-forward : publie le journal /datalog.csv depuis un point de reprise
+// persistant (offset octet, NVS) → reprise exacte après coupure réseau ou reboot
+// Charge utile : trame binaire RecordCodec (~10x plus compacte que le CSV)
+// Toutes les commandes passent par la file AT de CellularManager (non-bloquant)
+
+#pragma once
+#include <Arduino.h>
+#include <Preferences.h>
+#include "Storage/RecordCodec.h"
+
+class MqttUplink {
+public:
+    // Cycle de vie
+    static void init();
+    static void handle();   // Appelé par TaskManager toutes les 2s
+    static void pump();     // Publication du message dû (MQTT_UPLINK_PUMP_PERIOD_MS)
+
+    // Monitoring
+    static bool isBusy();                   // Fenêtre de connexion en cours
+    static uint32_t getHighWaterMark();     // Offset octet publié dans /datalog.csv
+    static uint32_t getPublishedCount();    // Messages publiés depuis le boot
+    static uint32_t getFailedWindows();     // Fenêtres abandonnées depuis le boot
+
+private:
+    // États de la fenêtre de connexion
+    enum class State {
+        IDLE,           // Attente prochaine fenêtre
+        CONFIGURING,    // AT+SMCONF (URL, CLIENTID, KEEPTIME, ...)
+        CONNECTING,     // AT+SMCONN
+        PUBLISHING,     // AT+SMPUB (boucle jusqu'à épuisement de l'arriéré)
+        DISCONNECTING   // AT+SMDISC
+    };
+
+    // Configuration
+    // Charge utile max par message : ~45ms d'UART à 115200 bauds (budget 100ms)
+    static constexpr size_t MAX_PAYLOAD = 512;
+    static constexpr size_t CSV_BUFFER_SIZE = 4096;   // Fenêtre de lecture du journal
+    static constexpr size_t MAX_SAMPLES = 192;        // Échantillons max par trame
+    static constexpr uint16_t MAX_PUBLISH_PER_WINDOW = 64;
+    static constexpr unsigned long TIMEOUT_SMCONF_MS = 2000;
+    static constexpr unsigned long TIMEOUT_SMCONN_MS = 20000;
+    static constexpr unsigned long TIMEOUT_SMPUB_MS  = 10000;
+    static constexpr unsigned long TIMEOUT_SMDISC_MS = 5000;
+
+    // Machine d'états
+    static State currentState;
+    static unsigned long stepStartMs;       // Début de l'étape AT courante
+    static unsigned long lastWindowMs;      // Fin de la dernière fenêtre
+    static bool firstWindowDone;            // Première fenêtre dès connexion
+    static bool stepFailed;                 // Échec dans le lot SMCONF
+    static bool publishDue;                 // Message suivant à encoder (pump)
+
+    // Point de reprise
+    static uint32_t highWaterMark;          // Offset publié (persistant)
+    static uint32_t savedHighWaterMark;     // Dernière valeur écrite en NVS
+    static size_t chunkLen;                 // Octets CSV couverts par le message en vol
+    static uint16_t windowPublishCount;
+
+    // Statistiques
+    static uint32_t publishedCount;
+    static uint32_t failedWindows;
+
+    // Charge utile du message en vol (doit rester valide jusqu'au callback)
+    static uint8_t payload[MAX_PAYLOAD];
+
+    // Tampons d'encodage (lignes CSV → échantillons → trame)
+    static char csvBuffer[CSV_BUFFER_SIZE];
+    static CodecSample samples[MAX_SAMPLES];
+    static uint16_t sampleEnd[MAX_SAMPLES]; // Fin de ligne (offset depuis le point de reprise)
+
+    // Préférences NVS
+    static Preferences preferences;
+
+    // Étapes
+    static void startWindow();
+    static void publishNext();
+    static void disconnect();
+    static void endWindow(bool success);
+    static size_t loadChunk();
+    static void saveHighWaterMark();
+    static void setState(State newState);
+
+    // Callbacks file AT
+    static void onConfigResult(bool success, const char* data);
+    static void onConfigDone(bool success, const char* data);
+    static void onConnectResult(bool success, const char* data);
+    static void onPublishResult(bool success, const char* data);
+    static void onDisconnectResult(bool success, const char* data);
+};
@@ -1,7 +1,9 @@
 // src/Connectivity/SmsManager.cpp
 #include "Connectivity/SmsManager.h"
 #include "Connectivity/CellularManager.h"
+#include "Connectivity/CellularStream.h"
 #include "Config/NetworkConfig.h"
+#include "Utils/Clock.h"
 #include "Utils/Logger.h"
 #include <TinyGsmClient.h>
 
@@ -23,6 +25,7 @@ std::vector<SmsManager::SmsItem> SmsManager::queue;
 SmsManager::State SmsManager::currentState = State::IDLE;
 int SmsManager::globalRetryCount = 0;
 unsigned long SmsManager::bootTime = 0;
+bool SmsManager::startupDelayElapsed = false;
 bool SmsManager::startupSmsSent = false;
 bool SmsManager::modemAcquired = false;
 
@@ -39,15 +42,16 @@ void SmsManager::init()
     queue.reserve(MAX_QUEUE_SIZE);
     currentState = State::IDLE;
     globalRetryCount = 0;
-    bootTime = millis();
+    bootTime = Clock::nowMs();
+    startupDelayElapsed = false;
     startupSmsSent = false;
     modemAcquired = false;
     cmgfAttempts = 0;
     cmgsAttempts = 0;
     textAttempts = 0;
     
-    Logger::info(TAG, "SmsManager initialisé");
-    Logger::debug(TAG, "Destinataires configurés: " + String(SMS_NUMBERS_COUNT));
+    LOG_INFO(TAG, "SmsManager initialisé");
+    LOG_DEBUG(TAG, "Destinataires configurés: %u", (unsigned)SMS_NUMBERS_COUNT);
 }
 
 // -----------------------------------------------------------------------------
@@ -61,7 +65,7 @@ void SmsManager::sendStartupSms()
     
     alert(message);
     startupSmsSent = true;
-    Logger::info(TAG, "SMS de bienvenue ajouté à la file");
+    LOG_INFO(TAG, "SMS de bienvenue ajouté à la file");
 }
 
 // -----------------------------------------------------------------------------
@@ -72,10 +76,10 @@ void SmsManager::restartSmsCycle()
     globalRetryCount++;
     
     if (globalRetryCount >= MAX_GLOBAL_RETRIES) {
-        Logger::error(TAG, "Abandon après " + String(MAX_GLOBAL_RETRIES) + " cycles");
+        LOG_ERROR(TAG, "Abandon après %d cycles", MAX_GLOBAL_RETRIES);
         finishCurrentSms(false);
     } else {
-        Logger::warn(TAG, "Retry cycle " + String(globalRetryCount + 1) + "/" + String(MAX_GLOBAL_RETRIES));
+        LOG_WARN(TAG, "Retry cycle %d/%d", globalRetryCount + 1, MAX_GLOBAL_RETRIES);
         currentState = State::CMGF_TRY1;
     }
 }
@@ -88,14 +92,12 @@ void SmsManager::finishCurrentSms(bool success)
     if (!queue.empty()) {
         if (success) {
             int totalAttempts = cmgfAttempts + cmgsAttempts + textAttempts;
-            Logger::info(TAG, "✅ SMS envoyé à " + queue.front().number + 
-                         " (CMGF:" + String(cmgfAttempts) + 
-                         " CMGS:" + String(cmgsAttempts) + 
-                         " TEXT:" + String(textAttempts) + 
-                         " Total:" + String(totalAttempts) + ")");
+            LOG_INFO(TAG, "✅ SMS envoyé à %s (CMGF:%d CMGS:%d TEXT:%d Total:%d)",
+                     queue.front().number.c_str(),
+                     cmgfAttempts, cmgsAttempts, textAttempts, totalAttempts);
         } else {
-            Logger::error(TAG, "❌ SMS échoué pour " + queue.front().number +
-                          " après " + String(globalRetryCount) + " cycles complets");
+            LOG_ERROR(TAG, "❌ SMS échoué pour %s après %d cycles complets",
+                      queue.front().number.c_str(), globalRetryCount);
         }
         queue.erase(queue.begin());
     }
@@ -104,7 +106,7 @@ void SmsManager::finishCurrentSms(bool success)
     if (modemAcquired) {
         CellularManager::freeModem();
         modemAcquired = false;
-        Logger::debug(TAG, "Modem libéré");
+        LOG_DEBUG(TAG, "Modem libéré");
     }
     
     // Reset machine d'états et compteurs
@@ -121,14 +123,19 @@ void SmsManager::finishCurrentSms(bool success)
 void SmsManager::handle()
 {
     // Attendre 60s après le boot
-    if ((millis() - bootTime) < STARTUP_DELAY_MS) {
-        return;
+    // Verrouillé une fois écoulé : sinon la fenêtre se rouvrirait à chaque
+    // débordement de millis() (tous les 49,7 jours)
+    if (!startupDelayElapsed) {
+        if ((Clock::nowMs() - bootTime) < STARTUP_DELAY_MS) {
+            return;
+        }
+        startupDelayElapsed = true;
     }
     
     // Envoyer SMS de bienvenue (une seule fois)
     if (!startupSmsSent && CellularManager::isConnected()) {
         if (DEBUG_SKIP_STARTUP_SMS) {
-            Logger::info(TAG, "⚠️ DEBUG: SMS de démarrage désactivé");
+            LOG_INFO(TAG, "⚠️ DEBUG: SMS de démarrage désactivé");
             startupSmsSent = true;
         } else {
             sendStartupSms();
@@ -146,19 +153,23 @@ void SmsManager::handle()
             return;  // Modem pas disponible, attendre
         }
         modemAcquired = true;
-        Logger::debug(TAG, "Modem acquis pour envoi SMS");
+        LOG_DEBUG(TAG, "Modem acquis pour envoi SMS");
     }
     
     TinyGsm& modem = getModem();
     
+    // Réponses tardives du cycle précédent (OK après timeout, URC) :
+    // waitResponse() ne doit lire que la réponse à la commande de ce cycle
+    CellularStream::instance().discardRx();
+    
     switch (currentState) {
         
         // -----------------------------------------------------------------
         // IDLE - Démarrage envoi
         // -----------------------------------------------------------------
         case State::IDLE:
-            Logger::info(TAG, "Début envoi SMS à " + queue.front().number);
-            Logger::debug(TAG, "Message: " + queue.front().message);
+            LOG_INFO(TAG, "Début envoi SMS à %s", queue.front().number.c_str());
+            LOG_DEBUG(TAG, "Message: %s", queue.front().message.c_str());
             currentState = State::CMGF_TRY1;
             globalRetryCount = 0;
             cmgfAttempts = 0;
@@ -172,15 +183,15 @@ void SmsManager::handle()
         case State::CMGF_TRY1:
             {
                 cmgfAttempts++;
-                Logger::debug(TAG, "AT+CMGF=1 (essai " + String(cmgfAttempts) + ")");
+                LOG_DEBUG(TAG, "AT+CMGF=1 (essai %d)", cmgfAttempts);
                 modem.sendAT("+CMGF=1");
                 int result = modem.waitResponse(TIMEOUT_SHORT);
                 
                 if (result == 1) {
-                    Logger::debug(TAG, "Mode texte OK");
+                    LOG_DEBUG(TAG, "Mode texte OK");
                     currentState = State::CMGS_TRY1;
                 } else {
-                    Logger::debug(TAG, "CMGF timeout, retry prochain cycle");
+                    LOG_DEBUG(TAG, "CMGF timeout, retry prochain cycle");
                     currentState = State::CMGF_TRY2;
                 }
             }
@@ -192,15 +203,15 @@ void SmsManager::handle()
         case State::CMGF_TRY2:
             {
                 cmgfAttempts++;
-                Logger::debug(TAG, "AT+CMGF=1 (essai " + String(cmgfAttempts) + ")");
+                LOG_DEBUG(TAG, "AT+CMGF=1 (essai %d)", cmgfAttempts);
                 modem.sendAT("+CMGF=1");
                 int result = modem.waitResponse(TIMEOUT_SHORT);
                 
                 if (result == 1) {
-                    Logger::debug(TAG, "Mode texte OK");
+                    LOG_DEBUG(TAG, "Mode texte OK");
                     currentState = State::CMGS_TRY1;
                 } else {
-                    Logger::warn(TAG, "CMGF échec après " + String(cmgfAttempts) + " essais");
+                    LOG_WARN(TAG, "CMGF échec après %d essais", cmgfAttempts);
                     restartSmsCycle();
                 }
             }
@@ -212,15 +223,15 @@ void SmsManager::handle()
         case State::CMGS_TRY1:
             {
                 cmgsAttempts++;
-                Logger::debug(TAG, "AT+CMGS (essai " + String(cmgsAttempts) + ")");
+                LOG_DEBUG(TAG, "AT+CMGS (essai %d)", cmgsAttempts);
                 modem.sendAT("+CMGS=\"", queue.front().number.c_str(), "\"");
                 int result = modem.waitResponse(TIMEOUT_SHORT, ">");
                 
                 if (result == 1) {
-                    Logger::debug(TAG, "Prompt > reçu");
+                    LOG_DEBUG(TAG, "Prompt > reçu");
                     currentState = State::TEXT;
                 } else {
-                    Logger::debug(TAG, "CMGS timeout, retry prochain cycle");
+                    LOG_DEBUG(TAG, "CMGS timeout, retry prochain cycle");
                     currentState = State::CMGS_TRY2;
                 }
             }
@@ -232,15 +243,15 @@ void SmsManager::handle()
         case State::CMGS_TRY2:
             {
                 cmgsAttempts++;
-                Logger::debug(TAG, "AT+CMGS (essai " + String(cmgsAttempts) + ")");
+                LOG_DEBUG(TAG, "AT+CMGS (essai %d)", cmgsAttempts);
                 modem.sendAT("+CMGS=\"", queue.front().number.c_str(), "\"");
                 int result = modem.waitResponse(TIMEOUT_SHORT, ">");
                 
                 if (result == 1) {
-                    Logger::debug(TAG, "Prompt > reçu");
+                    LOG_DEBUG(TAG, "Prompt > reçu");
                     currentState = State::TEXT;
                 } else {
-                    Logger::warn(TAG, "CMGS échec après " + String(cmgsAttempts) + " essais");
+                    LOG_WARN(TAG, "CMGS échec après %d essais", cmgsAttempts);
                     restartSmsCycle();
                 }
             }
@@ -252,16 +263,16 @@ void SmsManager::handle()
         case State::TEXT:
             {
                 textAttempts++;
-                Logger::debug(TAG, "Envoi texte + Ctrl+Z (essai " + String(textAttempts) + ")");
-                Serial1.print(queue.front().message);
-                Serial1.write(26);  // Ctrl+Z
+                LOG_DEBUG(TAG, "Envoi texte + Ctrl+Z (essai %d)", textAttempts);
+                CellularStream::instance().print(queue.front().message);
+                CellularStream::instance().write(26);  // Ctrl+Z
                 
                 int result = modem.waitResponse(TIMEOUT_TEXT, "+CMGS:");
                 
                 if (result == 1) {
                     finishCurrentSms(true);
                 } else {
-                    Logger::warn(TAG, "TEXT timeout (essai " + String(textAttempts) + ")");
+                    LOG_WARN(TAG, "TEXT timeout (essai %d)", textAttempts);
                     restartSmsCycle();
                 }
             }
@@ -293,7 +304,7 @@ void SmsManager::alert(const String& message)
 void SmsManager::send(const char* number, const String& message)
 {
     if (queue.size() >= MAX_QUEUE_SIZE) {
-        Logger::warn(TAG, "File pleine, suppression du plus ancien");
+        LOG_WARN(TAG, "File pleine, suppression du plus ancien");
         queue.erase(queue.begin());
     }
     
@@ -302,7 +313,7 @@ void SmsManager::send(const char* number, const String& message)
     item.message = message;
     queue.push_back(item);
     
-    Logger::debug(TAG, "SMS en file pour " + item.number + " (" + String(queue.size()) + " en attente)");
+    LOG_DEBUG(TAG, "SMS en file pour %s (%u en attente)", item.number.c_str(), (unsigned)queue.size());
 }
 
 // -----------------------------------------------------------------------------
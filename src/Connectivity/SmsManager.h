@@ -50,6 +50,7 @@ private:
     static State currentState;
     static int globalRetryCount;        // Compteur de cycles complets
     static unsigned long bootTime;      // Timestamp du boot
+    static bool startupDelayElapsed;    // Verrou : délai de boot écoulé (insensible au débordement de millis)
     static bool startupSmsSent;         // SMS de bienvenue envoyé
     static bool modemAcquired;          // Ticket modem obtenu
     
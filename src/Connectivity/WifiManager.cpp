@@ -1,7 +1,7 @@
 // src/Connectivity/WiFiManager.cpp
 
 #include <Arduino.h>
-#include "Connectivity/WiFiManager.h"
+#include "Connectivity/WifiManager.h"
 #include <WiFi.h>
 #include "Config/NetworkConfig.h"
 #include "Utils/Logger.h"
@@ -117,6 +117,7 @@ void WiFiManager::applyPendingRequests()
         preferences.putBool("sta", staChangeValue);
         preferences.end();
 
+        Logger::flush();
         delay(100);  // Laisser le temps au flash d'écrire
         ESP.restart();
         // Ne revient jamais ici
@@ -159,7 +160,7 @@ void WiFiManager::handle()
         bool ok = WiFi.softAPConfig(WIFI_AP_IP, WIFI_AP_GATEWAY, WIFI_AP_SUBNET);
 
         if (!ok) {
-            Logger::error("WiFi", "softAPConfig() ERREUR");
+            LOG_ERROR("WiFi", "softAPConfig() ERREUR");
         }
 
         changeState(State::AP_START);
@@ -180,7 +181,7 @@ void WiFiManager::handle()
             Logger::info("WiFi", "AP démarré — IP: " + WiFi.softAPIP().toString()
                          + " (" + String(dt) + "ms)");
         } else {
-            Logger::error("WiFi", "softAP() ERREUR — AP non disponible (" + String(dt) + "ms)");
+            LOG_ERROR("WiFi", "softAP() ERREUR — AP non disponible (%lums)", (unsigned long)dt);
         }
 
         // Aiguillage : STA activé ou pas ?
@@ -1,4 +1,4 @@
-// src/Connectivity/WiFiManager.h
+// src/Connectivity/WifiManager.h
 #pragma once
 
 #include <Arduino.h>
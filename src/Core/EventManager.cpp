@@ -4,7 +4,7 @@
 
 #include "Core/TaskManagerMonitor.h"
 #include "Core/PowerManager.h"
-#include "Connectivity/WiFiManager.h"
+#include "Connectivity/WifiManager.h"
 #include <WiFi.h>
 
 // -----------------------------------------------------------------------------
@@ -59,7 +59,7 @@ void PowerManager::init()
         
         update(); // Initialisation immédiate de l'état
     } else {
-        Logger::error(TAG, "PMU AXP2101 non détecté");
+        LOG_ERROR(TAG, "PMU AXP2101 non détecté");
     }
 }
 // -----------------------------------------------------------------------------
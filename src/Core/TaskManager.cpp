@@ -1,4 +1,5 @@
 #include "Core/TaskManager.h"
+#include "Utils/Clock.h"
 
 // Stockage interne des tâches
 static std::vector<TaskManager::Task> tasks;
@@ -8,7 +9,7 @@ void TaskManager::init() {
 }
 
 void TaskManager::handle() {
-    unsigned long now = millis();
+    unsigned long now = Clock::nowMs();
     for (auto& t : tasks) {
         if (now - t.lastRunMs >= t.intervalMs) {
             t.callback();
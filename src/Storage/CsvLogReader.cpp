@@ -0,0 +1,143 @@
+// Storage/CsvLogReader.cpp
+#include "Storage/CsvLogReader.h"
+#include "Utils/Logger.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static const char* TAG = "CsvLogReader";
+
+// -----------------------------------------------------------------------------
+// Parcours du fichier
+// Le tampon est alloué une fois par parcours (appelé depuis la boucle
+// principale et depuis la tâche du serveur web : pas de tampon statique partagé)
+// -----------------------------------------------------------------------------
+uint32_t CsvLogReader::forEach(File& file, RecordCallback cb, void* ctx,
+                               uint32_t* completeBytes)
+{
+    char* buffer = (char*)malloc(BUFFER_SIZE);
+    if (!buffer) {
+        LOG_ERROR(TAG, "Allocation tampon de lecture impossible");
+        return 0;
+    }
+
+    uint32_t records = 0;
+    uint32_t consumed = 0;      // Octets de lignes complètes traitées
+    size_t fill = 0;            // Octets valides dans le tampon
+    bool eof = false;
+    bool skipping = false;      // Fin d'une ligne trop longue à ignorer
+    bool stopped = false;
+
+    while (!eof && !stopped) {
+        // Compléter le tampon (1 octet réservé pour le '\0' final)
+        size_t n = file.read((uint8_t*)buffer + fill, BUFFER_SIZE - 1 - fill);
+        if (n == 0) eof = true;
+        fill += n;
+
+        char* p = buffer;
+        char* end = buffer + fill;
+
+        while (p < end) {
+            char* lineStart = p;
+            char* nl = (char*)memchr(p, '\n', end - p);
+            if (!nl) {
+                if (!eof || completeBytes) break;
+                nl = end;       // Dernière ligne sans '\n'
+            }
+            *nl = '\0';
+
+            if (skipping) {
+                skipping = false;
+            } else if (nl > p) {
+                CsvRecord rec;
+                if (parseLine(p, rec)) {
+                    records++;
+                    stopped = !cb(rec, ctx);
+                }
+            }
+            p = (nl < end) ? nl + 1 : end;
+            consumed += p - lineStart;
+            if (stopped) break;
+        }
+
+        // Reste (ligne incomplète) ramené en tête de tampon
+        size_t rest = end - p;
+        if (rest == BUFFER_SIZE - 1) {
+            LOG_WARN(TAG, "Ligne de plus de %u octets ignorée", (unsigned)(BUFFER_SIZE - 1));
+            skipping = true;
+            consumed += rest;
+            rest = 0;
+        }
+        if (rest > 0 && p != buffer) {
+            memmove(buffer, p, rest);
+        }
+        fill = rest;
+    }
+
+    free(buffer);
+    if (completeBytes) *completeBytes = consumed;
+    return records;
+}
+
+// -----------------------------------------------------------------------------
+// Parse une ligne CSV : timestamp,type,id,valueType,value
+// Texte dé-échappé en place ("a ""b""" → a "b") : out.text pointe dans line
+// -----------------------------------------------------------------------------
+bool CsvLogReader::parseLine(char* line, CsvRecord& out)
+{
+    // Lignes de contrôle (trailer de bloc "#B,...") : pas des enregistrements
+    if (*line == '#') return false;
+
+    char* p = line;
+    char* end;
+
+    out.timestamp = strtoul(p, &end, 10);
+    if (end == p || *end != ',') return false;
+    p = end + 1;
+
+    out.type = (uint8_t)strtoul(p, &end, 10);
+    if (end == p || *end != ',') return false;
+    p = end + 1;
+
+    out.id = (uint8_t)strtoul(p, &end, 10);
+    if (end == p || *end != ',') return false;
+    p = end + 1;
+
+    unsigned long valueType = strtoul(p, &end, 10);
+    if (end == p || *end != ',') return false;
+    p = end + 1;
+
+    if (valueType == 0) {
+        out.isText = false;
+        out.value = strtof(p, &end);
+        return end != p;
+    }
+
+    // Texte sans guillemets (anciens fichiers) : pris tel quel
+    if (*p != '"') {
+        out.isText = true;
+        out.text = p;
+        out.textLen = (uint16_t)strlen(p);
+        return true;
+    }
+
+    // Texte entre guillemets
+    char* src = p + 1;
+    char* dst = p;
+    while (*src) {
+        if (*src == '"') {
+            if (src[1] == '"') {
+                *dst++ = '"';
+                src += 2;
+                continue;
+            }
+            break;  // Guillemet fermant
+        }
+        *dst++ = *src++;
+    }
+    *dst = '\0';
+    out.isText = true;
+    out.text = p;
+    out.textLen = (uint16_t)(dst - p);
+    return true;
+}
@@ -0,0 +1,51 @@
+// Storage/CsvLogReader.h
+// Lecture en flux du journal CSV (/datalog.csv) sans allocation par ligne
+//
+// - Tampon fixe de 4 Ko rempli par file.read, découpage des lignes par memchr
+// - Champs convertis en place (strtoul / strtof), texte dé-échappé en place
+// - Enregistrements remis à un callback : une seule boucle de parsing pour
+//   DataLogger (reconstruction web, dernière valeur, graphe) et MqttUplink
+//
+// Format de ligne : timestamp,type,id,valueType,value
+//   valueType = 0 : value numérique (%.3f)
+//   valueType = 1 : value texte entre guillemets, guillemets internes doublés
+// Lignes commençant par '#' (trailer de bloc DataLogger) : ignorées
+
+#pragma once
+#include <Arduino.h>
+#include <FS.h>
+
+// ─────────────────────────────────────────────
+// Enregistrement parsé (vue sur le tampon de lecture)
+// ─────────────────────────────────────────────
+// text : non possédé, terminé par '\0', valide uniquement pendant le callback
+// ─────────────────────────────────────────────
+
+struct CsvRecord {
+    uint32_t    timestamp = 0;
+    uint8_t     type      = 0;      // DataType
+    uint8_t     id        = 0;      // DataId
+    bool        isText    = false;
+    float       value     = 0.0f;   // valueType 0
+    const char* text      = nullptr;// valueType 1
+    uint16_t    textLen   = 0;
+};
+
+class CsvLogReader {
+public:
+    static constexpr size_t BUFFER_SIZE = 4096;   // Ligne max : BUFFER_SIZE - 1
+
+    // Callback par enregistrement valide : retourner false pour arrêter la lecture
+    typedef bool (*RecordCallback)(const CsvRecord& rec, void* ctx);
+
+    // Parcourt le fichier de la position courante à la fin (lignes mal formées
+    // ou trop longues ignorées). Retourne le nombre d'enregistrements remis au callback
+    // completeBytes (optionnel) : reçoit le nombre d'octets de lignes complètes
+    // lues ; une dernière ligne sans '\n' (écriture en cours) n'est alors pas
+    // traitée, pour reprise ultérieure à cet offset (lecture incrémentale)
+    static uint32_t forEach(File& file, RecordCallback cb, void* ctx,
+                            uint32_t* completeBytes = nullptr);
+
+    // Parse une ligne terminée par '\0' (sans '\n'), modifiée en place
+    static bool parseLine(char* line, CsvRecord& out);
+};
@@ -1,8 +1,12 @@
 // Storage/DataLogger.cpp
 #include "Storage/DataLogger.h"
-#include "Connectivity/ManagerUTC.h"
+#include "Storage/CsvLogReader.h"
+#include "Storage/FileSystem.h"
+#include "Storage/GraphCache.h"
+#include "Utils/Clock.h"
+#include "Utils/Logger.h"
 
-#include <SPIFFS.h>
+#include <esp_rom_crc.h>
 #include <time.h>
 
 // -----------------------------------------------------------------------------
@@ -18,72 +22,163 @@ size_t DataLogger::pendingHead  = 0;   // index du plus ancien
 size_t DataLogger::pendingCount = 0;   // nombre d'éléments valides
 
 std::map<DataId, LastDataForWeb> DataLogger::lastDataForWeb;
+DataLogger::ChangeCallback DataLogger::changeCallback = nullptr;
+volatile uint32_t DataLogger::dataVersion = 0;
+DataLoggerPerf DataLogger::perf;
+
+static const char* TAG = "DataLogger";
 
 static unsigned long lastFlushMs = 0;
+static bool overflowReported = false;   // Un avertissement par épisode de saturation
+static uint32_t blockSeq = 0;           // Numéro du prochain bloc écrit
+
+// Fin de fichier déchirée que la troncature n'a pas pu retirer : plus aucun
+// ajout tant que le fichier n'est pas ramené à cleanSize (sinon le bloc
+// suivant se collerait aux octets déchirés, au milieu du fichier)
+static bool   tailDirty = false;
+static size_t cleanSize = 0;            // Fin du dernier bloc valide
 
 // -----------------------------------------------------------------------------
-// Helpers CSV - Échappement et parsing
+// Helpers CSV (lecture : voir CsvLogReader, écriture : PageWriter)
 // -----------------------------------------------------------------------------
 
-// Échappe une String pour CSV : ajoute guillemets et double les guillemets internes
-static String escapeCSV(const String& text)
+// Copie la valeur d'un enregistrement CSV dans un variant
+// (texte : réutilise la String déjà présente pour éviter une réallocation)
+static void assignValue(std::variant<float, String>& dst, const CsvRecord& rec)
 {
-    String escaped = "\"";  // Commence avec un guillemet
-    
-    for (size_t i = 0; i < text.length(); i++) {
-        char c = text.charAt(i);
-        if (c == '"') {
-            escaped += "\"\"";  // Double les guillemets
-        } else {
-            escaped += c;
-        }
+    if (!rec.isText) {
+        dst = rec.value;
+    } else if (std::holds_alternative<String>(dst)) {
+        std::get<String>(dst) = rec.text;
+    } else {
+        dst = String(rec.text);
     }
-    
-    escaped += "\"";  // Termine avec un guillemet
-    return escaped;
 }
 
-// Parse une String CSV (entre guillemets) et dé-échappe
-// Entrée: "texte" ou "texte ""quoted""" 
-// Sortie: texte ou texte "quoted"
-static String unescapeCSV(const String& text)
-{
-    String unescaped = "";
-    
-    // Vérifier que la String commence et finit par des guillemets
-    if (text.length() < 2 || text.charAt(0) != '"' || text.charAt(text.length() - 1) != '"') {
-        // Pas de guillemets = format invalide, retourner tel quel
-        Serial.println("[DataLogger] Warning: CSV String sans guillemets: " + text);
-        return text;
+// -----------------------------------------------------------------------------
+// Écriture par pages flash
+// Les lignes sont accumulées dans un tampon de FLASH_PAGE_SIZE octets aligné
+// sur l'offset du fichier : le premier write complète la page en cours, les
+// suivants sont des pages entières, le dernier est la page partielle finale
+// → 1 à N/256 + 2 écritures par flush au lieu d'une par enregistrement
+//
+// Chaque flush forme un bloc terminé par "#B,<seq>,<longueur>,<crc32>\n"
+// (CRC32 ROM sur les octets du bloc) : au boot, recoverTail() retrouve le
+// dernier bloc valide en remontant depuis la fin et tronque une écriture
+// interrompue. Les lecteurs ignorent les lignes commençant par '#'
+// -----------------------------------------------------------------------------
+static constexpr size_t FLASH_PAGE_SIZE   = 256;
+static constexpr size_t FLASH_SECTOR_SIZE = 4096;
+
+static char staging[FLASH_PAGE_SIZE];
+
+class PageWriter {
+public:
+    PageWriter(File& file, DataLoggerPerf& perf)
+        : file(file), perf(perf), offset(file.size()), len(0), ok(true)
+    {
+        limit = FLASH_PAGE_SIZE - (offset % FLASH_PAGE_SIZE);
     }
-    
-    // Parser le contenu entre les guillemets
-    for (size_t i = 1; i < text.length() - 1; i++) {
-        char c = text.charAt(i);
-        if (c == '"') {
-            // Vérifier si c'est un guillemet doublé
-            if (i + 1 < text.length() - 1 && text.charAt(i + 1) == '"') {
-                unescaped += '"';  // Ajouter un seul guillemet
-                i++;  // Sauter le deuxième guillemet
-            } else {
-                // Guillemet seul = erreur de format
-                Serial.println("[DataLogger] Warning: Guillemet non échappé dans CSV");
-                unescaped += c;
-            }
-        } else {
-            unescaped += c;
+
+    void put(char c)
+    {
+        if (crcEnabled) {
+            crc = esp_rom_crc32_le(crc, (const uint8_t*)&c, 1);
+            blockLen++;
+        }
+        staging[len++] = c;
+        if (len == limit) writeStaged();
+    }
+
+    void put(const char* p, size_t n)
+    {
+        if (crcEnabled) {
+            crc = esp_rom_crc32_le(crc, (const uint8_t*)p, n);
+            blockLen += n;
+        }
+        while (n > 0) {
+            size_t k = min(n, limit - len);
+            memcpy(staging + len, p, k);
+            len += k;
+            p += k;
+            n -= k;
+            if (len == limit) writeStaged();
         }
     }
-    
-    return unescaped;
-}
+
+    // Texte entre guillemets, guillemets internes doublés
+    void putQuoted(const String& text)
+    {
+        put('"');
+        for (size_t i = 0; i < text.length(); i++) {
+            char c = text.charAt(i);
+            if (c == '"') put('"');
+            put(c);
+        }
+        put('"');
+    }
+
+    // Clôt le bloc : ligne "#B,<seq>,<longueur>,<crc32>\n" (hors CRC)
+    void putTrailer(uint32_t seq)
+    {
+        char trailer[40];
+        int n = snprintf(trailer, sizeof(trailer), "#B,%lu,%u,%08lx\n",
+                         (unsigned long)seq, (unsigned)blockLen, (unsigned long)crc);
+        crcEnabled = false;
+        put(trailer, n);
+    }
+
+    // Page partielle finale
+    bool finish()
+    {
+        if (len > 0) writeStaged();
+        return ok;
+    }
+
+    size_t written() const { return written_; }
+
+private:
+    void writeStaged()
+    {
+        if (ok && file.write((const uint8_t*)staging, len) != len) {
+            ok = false;
+        }
+
+        // Estimation des effacements : chaque secteur 4 Ko entamé
+        if ((offset % FLASH_SECTOR_SIZE) == 0 ||
+            (offset / FLASH_SECTOR_SIZE) != ((offset + len - 1) / FLASH_SECTOR_SIZE)) {
+            perf.sectorsStarted++;
+        }
+
+        if (len == FLASH_PAGE_SIZE) perf.fullPageWrites++;
+        else                        perf.partialPageWrites++;
+
+        offset += len;
+        written_ += len;
+        len = 0;
+        limit = FLASH_PAGE_SIZE;
+    }
+
+    File& file;
+    DataLoggerPerf& perf;
+    size_t offset;      // Offset fichier du début du tampon
+    size_t len;
+    size_t limit;       // Fin de la page courante dans le tampon
+    size_t written_ = 0;
+    bool ok;
+
+    // Bloc (enregistrements du flush, trailer exclu)
+    bool crcEnabled = true;
+    uint32_t crc = 0;
+    size_t blockLen = 0;
+};
 
 // -----------------------------------------------------------------------------
 // Temps
 // -----------------------------------------------------------------------------
 uint32_t DataLogger::nowRelative()
 {
-    return millis();
+    return Clock::nowMs();
 }
 
 // -----------------------------------------------------------------------------
@@ -91,17 +186,21 @@ uint32_t DataLogger::nowRelative()
 // -----------------------------------------------------------------------------
 void DataLogger::init()
 {
-    lastFlushMs = millis();
+    lastFlushMs = Clock::nowMs();
 
     pendingHead  = 0;
     pendingCount = 0;
+    tailDirty    = false;
+
+    // Fin de fichier interrompue (coupure pendant un flush) : tronquée
+    recoverTail();
 
     // Reconstruction LastDataForWeb depuis la flash
     // LECTURE UNIQUE du fichier CSV : on parcourt toutes les lignes
     // et on garde la dernière valeur rencontrée pour chaque DataId.
     // (Avant : 1 lecture complète par DataId = 22 lectures → ~60s sur SPIFFS)
 
-    File file = SPIFFS.open("/datalog.csv", FILE_READ);
+    File file = FileSystem::fs().open("/datalog.csv", FILE_READ);
     if (!file) {
         // Fichier n'existe pas — normal au premier boot
         return;
@@ -111,47 +210,23 @@ void DataLogger::init()
     struct LastSeen {
         bool found = false;
         uint32_t timestamp = 0;
-        DataType type = DataType::System;
         std::variant<float, String> value;
     };
     LastSeen lastSeen[(int)DataId::Count];
 
-    while (file.available()) {
-        String line = file.readStringUntil('\n');
-        if (line.length() == 0) continue;
-
-        // Parser la ligne : timestamp,type,id,valueType,value
-        int firstComma = line.indexOf(',');
-        int secondComma = line.indexOf(',', firstComma + 1);
-        int thirdComma = line.indexOf(',', secondComma + 1);
-        int fourthComma = line.indexOf(',', thirdComma + 1);
+    uint32_t scanStartUs = micros();
+    uint32_t records = CsvLogReader::forEach(file, [](const CsvRecord& rec, void* ctx) {
+        if (rec.id >= (uint8_t)DataId::Count) return true;  // Id hors limites
 
-        if (firstComma == -1 || secondComma == -1 || thirdComma == -1 || fourthComma == -1) {
-            continue;  // Ligne mal formatée, ignorer
-        }
-
-        unsigned long ts = line.substring(0, firstComma).toInt();
-        uint8_t typeByte = line.substring(firstComma + 1, secondComma).toInt();
-        uint8_t idByte = line.substring(secondComma + 1, thirdComma).toInt();
-        uint8_t valueType = line.substring(thirdComma + 1, fourthComma).toInt();
-        String valueStr = line.substring(fourthComma + 1);
-
-        if (idByte >= (uint8_t)DataId::Count) continue;  // Id hors limites
-
-        LastSeen& ls = lastSeen[idByte];
+        LastSeen& ls = static_cast<LastSeen*>(ctx)[rec.id];
         ls.found = true;
-        ls.timestamp = ts;
-        ls.type = static_cast<DataType>(typeByte);
-
-        if (valueType == 0) {
-            ls.value = valueStr.toFloat();
-        } else {
-            valueStr.trim();
-            ls.value = unescapeCSV(valueStr);
-        }
-    }
+        ls.timestamp = rec.timestamp;
+        assignValue(ls.value, rec);
+        return true;
+    }, lastSeen);
 
     file.close();
+    perf.scan.record(micros() - scanStartUs, records);
 
     // Peupler lastDataForWeb depuis la table temporaire
     for (int id = 0; id < (int)DataId::Count; ++id) {
@@ -166,14 +241,128 @@ void DataLogger::init()
     }
 }
 
+// -----------------------------------------------------------------------------
+// Récupération après coupure : O(un bloc)
+// Remonte depuis la fin jusqu'au dernier trailer "#B," complet dont le CRC
+// est valide, puis tronque tout ce qui suit (bloc interrompu)
+// Fichier sans trailer dans la fenêtre (ancien format) : tronqué à la
+// dernière ligne complète
+// -----------------------------------------------------------------------------
+static uint32_t crcRange(File& file, size_t start, size_t len)
+{
+    uint8_t buf[256];
+    uint32_t crc = 0;
+    file.seek(start);
+    while (len > 0) {
+        size_t n = file.read(buf, min(len, sizeof(buf)));
+        if (n == 0) break;
+        crc = esp_rom_crc32_le(crc, buf, n);
+        len -= n;
+    }
+    return crc;
+}
+
+void DataLogger::recoverTail()
+{
+    File file = FileSystem::fs().open("/datalog.csv", FILE_READ);
+    if (!file) return;
+
+    size_t size = file.size();
+    if (size == 0) {
+        file.close();
+        return;
+    }
+
+    // Fenêtre de fin : bloc interrompu + trailer du bloc précédent
+    size_t windowLen = min(size, RECOVERY_WINDOW);
+    size_t windowStart = size - windowLen;
+    char* window = (char*)malloc(windowLen + 1);
+    if (!window) {
+        file.close();
+        return;
+    }
+    file.seek(windowStart);
+    windowLen = file.read((uint8_t*)window, windowLen);
+    window[windowLen] = '\0';
+
+    size_t validEnd = 0;        // Offset fichier de fin du dernier bloc valide
+    bool found = false;
+
+    // Trailers candidats, du plus récent au plus ancien
+    for (size_t i = windowLen; i-- > 0 && !found; ) {
+        if (window[i] != '#') continue;
+        if (i > 0 && window[i - 1] != '\n') continue;
+        if (i == 0 && windowStart > 0) continue;    // Début de ligne inconnu
+
+        char* lineEnd = (char*)memchr(window + i, '\n', windowLen - i);
+        if (!lineEnd) continue;                     // Trailer lui-même interrompu
+
+        unsigned long seq, crc;
+        unsigned len;
+        if (sscanf(window + i, "#B,%lu,%u,%lx", &seq, &len, &crc) != 3) continue;
+
+        size_t trailerStart = windowStart + i;
+        if (len > trailerStart) continue;
+        if (crcRange(file, trailerStart - len, len) != (uint32_t)crc) {
+            LOG_WARN(TAG, "Bloc %lu corrompu (CRC), recherche du précédent", seq);
+            continue;
+        }
+
+        validEnd = windowStart + (lineEnd - window) + 1;
+        blockSeq = seq + 1;
+        found = true;
+    }
+
+    if (!found) {
+        // Ancien format (sans trailer) : dernière ligne complète
+        char* lastNl = nullptr;
+        for (size_t i = windowLen; i-- > 0; ) {
+            if (window[i] == '\n') {
+                lastNl = window + i;
+                break;
+            }
+        }
+        validEnd = lastNl ? windowStart + (lastNl - window) + 1 : windowStart;
+    }
+
+    free(window);
+    file.close();
+
+    if (validEnd < size) {
+        LOG_WARN(TAG, "Fin de /datalog.csv interrompue : %u octets tronqués",
+                 (unsigned)(size - validEnd));
+        perf.recoveredBytes = size - validEnd;
+        if (!FileSystem::truncate("/datalog.csv", validEnd)) {
+            tailDirty = true;
+            cleanSize = validEnd;
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Réparation de la fin de fichier avant tout nouvel ajout
+// Retente la troncature à cleanSize ; en cas d'échec les enregistrements
+// restent en PENDING et le prochain flush réessaie
+// -----------------------------------------------------------------------------
+bool DataLogger::repairTail()
+{
+    if (!tailDirty) return true;
+    if (!FileSystem::truncate("/datalog.csv", cleanSize)) return false;
+
+    tailDirty = false;
+    dataVersion++;      // Lignes retirées peut-être déjà lues (GraphCache, MqttUplink)
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 // PUSH — point d'entrée pour valeurs NUMÉRIQUES (float)
 // -----------------------------------------------------------------------------
 void DataLogger::push(DataType type, DataId id, float value)
 {
+    uint32_t startUs = micros();
     uint32_t relNow = nowRelative();
-    bool utcValid   = ManagerUTC::isUtcValid();
-    uint32_t utcNow = utcValid ? ManagerUTC::nowUtc() : 0;
+    bool utcValid   = Clock::isUtcValid();
+    uint32_t utcNow = utcValid ? Clock::nowUtc() : 0;
 
     // LIVE (toujours relatif)
     DataRecord liveRec;
@@ -194,16 +383,9 @@ void DataLogger::push(DataType type, DataId id, float value)
     addPending(pendRec);
 
     // Vue Web
-    LastDataForWeb& w = lastDataForWeb[id];
-    w.value = value;  // std::variant accepte float
+    updateWeb(id, value, utcValid, utcNow, relNow);
 
-    if (utcValid) {
-        w.t_utc     = utcNow;
-        w.utc_valid = true;
-    } else {
-        w.t_rel_ms  = relNow;
-        w.utc_valid = false;
-    }
+    perf.push.record(micros() - startUs);
 }
 
 // -----------------------------------------------------------------------------
@@ -211,9 +393,10 @@ void DataLogger::push(DataType type, DataId id, float value)
 // -----------------------------------------------------------------------------
 void DataLogger::push(DataType type, DataId id, const String& textValue)
 {
+    uint32_t startUs = micros();
     uint32_t relNow = nowRelative();
-    bool utcValid   = ManagerUTC::isUtcValid();
-    uint32_t utcNow = utcValid ? ManagerUTC::nowUtc() : 0;
+    bool utcValid   = Clock::isUtcValid();
+    uint32_t utcNow = utcValid ? Clock::nowUtc() : 0;
 
     // LIVE (toujours relatif)
     DataRecord liveRec;
@@ -234,8 +417,27 @@ void DataLogger::push(DataType type, DataId id, const String& textValue)
     addPending(pendRec);
 
     // Vue Web - stocke le String dans le variant
-    LastDataForWeb& w = lastDataForWeb[id];
-    w.value = textValue;  // std::variant accepte String
+    updateWeb(id, textValue, utcValid, utcNow, relNow);
+
+    perf.push.record(micros() - startUs);
+}
+
+// -----------------------------------------------------------------------------
+// Vue Web + notification des seuls changements de valeur
+// -----------------------------------------------------------------------------
+void DataLogger::setChangeCallback(ChangeCallback cb)
+{
+    changeCallback = cb;
+}
+
+void DataLogger::updateWeb(DataId id, const std::variant<float, String>& value,
+                           bool utcValid, uint32_t utcNow, uint32_t relNow)
+{
+    auto it = lastDataForWeb.find(id);
+    bool changed = (it == lastDataForWeb.end()) || !(it->second.value == value);
+
+    LastDataForWeb& w = (it != lastDataForWeb.end()) ? it->second : lastDataForWeb[id];
+    w.value = value;
 
     if (utcValid) {
         w.t_utc     = utcNow;
@@ -244,6 +446,10 @@ void DataLogger::push(DataType type, DataId id, const String& textValue)
         w.t_rel_ms  = relNow;
         w.utc_valid = false;
     }
+
+    if (changed && changeCallback) {
+        changeCallback(id, w);
+    }
 }
 
 // -----------------------------------------------------------------------------
@@ -264,6 +470,13 @@ void DataLogger::addPending(const DataRecord& r)
     if (pendingCount == PENDING_SIZE) {
         pendingHead = (pendingHead + 1) % PENDING_SIZE;
         pendingCount--;
+
+        perf.pendingDropped++;
+        if (!overflowReported) {
+            overflowReported = true;
+            LOG_WARN(TAG, "PENDING plein (%u) : perte des plus anciens enregistrements (UTC %s)",
+                     (unsigned)PENDING_SIZE, Clock::isUtcValid() ? "valide" : "invalide");
+        }
     }
 
     size_t index =
@@ -279,12 +492,12 @@ void DataLogger::addPending(const DataRecord& r)
 void DataLogger::handle()
 {
     // Réparation UTC si NTP devenu valide
-    if (ManagerUTC::isUtcValid()) {
+    if (Clock::isUtcValid()) {
         for (size_t i = 0; i < pendingCount; ++i) {
             size_t idx = (pendingHead + i) % PENDING_SIZE;
             if (pending[idx].timeBase == TimeBase::Relative) {
                 pending[idx].timestamp =
-                    ManagerUTC::convertFromRelative(pending[idx].timestamp);
+                    Clock::utcFromRelative(pending[idx].timestamp);
                 pending[idx].timeBase = TimeBase::UTC;
             }
         }
@@ -295,7 +508,7 @@ void DataLogger::handle()
 
     bool flushByTime =
         pendingCount > 0 &&
-        (millis() - lastFlushMs >= FLUSH_TIMEOUT_MS);
+        (Clock::nowMs() - lastFlushMs >= FLUSH_TIMEOUT_MS);
 
     if (flushByCount || flushByTime) {
         tryFlush();
@@ -307,7 +520,7 @@ void DataLogger::handle()
 // -----------------------------------------------------------------------------
 void DataLogger::tryFlush()
 {
-    if (!ManagerUTC::isUtcValid()) return;
+    if (!Clock::isUtcValid()) return;
 
     size_t flushable = 0;
     for (size_t i = 0; i < pendingCount; ++i) {
@@ -325,6 +538,19 @@ void DataLogger::tryFlush()
     flushToFlash(toFlush);
 }
 
+// -----------------------------------------------------------------------------
+// FLUSH IMMÉDIAT — vide tout ce qui est flushable (par paquets de FLUSH_SIZE)
+// Utilisé avant une fenêtre d'uplink pour publier les données les plus récentes
+// -----------------------------------------------------------------------------
+void DataLogger::flush()
+{
+    size_t before;
+    do {
+        before = pendingCount;
+        tryFlush();
+    } while (pendingCount > 0 && pendingCount < before);
+}
+
 // -----------------------------------------------------------------------------
 // FLUSH TO FLASH
 // Format CSV : timestamp,type,id,valueType,value
@@ -332,12 +558,29 @@ void DataLogger::tryFlush()
 // -----------------------------------------------------------------------------
 void DataLogger::flushToFlash(size_t count)
 {
-    File f = SPIFFS.open("/datalog.csv", FILE_APPEND);
+    uint32_t startUs = micros();
+
+    if (tailDirty) {
+        if (!repairTail()) {
+            perf.flushFailures++;
+            LOG_ERROR(TAG, "Fin de /datalog.csv non réparée - %u enregistrement(s) conservé(s)",
+                      (unsigned)count);
+            return;
+        }
+        LOG_WARN(TAG, "Fin de /datalog.csv réparée (%u octets)", (unsigned)cleanSize);
+    }
+
+    File f = FileSystem::fs().open("/datalog.csv", FILE_APPEND);
     if (!f) {
-        Serial.println("[DataLogger] Error: Cannot open /datalog.csv for writing");
+        perf.flushFailures++;
+        LOG_ERROR(TAG, "Ouverture /datalog.csv en écriture impossible");
         return;
     }
 
+    const size_t startSize = f.size();
+    PageWriter writer(f, perf);
+    char line[48];
+
     for (size_t i = 0; i < count; ++i) {
         size_t idx = (pendingHead + i) % PENDING_SIZE;
         DataRecord& r = pending[idx];
@@ -346,29 +589,57 @@ void DataLogger::flushToFlash(size_t count)
         if (std::holds_alternative<float>(r.value)) {
             // Valeur numérique
             float val = std::get<float>(r.value);
-            f.printf("%lu,%d,%d,0,%.3f\n",
-                     r.timestamp,
-                     (int)r.type,
-                     (int)r.id,
-                     val);
+            int n = snprintf(line, sizeof(line), "%lu,%d,%d,0,%.3f\n",
+                             (unsigned long)r.timestamp,
+                             (int)r.type,
+                             (int)r.id,
+                             val);
+            writer.put(line, n);
         } else {
             // Valeur textuelle - ÉCHAPPER avec guillemets CSV
-            String txt = std::get<String>(r.value);
-            String escaped = escapeCSV(txt);
-            f.printf("%lu,%d,%d,1,%s\n",
-                     r.timestamp,
-                     (int)r.type,
-                     (int)r.id,
-                     escaped.c_str());
+            int n = snprintf(line, sizeof(line), "%lu,%d,%d,1,",
+                             (unsigned long)r.timestamp,
+                             (int)r.type,
+                             (int)r.id);
+            writer.put(line, n);
+            writer.putQuoted(std::get<String>(r.value));
+            writer.put('\n');
         }
     }
+
+    writer.putTrailer(blockSeq);
+
+    bool ok = writer.finish();
+    size_t written = writer.written();
     f.close();
+    perf.bytesWritten += written;
+
+    if (!ok) {
+        // Bloc incomplet retiré, enregistrements conservés en PENDING et
+        // numéro de bloc inchangé : le prochain essai réécrit le même bloc.
+        // Troncature impossible : fin marquée sale, les flushs suivants la
+        // réparent avant d'écrire (recoverTail() s'en charge après un reboot)
+        perf.flushFailures++;
+        LOG_ERROR(TAG, "Écriture /datalog.csv incomplète (partition pleine ?) - %u enregistrement(s) conservé(s)",
+                  (unsigned)count);
+        tailDirty = true;
+        cleanSize = startSize;
+        if (!repairTail()) {
+            dataVersion++;  // Octets déchirés visibles des lecteurs jusqu'à réparation
+        }
+        return;
+    }
+    blockSeq++;
 
     pendingHead =
         (pendingHead + count) % PENDING_SIZE;
     pendingCount -= count;
 
-    lastFlushMs = millis();
+    lastFlushMs = Clock::nowMs();
+    dataVersion++;
+
+    overflowReported = false;
+    perf.flush.record(micros() - startUs, count);
 }
 
 // -----------------------------------------------------------------------------
@@ -379,12 +650,17 @@ void DataLogger::clearHistory()
     Serial.println("[DataLogger] Suppression de l'historique...");
     
     // Supprimer le fichier CSV
-    if (SPIFFS.remove("/datalog.csv")) {
+    if (FileSystem::fs().remove("/datalog.csv")) {
         Serial.println("[DataLogger] Fichier /datalog.csv supprimé avec succès");
     } else {
         Serial.println("[DataLogger] Warning: Impossible de supprimer /datalog.csv (peut-être inexistant)");
     }
     
+    dataVersion++;
+    blockSeq = 0;
+    tailDirty = false;
+    GraphCache::invalidate();
+
     // Réinitialiser les buffers PENDING (Option A : on garde lastDataForWeb)
     pendingHead = 0;
     pendingCount = 0;
@@ -395,6 +671,27 @@ void DataLogger::clearHistory()
     Serial.println("[DataLogger] Buffers réinitialisés. Historique vidé.");
 }
 
+// -----------------------------------------------------------------------------
+// VERSION DES DONNÉES FLASH
+// -----------------------------------------------------------------------------
+uint32_t DataLogger::getDataVersion()
+{
+    return dataVersion;
+}
+
+// -----------------------------------------------------------------------------
+// MONITORING
+// -----------------------------------------------------------------------------
+const DataLoggerPerf& DataLogger::getPerf()
+{
+    return perf;
+}
+
+size_t DataLogger::getPendingCount()
+{
+    return pendingCount;
+}
+
 // -----------------------------------------------------------------------------
 // WEB — dernière valeur RAM
 // -----------------------------------------------------------------------------
@@ -416,9 +713,14 @@ LogFileStats DataLogger::getLogFileStats()
     stats.sizeBytes = 0;
     stats.sizeMB = 0.0f;
     stats.percentFull = 0.0f;
-    stats.totalGB = 1.9f;  // Valeur fixe : partition SPIFFS de 1.9 Go
+
+    // Occupation réelle de la partition (et non plus une valeur fixe)
+    size_t totalBytes = FileSystem::totalBytes();
+    size_t usedBytes  = FileSystem::usedBytes();
+    stats.totalMB = totalBytes / (1024.0f * 1024.0f);
+    stats.freeMB  = (totalBytes > usedBytes ? totalBytes - usedBytes : 0) / (1024.0f * 1024.0f);
     
-    File file = SPIFFS.open("/datalog.csv", FILE_READ);
+    File file = FileSystem::fs().open("/datalog.csv", FILE_READ);
     if (!file) {
         // Fichier n'existe pas - c'est normal
         return stats;
@@ -430,12 +732,13 @@ LogFileStats DataLogger::getLogFileStats()
     
     file.close();
     
-    // Calcul du pourcentage sur 1.9 Go
-    const float TOTAL_STORAGE_BYTES = stats.totalGB * 1024.0f * 1024.0f * 1024.0f;
-    stats.percentFull = (stats.sizeBytes / TOTAL_STORAGE_BYTES) * 100.0f;
+    if (totalBytes > 0) {
+        stats.percentFull = (stats.sizeBytes * 100.0f) / totalBytes;
+    }
     
-    Serial.printf("[DataLogger] Stats fichier: %.2f MB (%.3f%% de %.2f Go)\n", 
-                  stats.sizeMB, stats.percentFull, stats.totalGB);
+    LOG_DEBUG(TAG, "Stats fichier: %.2f MB (%.1f%% de %.2f MB, %s)",
+              stats.sizeMB, stats.percentFull, stats.totalMB,
+              FileSystem::getBackendName());
     
     return stats;
 }
@@ -446,124 +749,65 @@ LogFileStats DataLogger::getLogFileStats()
 // -----------------------------------------------------------------------------
 bool DataLogger::getLastUtcRecord(DataId id, DataRecord& out)
 {
-    File file = SPIFFS.open("/datalog.csv", FILE_READ);
+    File file = FileSystem::fs().open("/datalog.csv", FILE_READ);
     if (!file) {
-        Serial.println("[DataLogger] ERROR: Cannot open /datalog.csv for reading");
+        LOG_ERROR(TAG, "Ouverture /datalog.csv en lecture impossible");
         return false;
     }
 
-    String line;
-    bool found = false;
-    DataRecord candidate;
-
-    while (file.available()) {
-        line = file.readStringUntil('\n');
-        if (line.length() == 0) continue;
-
-        unsigned long ts;
-        uint8_t typeByte, idByte, valueType;
-        
-        // Parser la ligne selon le format : timestamp,type,id,valueType,value
-        int firstComma = line.indexOf(',');
-        int secondComma = line.indexOf(',', firstComma + 1);
-        int thirdComma = line.indexOf(',', secondComma + 1);
-        int fourthComma = line.indexOf(',', thirdComma + 1);
-        
-        if (firstComma == -1 || secondComma == -1 || thirdComma == -1 || fourthComma == -1) {
-            Serial.println("[DataLogger] Warning: Ligne CSV mal formatée (virgules manquantes): " + line);
-            continue; // Format invalide
-        }
-        
-        ts = line.substring(0, firstComma).toInt();
-        typeByte = line.substring(firstComma + 1, secondComma).toInt();
-        idByte = line.substring(secondComma + 1, thirdComma).toInt();
-        valueType = line.substring(thirdComma + 1, fourthComma).toInt();
-        String valueStr = line.substring(fourthComma + 1);
-        
-        if (idByte == static_cast<uint8_t>(id)) {
-            candidate.timestamp = ts;
-            candidate.timeBase  = TimeBase::UTC;
-            candidate.type      = static_cast<DataType>(typeByte);
-            candidate.id        = id;
-            
-            if (valueType == 0) {
-                // Valeur numérique
-                candidate.value = valueStr.toFloat();
-            } else {
-                // Valeur textuelle - DÉSECHAPPER
-                valueStr.trim(); // Enlever les espaces/retours à la ligne
-                candidate.value = unescapeCSV(valueStr);
-            }
-            found = true;
-        }
-    }
+    struct Search {
+        uint8_t id;
+        bool found;
+        DataRecord candidate;
+    } search;
+    search.id = static_cast<uint8_t>(id);
+    search.found = false;
+
+    uint32_t scanStartUs = micros();
+    uint32_t records = CsvLogReader::forEach(file, [](const CsvRecord& rec, void* ctx) {
+        Search& s = *static_cast<Search*>(ctx);
+        if (rec.id != s.id) return true;
+
+        s.candidate.timestamp = rec.timestamp;
+        s.candidate.timeBase  = TimeBase::UTC;
+        s.candidate.type      = static_cast<DataType>(rec.type);
+        s.candidate.id        = static_cast<DataId>(rec.id);
+        assignValue(s.candidate.value, rec);
+        s.found = true;
+        return true;
+    }, &search);
 
     file.close();
-    if (found) {
-        out = candidate;
+    perf.scan.record(micros() - scanStartUs, records);
+    if (search.found) {
+        out = search.candidate;
     }
     // PAS de log si pas trouvé - c'est normal
-    return found;
+    return search.found;
 }
 
 // -----------------------------------------------------------------------------
 // GRAPH CSV (FLASH) — avec timestamp UTC
 // ATTENTION : Ne fonctionne que pour les valeurs NUMÉRIQUES
+// Résultat servi par GraphCache (lecture flash incrémentale uniquement)
 // -----------------------------------------------------------------------------
 String DataLogger::getGraphCsv(DataId id, uint32_t daysBack)
 {
-    File file = SPIFFS.open("/datalog.csv", FILE_READ);
-    if (!file) {
-        Serial.println("[DataLogger] ERROR: Cannot open /datalog.csv for reading (getGraphCsv)");
+    GraphCache::Result result;
+    if (!GraphCache::query(id, daysBack, result)) {
+        LOG_ERROR(TAG, "getGraphCsv indisponible");
         return "";
     }
 
-    uint32_t cutoffTime = 0;
-    if (daysBack > 0) {
-        cutoffTime = ManagerUTC::nowUtc() - (daysBack * 86400UL);
+    String csv;
+    csv.reserve(16 + result.length);
+    csv = "timestamp,value\n";
+    if (result.blob) {
+        csv.concat(result.blob->data + result.offset, result.length);
     }
 
-    String csv = "timestamp,value\n";
-    int validLines = 0;
+    LOG_DEBUG(TAG, "getGraphCsv: %lu lignes pour DataId %d",
+              (unsigned long)result.rows, (int)id);
 
-    while (file.available()) {
-        String line = file.readStringUntil('\n');
-        if (line.length() == 0) continue;
-
-        unsigned long ts;
-        uint8_t typeByte, idByte, valueType;
-        
-        // Parser la ligne
-        int firstComma = line.indexOf(',');
-        int secondComma = line.indexOf(',', firstComma + 1);
-        int thirdComma = line.indexOf(',', secondComma + 1);
-        int fourthComma = line.indexOf(',', thirdComma + 1);
-        
-        if (firstComma == -1 || secondComma == -1 || thirdComma == -1 || fourthComma == -1) {
-            continue; // Format invalide - ignorer silencieusement
-        }
-        
-        ts = line.substring(0, firstComma).toInt();
-        typeByte = line.substring(firstComma + 1, secondComma).toInt();
-        idByte = line.substring(secondComma + 1, thirdComma).toInt();
-        valueType = line.substring(thirdComma + 1, fourthComma).toInt();
-        String valueStr = line.substring(fourthComma + 1);
-
-        // Ne traiter que les valeurs numériques (valueType == 0)
-        if (idByte == static_cast<uint8_t>(id) &&
-            valueType == 0 &&
-            (daysBack == 0 || ts >= cutoffTime))
-        {
-            float val = valueStr.toFloat();
-            csv += String(ts) + ",";
-            csv += String(val, 2) + "\n";
-            validLines++;
-        }
-    }
-
-    file.close();
-    
-    Serial.printf("[DataLogger] getGraphCsv: %d lignes pour DataId %d\n", validLines, (int)id);
-    
     return csv;
-}
\ No newline at end of file
+}
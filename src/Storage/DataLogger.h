@@ -5,6 +5,7 @@
 #include <map>
 #include <time.h>
 #include <variant>  // C++17 pour gérer float et String
+#include "Utils/PerfCounter.h"
 
 // ─────────────────────────────────────────────
 // Référentiel temporel
@@ -98,8 +99,26 @@ struct LogFileStats {
     bool exists;          // Le fichier existe-t-il ?
     size_t sizeBytes;     // Taille en bytes
     float sizeMB;         // Taille en MB
-    float percentFull;    // Pourcentage utilisé
-    float totalGB;        // Taille partition (fixe : 1.9 Go)
+    float percentFull;    // Part de la partition occupée par le fichier
+    float totalMB;        // Taille de la partition (FileSystem)
+    float freeMB;         // Espace libre sur la partition
+};
+
+// ─────────────────────────────────────────────
+// Instrumentation du moteur de stockage (GET /api/perf)
+// ─────────────────────────────────────────────
+
+struct DataLoggerPerf {
+    PerfCounter push;           // push() complet (live + pending + vue web)
+    PerfCounter flush;          // flushToFlash, items = enregistrements écrits
+    PerfCounter scan;           // Parcours complet du CSV, items = enregistrements lus
+    uint64_t    bytesWritten = 0;
+    uint32_t    fullPageWrites = 0;       // Écritures de pages 256 o entières et alignées
+    uint32_t    partialPageWrites = 0;    // Début / fin de lot (page partielle)
+    uint32_t    sectorsStarted = 0;       // Estimation des effacements (secteurs 4 Ko entamés)
+    uint32_t    pendingDropped = 0;   // Perdus : PENDING plein (ex. UTC invalide trop longtemps)
+    uint32_t    recoveredBytes = 0;   // Tronqués au boot (flush interrompu par une coupure)
+    uint32_t    flushFailures = 0;    // Écritures échouées (enregistrements conservés)
 };
 
 // ─────────────────────────────────────────────
@@ -119,12 +138,18 @@ public:
     static bool getLast(DataId id, DataRecord& out); // live (si implémenté ailleurs)
 
     static void handle(); // réparation UTC + flush
+    static void flush();  // Flush immédiat des enregistrements UTC (avant uplink)
     
     // Gestion de l'historique
     static void clearHistory(); // Supprime l'historique flash et réinitialise les buffers
 
     // ───────────── Web ─────────────
     static bool hasLastDataForWeb(DataId id, LastDataForWeb& out);
+
+    // Notification de changement (push live vers le navigateur)
+    // Appelé depuis push() uniquement si la valeur de id a changé
+    typedef void (*ChangeCallback)(DataId id, const LastDataForWeb& entry);
+    static void setChangeCallback(ChangeCallback cb);
     static bool getLastUtcRecord(DataId id, DataRecord& out);
     static String getCurrentValueWithTime(DataId id);   // LEGACY
     static String getGraphCsv(DataId id, uint32_t daysBack = 30);
@@ -132,6 +157,14 @@ public:
     // Statistiques du fichier de logs
     static LogFileStats getLogFileStats();
 
+    // Version des données flash : incrémentée à chaque écriture ou suppression
+    // de /datalog.csv (0 au boot). Sert d'ETag aux réponses dérivées du fichier
+    static uint32_t getDataVersion();
+
+    // ───────────── Monitoring ─────────────
+    static const DataLoggerPerf& getPerf();
+    static size_t getPendingCount();
+
 private:
     // ───────────── Temps ─────────────
     static uint32_t nowRelative();
@@ -142,6 +175,7 @@ private:
     static constexpr size_t FLUSH_SIZE   = 50;
 
     static constexpr uint32_t FLUSH_TIMEOUT_MS = 3600000UL; // 1 heure
+    static constexpr size_t   RECOVERY_WINDOW  = 8192;      // Fin de fichier relue au boot (> 1 bloc)
 
     // LIVE (ring buffer simple)
     static DataRecord live[LIVE_SIZE];
@@ -154,11 +188,22 @@ private:
 
     // ───────────── Web RAM ─────────────
     static std::map<DataId, LastDataForWeb> lastDataForWeb;
+    static ChangeCallback changeCallback;
+
+    // ───────────── Flash ─────────────
+    static volatile uint32_t dataVersion;   // Lu depuis la tâche du serveur web
+
+    // ───────────── Instrumentation ─────────────
+    static DataLoggerPerf perf;
 
     // ───────────── Internes ─────────────
     static void addLive(const DataRecord& r);
+    static void updateWeb(DataId id, const std::variant<float, String>& value,
+                          bool utcValid, uint32_t utcNow, uint32_t relNow);
     static void addPending(const DataRecord& r);
 
     static void tryFlush();
     static void flushToFlash(size_t count);
+    static void recoverTail();
+    static bool repairTail();
 };
\ No newline at end of file
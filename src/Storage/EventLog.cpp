@@ -0,0 +1,529 @@
+// Storage/EventLog.cpp
+// Journal d'événements binaire (voir EventLog.h)
+
+#include "Storage/EventLog.h"
+#include "Storage/FileSystem.h"
+#include "Connectivity/ManagerUTC.h"
+
+#include <esp_ota_ops.h>
+#include <soc/soc_memory_layout.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+static const char* LEGACY_FILE = "/events.bin";     // Anneau réécrit en place (ancien format)
+
+static portMUX_TYPE queueMux = portMUX_INITIALIZER_UNLOCKED;
+
+// persist() : tâche de vidage du Logger ET Logger::flush() (autre tâche)
+static SemaphoreHandle_t persistMutex = nullptr;
+
+bool     EventLog::ready      = false;
+uint32_t EventLog::nextSeq    = 1;
+uint32_t EventLog::firmwareId = 0;
+uint32_t EventLog::dropped    = 0;
+
+EventLog::Record EventLog::queue[EventLog::QUEUE_SIZE];
+uint8_t  EventLog::queueHead  = 0;
+uint8_t  EventLog::queueCount = 0;
+
+// -----------------------------------------------------------------------------
+// Spécificateurs printf (format compact)
+// -----------------------------------------------------------------------------
+
+namespace {
+
+enum class ArgKind : uint8_t { None, Int32, Int64, Double, String, Invalid };
+
+// Analyse un spécificateur à partir du caractère suivant '%'
+// spec reçoit la forme normalisée (sans '*'), *star = nombre de '*' consommés
+struct Spec {
+    ArgKind kind;
+    uint8_t stars;      // Largeur / précision passées en argument
+    size_t  length;     // Caractères consommés après '%'
+};
+
+Spec parseSpec(const char* p)
+{
+    Spec s{ArgKind::Invalid, 0, 0};
+    const char* start = p;
+
+    while (*p && strchr("-+ #0", *p)) p++;
+    if (*p == '*') { s.stars++; p++; }
+    while (*p >= '0' && *p <= '9') p++;
+    if (*p == '.') {
+        p++;
+        if (*p == '*') { s.stars++; p++; }
+        while (*p >= '0' && *p <= '9') p++;
+    }
+
+    bool wide = false;
+    if (p[0] == 'l' && p[1] == 'l') { wide = true; p += 2; }
+    else if (p[0] == 'h' && p[1] == 'h') { p += 2; }
+    else if (*p && strchr("hlzjtL", *p)) { p++; }
+
+    switch (*p) {
+        case 'd': case 'i': case 'u': case 'x': case 'X': case 'o': case 'c':
+            s.kind = wide ? ArgKind::Int64 : ArgKind::Int32; break;
+        case 'p':
+            s.kind = ArgKind::Int32; break;
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+            s.kind = ArgKind::Double; break;
+        case 's':
+            s.kind = ArgKind::String; break;
+        case '%':
+            s.kind = ArgKind::None; break;
+        default:
+            return s;   // %n et inconnus : non supportés
+    }
+
+    s.length = (size_t)(p - start) + 1;
+    return s;
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+// Segments : seq 1..128 → segment 0, 129..256 → segment 1, 257.. → segment 0…
+// Un slot est à l'offset fixe (seq - 1) % SEGMENT_SLOTS de son segment
+// -----------------------------------------------------------------------------
+void EventLog::segmentPath(uint32_t seq, char* out, size_t outSize)
+{
+    snprintf(out, outSize, "/events.%u.bin",
+             (unsigned)(((seq - 1) / SEGMENT_SLOTS) % SEGMENT_COUNT));
+}
+
+size_t EventLog::slotOffset(uint32_t seq)
+{
+    return (size_t)((seq - 1) % SEGMENT_SLOTS) * sizeof(Record);
+}
+
+// -----------------------------------------------------------------------------
+// Initialisation : reprise du numéro de séquence depuis les segments
+// Un slot final incomplet (coupure pendant l'écriture) est retiré pour que
+// les ajouts suivants restent alignés sur les slots
+// -----------------------------------------------------------------------------
+void EventLog::init()
+{
+    if (!persistMutex) {
+        persistMutex = xSemaphoreCreateMutex();
+    }
+
+    const esp_app_desc_t* desc = esp_ota_get_app_description();
+    memcpy(&firmwareId, desc->app_elf_sha256, sizeof(firmwareId));
+
+    if (FileSystem::fs().exists(LEGACY_FILE)) {
+        FileSystem::fs().remove(LEGACY_FILE);
+    }
+
+    uint32_t maxSeq = 0;
+    for (uint8_t segment = 0; segment < SEGMENT_COUNT; segment++) {
+        char path[24];
+        segmentPath((uint32_t)segment * SEGMENT_SLOTS + 1, path, sizeof(path));
+
+        File f = FileSystem::fs().open(path, FILE_READ);
+        if (!f) continue;
+
+        const size_t size = f.size();
+        Record rec;
+        while (f.read((uint8_t*)&rec, sizeof(rec)) == sizeof(rec)) {
+            if (rec.seq > maxSeq) maxSeq = rec.seq;
+        }
+        f.close();
+
+        if (size % sizeof(Record) != 0) {
+            FileSystem::truncate(path, size - size % sizeof(Record));
+        }
+    }
+    nextSeq = maxSeq + 1;
+
+    ready = true;
+    Logger::setMirror(capture, persist, Logger::Level::WARN);
+}
+
+// -----------------------------------------------------------------------------
+// Capture (contexte de l'appelant) : encodage en RAM uniquement
+// -----------------------------------------------------------------------------
+void EventLog::capture(Logger::Level level, const char* tag, const char* fmt, va_list args)
+{
+    if (!ready) return;
+
+    Record rec;
+    memset(&rec, 0, sizeof(rec));
+    rec.utc   = ManagerUTC::isUtcValid() ? (uint32_t)ManagerUTC::nowUtc() : 0;
+    rec.relMs = millis();
+    rec.fwId  = firmwareId;
+    rec.level = (uint8_t)level;
+
+    // Tag et format en flash (macros LOG_*) : adresses + arguments bruts
+    bool compact = tag != nullptr && esp_ptr_in_drom(tag) && esp_ptr_in_drom(fmt);
+    if (compact) {
+        rec.tagAddr = (uint32_t)(uintptr_t)tag;
+        rec.fmtAddr = (uint32_t)(uintptr_t)fmt;
+
+        va_list copy;
+        va_copy(copy, args);
+        compact = encodeArgs(rec, fmt, copy);
+        va_end(copy);
+    }
+
+    if (!compact) {
+        // Mode texte : "tag\0message" tronqué
+        rec.tagAddr = 0;
+        rec.fmtAddr = 0;
+        size_t pos = strlcpy((char*)rec.payload, tag ? tag : "", 12);
+        if (pos > 11) pos = 11;
+        pos++;
+        vsnprintf((char*)rec.payload + pos, sizeof(rec.payload) - pos, fmt, args);
+        rec.payloadLen = sizeof(rec.payload);
+    }
+
+    portENTER_CRITICAL(&queueMux);
+    if (queueCount < QUEUE_SIZE) {
+        rec.seq = nextSeq++;
+        queue[(queueHead + queueCount) % QUEUE_SIZE] = rec;
+        queueCount++;
+    } else {
+        dropped++;
+    }
+    portEXIT_CRITICAL(&queueMux);
+}
+
+// Arguments bruts : entiers 4/8 octets, flottants en float, chaînes préfixées
+// par leur longueur. Retourne false si le payload déborde ou format inconnu.
+bool EventLog::encodeArgs(Record& rec, const char* fmt, va_list args)
+{
+    size_t pos = 0;
+
+    for (const char* p = fmt; *p; p++) {
+        if (*p != '%') continue;
+
+        Spec spec = parseSpec(p + 1);
+        if (spec.kind == ArgKind::Invalid) return false;
+        p += spec.length;
+        if (spec.kind == ArgKind::None) continue;
+
+        for (uint8_t i = 0; i < spec.stars; i++) {
+            int32_t v = va_arg(args, int);
+            if (pos + 4 > sizeof(rec.payload)) return false;
+            memcpy(rec.payload + pos, &v, 4);
+            pos += 4;
+        }
+
+        switch (spec.kind) {
+            case ArgKind::Int32: {
+                int32_t v = va_arg(args, int32_t);
+                if (pos + 4 > sizeof(rec.payload)) return false;
+                memcpy(rec.payload + pos, &v, 4);
+                pos += 4;
+                break;
+            }
+            case ArgKind::Int64: {
+                int64_t v = va_arg(args, int64_t);
+                if (pos + 8 > sizeof(rec.payload)) return false;
+                memcpy(rec.payload + pos, &v, 8);
+                pos += 8;
+                break;
+            }
+            case ArgKind::Double: {
+                float v = (float)va_arg(args, double);
+                if (pos + 4 > sizeof(rec.payload)) return false;
+                memcpy(rec.payload + pos, &v, 4);
+                pos += 4;
+                break;
+            }
+            case ArgKind::String: {
+                const char* str = va_arg(args, const char*);
+                if (str == nullptr) str = "(null)";
+                if (pos + 1 > sizeof(rec.payload)) return false;
+                // Chaîne tronquée à la place restante
+                size_t len = strlen(str);
+                size_t room = sizeof(rec.payload) - pos - 1;
+                if (len > room) len = room;
+                rec.payload[pos++] = (uint8_t)len;
+                memcpy(rec.payload + pos, str, len);
+                pos += len;
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    rec.payloadLen = (uint8_t)pos;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Écriture flash (tâche de vidage du Logger) : ajout seul
+// Premier slot d'un segment : le plus ancien est recréé vide. Séquences
+// perdues (file pleine, coupure) : slots vides intercalés pour garder
+// l'alignement seq → offset
+// -----------------------------------------------------------------------------
+
+// Le segment contient-il déjà des séquences du même tour que seq ?
+// (sinon il date du tour précédent : à recréer, même si son premier slot a été perdu)
+bool EventLog::segmentHolds(const char* path, uint32_t seq)
+{
+    File f = FileSystem::fs().open(path, FILE_READ);
+    if (!f) return false;
+
+    bool holds = true;
+    Record rec;
+    while (f.read((uint8_t*)&rec, sizeof(rec)) == sizeof(rec)) {
+        if (rec.seq == 0) continue;     // Slot vide intercalé
+        holds = (rec.seq - 1) / SEGMENT_SLOTS == (seq - 1) / SEGMENT_SLOTS;
+        break;
+    }
+    f.close();
+    return holds;
+}
+
+void EventLog::persist()
+{
+    if (!ready || queueCount == 0) return;
+
+    xSemaphoreTake(persistMutex, portMAX_DELAY);
+
+    File f;
+    char openPath[24] = "";
+
+    for (;;) {
+        Record rec;
+
+        portENTER_CRITICAL(&queueMux);
+        if (queueCount == 0) {
+            portEXIT_CRITICAL(&queueMux);
+            break;
+        }
+        rec = queue[queueHead];
+        queueHead = (queueHead + 1) % QUEUE_SIZE;
+        queueCount--;
+        portEXIT_CRITICAL(&queueMux);
+
+        char path[24];
+        segmentPath(rec.seq, path, sizeof(path));
+        const size_t offset = slotOffset(rec.seq);
+
+        if (offset == 0 || strcmp(path, openPath) != 0) {
+            if (f) f.close();
+            bool fresh = offset == 0 || !segmentHolds(path, rec.seq);
+            f = FileSystem::fs().open(path, fresh ? FILE_WRITE : FILE_APPEND);
+            if (!f) {
+                openPath[0] = '\0';
+                continue;
+            }
+            strlcpy(openPath, path, sizeof(openPath));
+        }
+
+        if (f.size() > offset) continue;    // Slot déjà écrit : jamais de réécriture
+
+        Record empty;
+        memset(&empty, 0, sizeof(empty));
+        while (f.size() < offset) {
+            if (f.write((const uint8_t*)&empty, sizeof(empty)) != sizeof(empty)) break;
+        }
+        f.write((const uint8_t*)&rec, sizeof(rec));
+    }
+
+    if (f) f.close();
+    xSemaphoreGive(persistMutex);
+}
+
+// -----------------------------------------------------------------------------
+// Décodage
+// Slot relu depuis la flash (coupure pendant l'écriture, corruption) : chaque
+// lecture du payload est bornée, le rendu s'arrête au premier argument absent
+// -----------------------------------------------------------------------------
+void EventLog::renderCompact(const Record& rec, char* out, size_t outSize)
+{
+    const char* fmt = (const char*)(uintptr_t)rec.fmtAddr;
+    size_t o = 0;
+    size_t pos = 0;
+    const size_t end = rec.payloadLen < sizeof(rec.payload) ? rec.payloadLen : sizeof(rec.payload);
+
+    auto emit = [&](int n) {
+        if (n > 0) o += (size_t)n;
+        if (o >= outSize) o = outSize - 1;
+    };
+
+    for (const char* p = fmt; *p && o < outSize - 1; p++) {
+        if (*p != '%') {
+            out[o++] = *p;
+            continue;
+        }
+
+        Spec spec = parseSpec(p + 1);
+        if (spec.kind == ArgKind::Invalid) break;
+
+        // Spécificateur isolé (les '*' sont relus depuis le payload)
+        char one[16];
+        size_t specLen = spec.length + 1;
+        if (specLen >= sizeof(one)) break;
+        memcpy(one, p, specLen);
+        one[specLen] = '\0';
+        p += spec.length;
+
+        if (spec.kind == ArgKind::None) {
+            out[o++] = '%';
+            continue;
+        }
+
+        // Arguments attendus absents du payload : rendu interrompu
+        size_t need = (size_t)spec.stars * 4 +
+                      (spec.kind == ArgKind::Int64 ? 8 : spec.kind == ArgKind::String ? 1 : 4);
+        if (pos + need > end) break;
+
+        int32_t stars[2] = {0, 0};
+        for (uint8_t i = 0; i < spec.stars; i++) {
+            memcpy(&stars[i], rec.payload + pos, 4);
+            pos += 4;
+        }
+
+        char* dst = out + o;
+        size_t room = outSize - o;
+
+        switch (spec.kind) {
+            case ArgKind::Int32: {
+                int32_t v;
+                memcpy(&v, rec.payload + pos, 4);
+                pos += 4;
+                emit(spec.stars == 2 ? snprintf(dst, room, one, stars[0], stars[1], v)
+                   : spec.stars == 1 ? snprintf(dst, room, one, stars[0], v)
+                                     : snprintf(dst, room, one, v));
+                break;
+            }
+            case ArgKind::Int64: {
+                int64_t v;
+                memcpy(&v, rec.payload + pos, 8);
+                pos += 8;
+                emit(spec.stars == 2 ? snprintf(dst, room, one, stars[0], stars[1], v)
+                   : spec.stars == 1 ? snprintf(dst, room, one, stars[0], v)
+                                     : snprintf(dst, room, one, v));
+                break;
+            }
+            case ArgKind::Double: {
+                float v;
+                memcpy(&v, rec.payload + pos, 4);
+                pos += 4;
+                emit(spec.stars == 2 ? snprintf(dst, room, one, stars[0], stars[1], (double)v)
+                   : spec.stars == 1 ? snprintf(dst, room, one, stars[0], (double)v)
+                                     : snprintf(dst, room, one, (double)v));
+                break;
+            }
+            case ArgKind::String: {
+                char str[sizeof(rec.payload)];
+                size_t len = rec.payload[pos++];
+                if (len > end - pos) len = end - pos;
+                memcpy(str, rec.payload + pos, len);
+                str[len] = '\0';
+                pos += len;
+                emit(spec.stars == 2 ? snprintf(dst, room, one, stars[0], stars[1], str)
+                   : spec.stars == 1 ? snprintf(dst, room, one, stars[0], str)
+                                     : snprintf(dst, room, one, str));
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    out[o] = '\0';
+}
+
+void EventLog::decode(const Record& rec, EventEntry& out)
+{
+    out.seq   = rec.seq;
+    out.utc   = rec.utc;
+    out.relMs = rec.relMs;
+    out.level = (Logger::Level)rec.level;
+
+    if (rec.tagAddr == 0) {
+        // Mode texte
+        const char* text = (const char*)rec.payload;
+        size_t tagLen = strnlen(text, 11);
+        memcpy(out.tag, text, tagLen);
+        out.tag[tagLen] = '\0';
+        size_t msgStart = tagLen + 1;
+        size_t msgLen = strnlen(text + msgStart, sizeof(rec.payload) - msgStart);
+        memcpy(out.message, text + msgStart, msgLen);
+        out.message[msgLen] = '\0';
+    } else if (rec.fwId == firmwareId &&
+               esp_ptr_in_drom((const void*)(uintptr_t)rec.tagAddr) &&
+               esp_ptr_in_drom((const void*)(uintptr_t)rec.fmtAddr)) {
+        // Même firmware : adresses rodata valides (vérifiées : un fwId
+        // identique sur 4 octets ne suffit pas si le slot est corrompu)
+        strlcpy(out.tag, (const char*)(uintptr_t)rec.tagAddr, sizeof(out.tag));
+        renderCompact(rec, out.message, sizeof(out.message));
+    } else {
+        strlcpy(out.tag, "?", sizeof(out.tag));
+        snprintf(out.message, sizeof(out.message),
+                 "(firmware %08lx, format @%08lx)",
+                 (unsigned long)rec.fwId, (unsigned long)rec.fmtAddr);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Lecture paginée
+// -----------------------------------------------------------------------------
+// Segment courant (1..SEGMENT_SLOTS) + segments pleins précédents encore présents
+uint32_t EventLog::getCount()
+{
+    uint32_t written = nextSeq - 1;
+    if (written == 0) return 0;
+    uint32_t current = (written - 1) % SEGMENT_SLOTS + 1;
+    uint32_t older = written - current;
+    uint32_t olderMax = (uint32_t)(SEGMENT_COUNT - 1) * SEGMENT_SLOTS;
+    return current + (older < olderMax ? older : olderMax);
+}
+
+uint16_t EventLog::getPageCount()
+{
+    uint32_t count = getCount();
+    return (uint16_t)((count + PAGE_SIZE - 1) / PAGE_SIZE);
+}
+
+uint32_t EventLog::getDroppedCount()
+{
+    return dropped;
+}
+
+uint16_t EventLog::readPage(uint16_t page, EntryCallback cb, void* ctx)
+{
+    if (!ready) return 0;
+
+    // Séquences déjà attribuées mais pas encore écrites : ignorées (seq ≠ attendu)
+    const uint32_t newest = nextSeq - 1;
+    const uint32_t count  = getCount();
+    const uint32_t skip   = (uint32_t)page * PAGE_SIZE;
+    if (skip >= count) return 0;
+
+    File f;
+    char openPath[24] = "";
+    uint16_t n = 0;
+    EventEntry entry;
+
+    for (uint32_t i = skip; i < count && n < PAGE_SIZE; i++) {
+        uint32_t seq = newest - i;
+        Record rec;
+
+        char path[24];
+        segmentPath(seq, path, sizeof(path));
+        if (strcmp(path, openPath) != 0) {
+            if (f) f.close();
+            f = FileSystem::fs().open(path, FILE_READ);
+            strlcpy(openPath, path, sizeof(openPath));
+        }
+        if (!f) continue;
+
+        if (!f.seek(slotOffset(seq))) continue;
+        if (f.read((uint8_t*)&rec, sizeof(rec)) != sizeof(rec)) continue;
+        if (rec.seq != seq) continue;
+
+        decode(rec, entry);
+        cb(entry, ctx);
+        n++;
+    }
+
+    if (f) f.close();
+    return n;
+}
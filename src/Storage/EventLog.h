@@ -0,0 +1,94 @@
+// Storage/EventLog.h
+// Journal d'événements persistant (WARN/ERROR du Logger) en flash (FileSystem)
+//
+// - Anneau de SEGMENT_COUNT fichiers segments /events.<n>.bin de
+//   SEGMENT_SLOTS × 64 octets, écrits en ajout seul : le premier événement
+//   d'un segment supprime le plus ancien et le recrée vide. Aucune réécriture
+//   en place (copie-sur-écriture LittleFS : un slot réécrit au milieu d'un
+//   fichier recopie tous les blocs jusqu'à la fin)
+// - 128 à 256 derniers événements conservés selon le remplissage du segment courant
+// - Enregistrement compact : horodatage, niveau, adresses rodata du tag et du
+//   format + arguments bruts (pas de texte), rendu au décodage
+// - Appels non LOG_* (String) : texte tronqué stocké tel quel
+// - Capture dans l'appelant (RAM, section critique courte), écriture flash
+//   depuis la tâche de vidage du Logger
+// - Identifiant firmware par enregistrement : adresses rodata décodées
+//   uniquement si le firmware courant est celui qui a écrit le slot
+
+#pragma once
+#include <Arduino.h>
+#include <stdarg.h>
+#include "Utils/Logger.h"
+
+// ─────────────────────────────────────────────
+// Événement décodé (lecture / page web)
+// ─────────────────────────────────────────────
+
+struct EventEntry {
+    uint32_t seq;
+    uint32_t utc;          // 0 si UTC invalide à l'écriture
+    uint32_t relMs;        // millis() à l'écriture
+    Logger::Level level;
+    char     tag[16];
+    char     message[160];
+};
+
+class EventLog {
+public:
+    static constexpr uint16_t SEGMENT_SLOTS = 128;    // 8 Ko par segment
+    static constexpr uint8_t  SEGMENT_COUNT = 2;      // 16 Ko en flash au plus
+    static constexpr uint8_t  PAGE_SIZE  = 20;        // Événements par page web
+
+    // Cycle de vie (après FileSystem::init) : branche le miroir du Logger
+    static void init();
+
+    // Hooks Logger (voir Logger::setMirror)
+    static void capture(Logger::Level level, const char* tag, const char* fmt, va_list args);
+    static void persist();
+
+    // Lecture paginée, plus récent d'abord (page 0 = derniers événements)
+    // cb appelé pour chaque événement ; retourne le nombre d'événements lus
+    typedef void (*EntryCallback)(const EventEntry& entry, void* ctx);
+    static uint16_t readPage(uint16_t page, EntryCallback cb, void* ctx);
+
+    // Monitoring
+    static uint32_t getCount();         // Événements présents dans les segments
+    static uint16_t getPageCount();
+    static uint32_t getDroppedCount();  // Perdus (file RAM pleine)
+
+private:
+    // Slot sur flash (64 octets, little-endian)
+    struct Record {
+        uint32_t seq;           // 0 = slot vide
+        uint32_t utc;
+        uint32_t relMs;
+        uint32_t fwId;          // Firmware ayant écrit le slot
+        uint32_t tagAddr;       // 0 = mode texte (payload = "tag\0message")
+        uint32_t fmtAddr;
+        uint8_t  level;
+        uint8_t  payloadLen;
+        uint16_t reserved;
+        uint8_t  payload[36];   // Arguments bruts (mode compact) ou texte
+    };
+    static_assert(sizeof(Record) == 64, "EventLog::Record doit faire 64 octets");
+
+    static constexpr uint8_t QUEUE_SIZE = 8;    // Événements en attente d'écriture
+
+    // Segment et position d'une séquence (seq ≥ 1)
+    static void segmentPath(uint32_t seq, char* out, size_t outSize);
+    static size_t slotOffset(uint32_t seq);
+    static bool segmentHolds(const char* path, uint32_t seq);
+
+    static bool encodeArgs(Record& rec, const char* fmt, va_list args);
+    static void renderCompact(const Record& rec, char* out, size_t outSize);
+    static void decode(const Record& rec, EventEntry& out);
+
+    static bool     ready;
+    static uint32_t nextSeq;
+    static uint32_t firmwareId;
+    static uint32_t dropped;
+
+    static Record   queue[QUEUE_SIZE];
+    static uint8_t  queueHead;
+    static uint8_t  queueCount;
+};
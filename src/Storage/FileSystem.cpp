@@ -1,7 +1,220 @@
 #include "FileSystem.h"
+#include "Utils/Logger.h"
 
-void FileSystem::init()
+#include <LittleFS.h>
+#include <SPIFFS.h>
+#include <esp_heap_caps.h>
+#include <unistd.h>
+#include <vector>
+
+static const char* TAG = "FileSystem";
+
+fs::FS* FileSystem::current = &LittleFS;
+FileSystem::Backend FileSystem::backend = FileSystem::Backend::None;
+
+bool FileSystem::init()
+{
+    // 1. Cas normal : partition déjà en LittleFS
+    if (LittleFS.begin(false)) {
+        current = &LittleFS;
+        backend = Backend::LittleFS;
+    }
+    // 2. Partition écrite par un firmware SPIFFS : migration en place
+    else if (SPIFFS.begin(false)) {
+        if (migrateFromSpiffs()) {
+            current = &LittleFS;
+            backend = Backend::LittleFS;
+        } else if (SPIFFS.begin(false)) {
+            LOG_WARN(TAG, "Migration LittleFS impossible, maintien en SPIFFS");
+            current = &SPIFFS;
+            backend = Backend::Spiffs;
+        } else {
+            LOG_ERROR(TAG, "Montage du système de fichiers impossible");
+            backend = Backend::None;
+            return false;
+        }
+    }
+    // 3. Partition vierge ou corrompue : formatage LittleFS
+    else if (LittleFS.begin(true)) {
+        LOG_WARN(TAG, "Partition formatée en LittleFS");
+        current = &LittleFS;
+        backend = Backend::LittleFS;
+    }
+    else {
+        LOG_ERROR(TAG, "Montage du système de fichiers impossible");
+        backend = Backend::None;
+        return false;
+    }
+
+    LOG_INFO(TAG, "%s monté (%u / %u octets utilisés)", getBackendName(),
+             (unsigned)usedBytes(), (unsigned)totalBytes());
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Migration SPIFFS → LittleFS (même partition)
+// Tous les fichiers sont chargés en PSRAM, la partition est reformatée puis
+// les fichiers sont réécrits à l'identique : les offsets persistants
+// (point de reprise MqttUplink) restent valides
+// Une coupure d'alimentation pendant la réécriture perd l'historique (aucune
+// partition de secours) ; la fenêtre dure quelques secondes, une seule fois
+// -----------------------------------------------------------------------------
+bool FileSystem::migrateFromSpiffs()
+{
+    struct Copy {
+        String   path;
+        uint8_t* data;
+        size_t   len;
+    };
+    std::vector<Copy> copies;
+    bool ok = true;
+
+    size_t needed = SPIFFS.usedBytes();
+    if (heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM) < needed) {
+        LOG_ERROR(TAG, "PSRAM insuffisante pour migrer %u octets", (unsigned)needed);
+        return false;
+    }
+
+    LOG_WARN(TAG, "Partition SPIFFS détectée : migration vers LittleFS (%u octets)",
+             (unsigned)needed);
+
+    // Lecture complète (SPIFFS est plat : pas de sous-répertoires)
+    File root = SPIFFS.open("/");
+    for (File f = root.openNextFile(); f && ok; f = root.openNextFile()) {
+        Copy c;
+        c.path = f.name();
+        if (!c.path.startsWith("/")) c.path = "/" + c.path;
+        c.len = f.size();
+        c.data = (uint8_t*)heap_caps_malloc(c.len ? c.len : 1, MALLOC_CAP_SPIRAM);
+        if (!c.data || f.read(c.data, c.len) != c.len) {
+            LOG_ERROR(TAG, "Lecture de %s impossible", c.path.c_str());
+            if (c.data) heap_caps_free(c.data);
+            ok = false;
+        } else {
+            copies.push_back(c);
+        }
+        f.close();
+    }
+    root.close();
+
+    if (ok) {
+        SPIFFS.end();
+
+        // Montage impossible sur une partition SPIFFS : formatage
+        ok = LittleFS.begin(true);
+        if (!ok) {
+            LOG_ERROR(TAG, "Formatage LittleFS impossible");
+        }
+
+        for (const Copy& c : copies) {
+            if (!ok) break;
+            File out = LittleFS.open(c.path, FILE_WRITE);
+            ok = out && out.write(c.data, c.len) == c.len;
+            out.close();
+            if (ok) {
+                LOG_INFO(TAG, "Migré : %s (%u octets)", c.path.c_str(), (unsigned)c.len);
+            } else {
+                LOG_ERROR(TAG, "Écriture de %s impossible", c.path.c_str());
+            }
+        }
+
+        if (!ok) {
+            // Données en RAM perdues : partition LittleFS vide mais utilisable
+            LOG_ERROR(TAG, "Migration interrompue, historique perdu");
+            ok = LittleFS.begin(true);
+        }
+    }
+
+    for (Copy& c : copies) {
+        heap_caps_free(c.data);
+    }
+    return ok;
+}
+
+bool FileSystem::isMounted()
+{
+    return backend != Backend::None;
+}
+
+fs::FS& FileSystem::fs()
+{
+    return *current;
+}
+
+void FileSystem::setFs(fs::FS& other)
+{
+    current = &other;
+    backend = Backend::External;
+}
+
+// -----------------------------------------------------------------------------
+// Troncature : truncate() POSIX via le VFS (LittleFS), sinon recopie des
+// size premiers octets dans un fichier temporaire puis renommage
+// -----------------------------------------------------------------------------
+bool FileSystem::truncate(const char* path, size_t size)
+{
+    const char* mountPoint = nullptr;
+    if (backend == Backend::LittleFS) mountPoint = "/littlefs";
+    else if (backend == Backend::Spiffs) mountPoint = "/spiffs";
+
+    if (mountPoint) {
+        char fullPath[64];
+        snprintf(fullPath, sizeof(fullPath), "%s%s", mountPoint, path);
+        if (::truncate(fullPath, size) == 0) return true;
+    }
+
+    static const char* TMP_PATH = "/.truncate.tmp";
+    File in = current->open(path, FILE_READ);
+    File out = current->open(TMP_PATH, FILE_WRITE);
+    bool ok = in && out;
+
+    uint8_t buf[256];
+    size_t remaining = size;
+    while (ok && remaining > 0) {
+        size_t n = in.read(buf, min(remaining, sizeof(buf)));
+        ok = n > 0 && out.write(buf, n) == n;
+        remaining -= n;
+    }
+    in.close();
+    out.close();
+
+    ok = ok && current->remove(path) && current->rename(TMP_PATH, path);
+    if (!ok) {
+        current->remove(TMP_PATH);
+        LOG_ERROR(TAG, "Troncature de %s impossible", path);
+    }
+    return ok;
+}
+
+size_t FileSystem::totalBytes()
+{
+    switch (backend) {
+        case Backend::LittleFS: return LittleFS.totalBytes();
+        case Backend::Spiffs:   return SPIFFS.totalBytes();
+        default:                return 0;
+    }
+}
+
+size_t FileSystem::usedBytes()
+{
+    switch (backend) {
+        case Backend::LittleFS: return LittleFS.usedBytes();
+        case Backend::Spiffs:   return SPIFFS.usedBytes();
+        default:                return 0;
+    }
+}
+
+FileSystem::Backend FileSystem::getBackend()
+{
+    return backend;
+}
+
+const char* FileSystem::getBackendName()
 {
-    // Initialisation du système de fichiers
-    // LittleFS / SPIFFS / SD (plus tard)
+    switch (backend) {
+        case Backend::LittleFS: return "LittleFS";
+        case Backend::Spiffs:   return "SPIFFS";
+        case Backend::External: return "externe";
+        default:                return "aucun";
+    }
 }
@@ -1,10 +1,47 @@
 #ifndef FILE_SYSTEM_H
 #define FILE_SYSTEM_H
 
+#include <FS.h>
+
+// Point d'accès unique au système de fichiers flash
+// - init() monte la partition "spiffs" en LittleFS (formatage si vierge)
+// - Partition encore au format SPIFFS (firmware précédent) : migration en
+//   place, fichiers recopiés à l'identique via la PSRAM
+// - fs() est le seul endroit où le backend est nommé : les modules de
+//   stockage (DataLogger, EventLog, GraphCache, MqttUplink, WebServer)
+//   ne référencent ni SPIFFS ni LittleFS directement
+// - setFs() substitue un autre fs::FS (SD, FS POSIX d'un banc de test hôte)
+
 class FileSystem
 {
 public:
-    static void init();
+    enum class Backend : uint8_t {
+        None,
+        LittleFS,
+        Spiffs,     // Repli : migration impossible (PSRAM insuffisante)
+        External    // setFs()
+    };
+
+    static bool init();
+    static bool isMounted();
+
+    static fs::FS& fs();
+    static void setFs(fs::FS& other);
+
+    // Tronque un fichier à size octets (récupération après coupure)
+    static bool truncate(const char* path, size_t size);
+
+    // Occupation réelle de la partition (0 si inconnue)
+    static size_t totalBytes();
+    static size_t usedBytes();
+    static Backend getBackend();
+    static const char* getBackendName();
+
+private:
+    static bool migrateFromSpiffs();
+
+    static fs::FS* current;
+    static Backend backend;
 };
 
 #endif
@@ -0,0 +1,301 @@
+// Storage/GraphCache.cpp
+#include "Storage/GraphCache.h"
+#include "Storage/CsvLogReader.h"
+#include "Storage/FileSystem.h"
+#include "Utils/Clock.h"
+#include "Utils/Logger.h"
+
+#include <esp_heap_caps.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char* TAG = "GraphCache";
+
+// PSRAM en priorité, RAM interne en repli
+static constexpr uint32_t BLOB_CAPS_PSRAM = MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT;
+static constexpr uint32_t BLOB_CAPS_RAM   = MALLOC_CAP_8BIT;
+static constexpr size_t   BLOB_MIN_CAP    = 4096;
+static constexpr size_t   ROW_MAX         = 32;     // "4294967295,-12345.67\n"
+
+static SemaphoreHandle_t cacheMutex = nullptr;
+
+GraphCache::Entry GraphCache::entries[ENTRY_COUNT];
+uint32_t GraphCache::useClock = 0;
+uint32_t GraphCache::hits     = 0;
+uint32_t GraphCache::appends  = 0;
+uint32_t GraphCache::misses   = 0;
+PerfCounter GraphCache::queryPerf;
+
+GraphBlob::~GraphBlob()
+{
+    if (data) heap_caps_free(data);
+}
+
+// -----------------------------------------------------------------------------
+// Initialisation
+// -----------------------------------------------------------------------------
+void GraphCache::init()
+{
+    if (!cacheMutex) {
+        cacheMutex = xSemaphoreCreateMutex();
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Requête : cache à jour → aucune lecture flash
+//           données ajoutées → lecture depuis le dernier offset seulement
+// -----------------------------------------------------------------------------
+bool GraphCache::query(DataId id, uint32_t daysBack, Result& out)
+{
+    if (!cacheMutex) return false;
+
+    uint32_t startUs = micros();
+    uint32_t cutoffTime = 0;
+    if (daysBack > 0) {
+        // Sans UTC, pas de fenêtre calculable (nowUtc() = 0 → cutoff négatif
+        // bouclé) : résultat vide, rien en cache
+        if (!Clock::isUtcValid()) {
+            out = Result();
+            queryPerf.record(micros() - startUs, 0);
+            return true;
+        }
+        uint32_t now = Clock::nowUtc();
+        uint32_t span = daysBack * 86400UL;
+        cutoffTime = now > span ? now - span : 0;
+    }
+
+    // Sérialise les parcours : une requête identique concurrente attend ici
+    // puis trouve l'entrée fraîche
+    xSemaphoreTake(cacheMutex, portMAX_DELAY);
+
+    Entry* e = findOrEvict(id, daysBack);
+    bool ok = true;
+
+    // Fenêtre reculée (horloge corrigée en arrière) : les lignes écartées au
+    // parcours précédent manquent, la lecture incrémentale ne les rattrape pas
+    if (e->used && cutoffTime < e->cutoffTime) {
+        e->used = false;
+    }
+
+    if (e->used && e->dataVersion == DataLogger::getDataVersion()) {
+        hits++;
+    } else {
+        ok = refresh(*e, cutoffTime);
+    }
+
+    if (ok) {
+        e->lastUse = ++useClock;
+        trimFront(*e, cutoffTime);
+        if (cutoffTime > e->cutoffTime) e->cutoffTime = cutoffTime;
+
+        out.blob   = e->blob;
+        out.offset = e->start;
+        out.length = e->blob ? e->blob->len - e->start : 0;
+        out.rows   = e->rows;
+    }
+
+    queryPerf.record(micros() - startUs, ok ? out.rows : 0);
+    xSemaphoreGive(cacheMutex);
+    return ok;
+}
+
+void GraphCache::invalidate()
+{
+    if (!cacheMutex) return;
+
+    xSemaphoreTake(cacheMutex, portMAX_DELAY);
+    for (uint8_t i = 0; i < ENTRY_COUNT; i++) {
+        entries[i] = Entry();
+    }
+    xSemaphoreGive(cacheMutex);
+}
+
+// -----------------------------------------------------------------------------
+// LRU
+// -----------------------------------------------------------------------------
+GraphCache::Entry* GraphCache::findOrEvict(DataId id, uint32_t daysBack)
+{
+    Entry* victim = &entries[0];
+
+    for (uint8_t i = 0; i < ENTRY_COUNT; i++) {
+        Entry& e = entries[i];
+        if (e.used && e.id == id && e.daysBack == daysBack) {
+            return &e;
+        }
+        if (!e.used) {
+            if (victim->used) victim = &e;
+        } else if (victim->used && e.lastUse < victim->lastUse) {
+            victim = &e;
+        }
+    }
+
+    // Une réponse en cours garde son propre shared_ptr sur l'ancien tampon
+    *victim = Entry();
+    victim->id = id;
+    victim->daysBack = daysBack;
+    return victim;
+}
+
+// -----------------------------------------------------------------------------
+// Rafraîchissement depuis /datalog.csv
+// -----------------------------------------------------------------------------
+bool GraphCache::refresh(Entry& e, uint32_t cutoffTime)
+{
+    // Version lue AVANT le parcours : un flush concurrent sera relu au prochain appel
+    uint32_t version = DataLogger::getDataVersion();
+
+    File file = FileSystem::fs().open("/datalog.csv", FILE_READ);
+    if (!file) {
+        // Pas d'historique : résultat vide mais valide
+        e.used = true;
+        e.dataVersion = version;
+        e.fileOffset = 0;
+        e.cutoffTime = cutoffTime;
+        e.start = 0;
+        e.rows = 0;
+        e.blob.reset();
+        return true;
+    }
+
+    // Fichier tronqué ou recréé depuis la dernière lecture : repartir de zéro
+    if (!e.used || file.size() < e.fileOffset) {
+        e.fileOffset = 0;
+        e.cutoffTime = cutoffTime;
+        e.start = 0;
+        e.rows = 0;
+        if (e.blob) {
+            if (e.blob.use_count() == 1) e.blob->len = 0;
+            else e.blob.reset();
+        }
+        misses++;
+    } else {
+        appends++;
+    }
+
+    if (e.fileOffset > 0 && !file.seek(e.fileOffset)) {
+        file.close();
+        return false;
+    }
+
+    struct Scan {
+        Entry* entry;
+        uint32_t cutoffTime;
+        bool full;
+    } scan = { &e, cutoffTime, false };
+
+    uint32_t consumed = 0;
+    CsvLogReader::forEach(file, [](const CsvRecord& rec, void* ctx) {
+        Scan& s = *static_cast<Scan*>(ctx);
+        Entry& en = *s.entry;
+
+        if (rec.id != static_cast<uint8_t>(en.id) || rec.isText) return true;
+        if (en.daysBack > 0 && rec.timestamp < s.cutoffTime) return true;
+
+        if (!appendRow(en, rec.timestamp, rec.value)) {
+            s.full = true;
+            return false;
+        }
+        return true;
+    }, &scan, &consumed);
+
+    file.close();
+
+    if (scan.full) {
+        LOG_ERROR(TAG, "Mémoire insuffisante pour la série %u", (unsigned)e.id);
+        e = Entry();
+        return false;
+    }
+
+    e.used = true;
+    e.dataVersion = version;
+    e.fileOffset += consumed;
+    return true;
+}
+
+// Fenêtre glissante : les lignes sont chronologiques, on avance le début
+void GraphCache::trimFront(Entry& e, uint32_t cutoffTime)
+{
+    if (e.daysBack == 0 || !e.blob) return;
+
+    const char* data = e.blob->data;
+    size_t len = e.blob->len;
+
+    while (e.start < len) {
+        uint32_t ts = strtoul(data + e.start, nullptr, 10);
+        if (ts >= cutoffTime) break;
+
+        const char* nl = (const char*)memchr(data + e.start, '\n', len - e.start);
+        e.start = nl ? (size_t)(nl - data) + 1 : len;
+        e.rows--;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Tampon
+// -----------------------------------------------------------------------------
+bool GraphCache::appendRow(Entry& e, uint32_t timestamp, float value)
+{
+    if (!reserve(e, ROW_MAX)) return false;
+
+    GraphBlob& b = *e.blob;
+    int n = snprintf(b.data + b.len, b.cap - b.len, "%lu,%.2f\n",
+                     (unsigned long)timestamp, value);
+    if (n <= 0) return true;
+
+    b.len += n;
+    e.rows++;
+    return true;
+}
+
+// Garantit extra octets libres en fin de tampon
+// Tampon partagé avec une réponse en cours : seul l'espace libre au-delà de
+// len est écrit ; s'il faut réallouer, on copie plutôt que de déplacer
+bool GraphCache::reserve(Entry& e, size_t extra)
+{
+    if (e.blob && e.blob->len + extra <= e.blob->cap) return true;
+
+    size_t used = e.blob ? e.blob->len - e.start : 0;
+    size_t cap = e.blob ? e.blob->cap * 2 : BLOB_MIN_CAP;
+    while (cap < used + extra) cap *= 2;
+
+    if (e.blob && e.blob.use_count() == 1) {
+        // Seul propriétaire : compactage puis réallocation sur place
+        GraphBlob& b = *e.blob;
+        if (e.start > 0) {
+            memmove(b.data, b.data + e.start, used);
+            b.len = used;
+            e.start = 0;
+            if (b.len + extra <= b.cap) return true;
+        }
+        char* p = (char*)heap_caps_realloc(b.data, cap, BLOB_CAPS_PSRAM);
+        if (!p) p = (char*)heap_caps_realloc(b.data, cap, BLOB_CAPS_RAM);
+        if (!p) return false;
+        b.data = p;
+        b.cap = cap;
+        return true;
+    }
+
+    std::shared_ptr<GraphBlob> fresh = std::make_shared<GraphBlob>();
+    fresh->data = (char*)heap_caps_malloc(cap, BLOB_CAPS_PSRAM);
+    if (!fresh->data) fresh->data = (char*)heap_caps_malloc(cap, BLOB_CAPS_RAM);
+    if (!fresh->data) return false;
+    fresh->cap = cap;
+
+    if (used > 0) {
+        memcpy(fresh->data, e.blob->data + e.start, used);
+    }
+    fresh->len = used;
+    e.start = 0;
+    e.blob = fresh;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Monitoring
+// -----------------------------------------------------------------------------
+uint32_t GraphCache::getHitCount()    { return hits; }
+uint32_t GraphCache::getAppendCount() { return appends; }
+uint32_t GraphCache::getMissCount()   { return misses; }
+const PerfCounter& GraphCache::getQueryPerf() { return queryPerf; }
@@ -0,0 +1,82 @@
+// Storage/GraphCache.h
+// Cache RAM (PSRAM) des séries de graphe extraites de /datalog.csv
+//
+// - Clé : (DataId, fenêtre en jours) ; validité : version DataLogger
+// - LRU de ENTRY_COUNT entrées, lignes "timestamp,valeur\n" en PSRAM
+// - Rafraîchissement incrémental : seules les lignes ajoutées depuis le
+//   dernier offset lu sont parsées, la fenêtre glissante est rognée en tête
+// - Mutex unique : des requêtes identiques simultanées attendent le premier
+//   calcul puis lisent le résultat en cache (un seul parcours du fichier)
+// - Résultat partagé (shared_ptr) : une réponse HTTP en cours de diffusion
+//   reste valide même si l'entrée est rafraîchie ou évincée entre-temps
+
+#pragma once
+#include <Arduino.h>
+#include <memory>
+#include "Storage/DataLogger.h"
+#include "Utils/PerfCounter.h"
+
+// Tampon de lignes CSV (PSRAM si disponible)
+struct GraphBlob {
+    char*  data = nullptr;
+    size_t len  = 0;
+    size_t cap  = 0;
+    ~GraphBlob();
+};
+
+class GraphCache {
+public:
+    static constexpr uint8_t ENTRY_COUNT = 4;
+
+    // Vue immuable sur le résultat d'une requête
+    struct Result {
+        std::shared_ptr<const GraphBlob> blob;  // nullptr si vide ou erreur
+        size_t offset = 0;                      // Début de la fenêtre dans blob
+        size_t length = 0;                      // Octets de lignes CSV
+        uint32_t rows = 0;
+    };
+
+    // Cycle de vie (avant le serveur web)
+    static void init();
+
+    // Lignes numériques de id sur les daysBack derniers jours (0 = tout)
+    // Bloquant le temps d'un éventuel parcours du fichier
+    static bool query(DataId id, uint32_t daysBack, Result& out);
+
+    // Historique supprimé : toutes les entrées sont reconstruites
+    static void invalidate();
+
+    // Monitoring
+    static uint32_t getHitCount();       // Servi sans lecture flash
+    static uint32_t getAppendCount();    // Rafraîchi par lecture incrémentale
+    static uint32_t getMissCount();      // Parcours complet du fichier
+    static const PerfCounter& getQueryPerf();   // query(), attente du mutex incluse
+
+private:
+    struct Entry {
+        bool     used = false;
+        DataId   id = DataId::Count;
+        uint32_t daysBack = 0;
+        uint32_t dataVersion = 0;        // Version DataLogger lors du dernier rafraîchissement
+        uint32_t fileOffset = 0;         // Octets de /datalog.csv déjà parsés
+        uint32_t cutoffTime = 0;         // Début de fenêtre le plus récent appliqué
+        uint32_t lastUse = 0;            // Horloge LRU
+        size_t   start = 0;              // Première ligne dans la fenêtre
+        uint32_t rows = 0;               // Lignes dans [start, blob->len)
+        std::shared_ptr<GraphBlob> blob;
+    };
+
+    static Entry* findOrEvict(DataId id, uint32_t daysBack);
+    static bool refresh(Entry& e, uint32_t cutoffTime);
+    static void trimFront(Entry& e, uint32_t cutoffTime);
+    static bool appendRow(Entry& e, uint32_t timestamp, float value);
+    static bool reserve(Entry& e, size_t extra);
+
+    static Entry entries[ENTRY_COUNT];
+    static uint32_t useClock;
+
+    static uint32_t hits;
+    static uint32_t appends;
+    static uint32_t misses;
+    static PerfCounter queryPerf;
+};
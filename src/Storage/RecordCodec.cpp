@@ -0,0 +1,224 @@
+// Storage/RecordCodec.cpp
+// Encodeur / décodeur de trames binaires (voir format dans RecordCodec.h)
+// Aucune allocation : l'encodeur regroupe les échantillons par passes successives
+
+#include "Storage/RecordCodec.h"
+
+#include <string.h>
+#include <math.h>
+
+// -----------------------------------------------------------------------------
+// Helpers varint (LEB128 non signé) + zigzag
+// -----------------------------------------------------------------------------
+
+namespace {
+
+struct Writer {
+    uint8_t* out;
+    size_t   size;
+    size_t   pos;
+    bool     overflow;
+
+    void byte(uint8_t b)
+    {
+        if (pos >= size) { overflow = true; return; }
+        out[pos++] = b;
+    }
+
+    void varint(uint32_t v)
+    {
+        while (v >= 0x80) {
+            byte((uint8_t)(v | 0x80));
+            v >>= 7;
+        }
+        byte((uint8_t)v);
+    }
+
+    void svarint(int32_t v)
+    {
+        // zigzag : 0,-1,1,-2,2... → 0,1,2,3,4...
+        varint(((uint32_t)v << 1) ^ (uint32_t)(v >> 31));
+    }
+
+    void bytes(const char* data, size_t len)
+    {
+        if (pos + len > size) { overflow = true; return; }
+        memcpy(out + pos, data, len);
+        pos += len;
+    }
+};
+
+struct Reader {
+    const uint8_t* in;
+    size_t         len;
+    size_t         pos;
+    bool           error;
+
+    uint8_t byte()
+    {
+        if (pos >= len) { error = true; return 0; }
+        return in[pos++];
+    }
+
+    uint32_t varint()
+    {
+        uint32_t v = 0;
+        for (int shift = 0; shift < 35; shift += 7) {
+            uint8_t b = byte();
+            if (error) return 0;
+            v |= (uint32_t)(b & 0x7F) << shift;
+            if ((b & 0x80) == 0) return v;
+        }
+        error = true;  // varint > 5 octets
+        return 0;
+    }
+
+    int32_t svarint()
+    {
+        uint32_t v = varint();
+        return (int32_t)((v >> 1) ^ (~(v & 1) + 1));
+    }
+};
+
+bool sameGroup(const CodecSample& a, const CodecSample& b)
+{
+    return a.id == b.id && a.type == b.type && a.isText == b.isText;
+}
+
+} // namespace
+
+// -----------------------------------------------------------------------------
+// Quantification
+// -----------------------------------------------------------------------------
+int32_t RecordCodec::quantize(float value)
+{
+    if (isnan(value)) return MILLI_NAN;
+    if (value >  2147483.0f) return INT32_MAX;
+    if (value < -2147483.0f) return MILLI_NAN + 1;
+    return (int32_t)lroundf(value * 1000.0f);
+}
+
+float RecordCodec::dequantize(int32_t milli)
+{
+    if (milli == MILLI_NAN) return NAN;
+    return milli / 1000.0f;
+}
+
+// -----------------------------------------------------------------------------
+// ENCODE
+// Un groupe par (id, type, nature), dans l'ordre de première apparition ;
+// l'ordre chronologique est conservé à l'intérieur de chaque groupe
+// -----------------------------------------------------------------------------
+size_t RecordCodec::encode(const CodecSample* samples, size_t count, uint8_t* out, size_t outSize)
+{
+    Writer w{out, outSize, 0, false};
+
+    uint32_t baseTs = count > 0 ? samples[0].timestamp : 0;
+    for (size_t i = 1; i < count; i++) {
+        if (samples[i].timestamp < baseTs) baseTs = samples[i].timestamp;
+    }
+
+    // Nombre de groupes
+    uint32_t groups = 0;
+    for (size_t i = 0; i < count; i++) {
+        bool seen = false;
+        for (size_t j = 0; j < i && !seen; j++) {
+            seen = sameGroup(samples[j], samples[i]);
+        }
+        if (!seen) groups++;
+    }
+
+    w.byte(MAGIC);
+    w.byte(VERSION);
+    w.varint(baseTs);
+    w.varint(groups);
+
+    for (size_t i = 0; i < count && !w.overflow; i++) {
+        // Premier échantillon d'un groupe pas encore écrit ?
+        bool seen = false;
+        for (size_t j = 0; j < i && !seen; j++) {
+            seen = sameGroup(samples[j], samples[i]);
+        }
+        if (seen) continue;
+
+        const CodecSample& head = samples[i];
+        uint32_t n = 0;
+        for (size_t k = i; k < count; k++) {
+            if (sameGroup(samples[k], head)) n++;
+        }
+
+        w.byte(head.id);
+        w.byte((uint8_t)((head.type << 1) | (head.isText ? 1 : 0)));
+        w.varint(n);
+
+        uint32_t prevTs = baseTs;
+        int32_t prevMilli = 0;
+
+        for (size_t k = i; k < count; k++) {
+            const CodecSample& s = samples[k];
+            if (!sameGroup(s, head)) continue;
+
+            w.svarint((int32_t)(s.timestamp - prevTs));
+            prevTs = s.timestamp;
+
+            if (s.isText) {
+                w.varint(s.textLen);
+                w.bytes(s.text, s.textLen);
+            } else {
+                w.svarint((int32_t)((uint32_t)s.milli - (uint32_t)prevMilli));
+                prevMilli = s.milli;
+            }
+        }
+    }
+
+    return w.overflow ? 0 : w.pos;
+}
+
+// -----------------------------------------------------------------------------
+// DECODE
+// -----------------------------------------------------------------------------
+bool RecordCodec::decode(const uint8_t* in, size_t len, DecodeCallback cb, void* ctx)
+{
+    Reader r{in, len, 0, false};
+
+    if (r.byte() != MAGIC || r.byte() != VERSION || r.error) {
+        return false;
+    }
+
+    uint32_t baseTs = r.varint();
+    uint32_t groups = r.varint();
+
+    for (uint32_t g = 0; g < groups && !r.error; g++) {
+        CodecSample s;
+        s.id = r.byte();
+        uint8_t flags = r.byte();
+        s.type = flags >> 1;
+        s.isText = (flags & 1) != 0;
+        uint32_t n = r.varint();
+
+        uint32_t ts = baseTs;
+        int32_t milli = 0;
+
+        for (uint32_t k = 0; k < n && !r.error; k++) {
+            ts += (uint32_t)r.svarint();
+            s.timestamp = ts;
+
+            if (s.isText) {
+                uint32_t textLen = r.varint();
+                if (r.error || textLen > r.len - r.pos || textLen > 0xFFFF) {
+                    return false;
+                }
+                s.text = (const char*)(r.in + r.pos);
+                s.textLen = (uint16_t)textLen;
+                r.pos += textLen;
+            } else {
+                milli = (int32_t)((uint32_t)milli + (uint32_t)r.svarint());
+                s.milli = milli;
+            }
+
+            if (!r.error && cb) cb(s, ctx);
+        }
+    }
+
+    return !r.error && r.pos == len;
+}
@@ -0,0 +1,64 @@
+// Storage/RecordCodec.h
+// Encodage binaire compact d'un lot d'enregistrements (uplink cellulaire)
+//
+// Module portable : aucune dépendance Arduino, compilable tel quel sur un
+// hôte (g++ -std=c++17 RecordCodec.cpp) pour décoder les trames reçues.
+//
+// Format de trame (version 1) :
+//   [MAGIC][VERSION][varint baseTs][varint nbGroupes]
+//   pour chaque groupe (même id + type + nature) :
+//     [id][type << 1 | texte][varint nbÉchantillons]
+//     pour chaque échantillon :
+//       zigzag varint  Δtimestamp (vs échantillon précédent du groupe, 1er vs baseTs)
+//       numérique : zigzag varint Δvaleur en millièmes (vs précédent, 1er vs 0),
+//                   INT32_MIN réservé à NaN (mesure absente), hors plage écrêtée
+//       texte     : varint longueur + octets
+//
+// Gain typique vs CSV : ~3 octets par mesure périodique au lieu de ~24
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// ─────────────────────────────────────────────
+// Échantillon (vue neutre d'un DataRecord)
+// ─────────────────────────────────────────────
+// text : non possédé. À l'encodage, pointe sur la valeur de l'appelant ;
+//        au décodage, pointe DANS la trame (non terminé par '\0')
+// ─────────────────────────────────────────────
+
+struct CodecSample {
+    uint32_t    timestamp = 0;
+    uint8_t     type      = 0;      // DataType
+    uint8_t     id        = 0;      // DataId
+    bool        isText    = false;
+    int32_t     milli     = 0;      // Valeur numérique × 1000 (quantifiée, MILLI_NAN = NaN)
+    const char* text      = nullptr;
+    uint16_t    textLen   = 0;
+};
+
+// ─────────────────────────────────────────────
+// RecordCodec
+// ─────────────────────────────────────────────
+
+class RecordCodec {
+public:
+    static constexpr uint8_t MAGIC   = 0xC5;
+    static constexpr uint8_t VERSION = 1;
+
+    typedef void (*DecodeCallback)(const CodecSample& sample, void* ctx);
+
+    // Quantification float ↔ millièmes (même précision que le CSV : %.3f)
+    // NaN ↔ MILLI_NAN ; au-delà de ±2147483 : écrêté à INT32_MAX / INT32_MIN + 1
+    static constexpr int32_t MILLI_NAN = INT32_MIN;
+    static int32_t quantize(float value);
+    static float   dequantize(int32_t milli);
+
+    // Encode count échantillons dans out
+    // Retourne la taille de la trame, 0 si outSize est insuffisant
+    static size_t encode(const CodecSample* samples, size_t count, uint8_t* out, size_t outSize);
+
+    // Décode une trame complète, cb appelé pour chaque échantillon
+    // (ordre : groupe par groupe). Retourne false si trame invalide/tronquée.
+    static bool decode(const uint8_t* in, size_t len, DecodeCallback cb, void* ctx);
+};
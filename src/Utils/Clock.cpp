@@ -0,0 +1,25 @@
+// Utils/Clock.cpp
+#include "Utils/Clock.h"
+#include "Connectivity/ManagerUTC.h"
+
+// Horloge système : millis() + ManagerUTC
+static uint32_t systemNowMs() { return millis(); }
+
+static const ClockSource systemSource = {
+    systemNowMs,
+    ManagerUTC::isUtcValid,
+    ManagerUTC::nowUtc,
+    ManagerUTC::convertFromRelative
+};
+
+const ClockSource* Clock::source = &systemSource;
+
+uint32_t Clock::nowMs()                       { return source->nowMs(); }
+bool     Clock::isUtcValid()                  { return source->isUtcValid(); }
+time_t   Clock::nowUtc()                      { return source->nowUtc(); }
+time_t   Clock::utcFromRelative(uint32_t relMs) { return source->utcFromRelative(relMs); }
+
+void Clock::setSource(const ClockSource* newSource)
+{
+    source = newSource ? newSource : &systemSource;
+}
@@ -0,0 +1,31 @@
+// Utils/Clock.h
+// Horloge injectable : temps relatif (millis) et UTC (ManagerUTC)
+//
+// Les modules de stockage lisent le temps ici plutôt que directement via
+// millis() / ManagerUTC, ce qui permet de les exécuter avec une horloge
+// simulée (banc de test, rejeu accéléré d'un historique).
+
+#pragma once
+#include <Arduino.h>
+#include <time.h>
+
+struct ClockSource {
+    uint32_t (*nowMs)();
+    bool     (*isUtcValid)();
+    time_t   (*nowUtc)();
+    time_t   (*utcFromRelative)(uint32_t relMs);
+};
+
+class Clock {
+public:
+    static uint32_t nowMs();
+    static bool     isUtcValid();
+    static time_t   nowUtc();
+    static time_t   utcFromRelative(uint32_t relMs);
+
+    // nullptr : retour à l'horloge système
+    static void setSource(const ClockSource* source);
+
+private:
+    static const ClockSource* source;
+};
@@ -1,11 +1,40 @@
 #include "Logger.h"
 
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
 Stream* Logger::_output = nullptr;
 Logger::Level Logger::_currentLevel = Logger::Level::INFO;
 
+Logger::MirrorCapture Logger::_mirrorCapture = nullptr;
+Logger::MirrorPersist Logger::_mirrorPersist = nullptr;
+Logger::Level Logger::_mirrorLevel = Logger::Level::WARN;
+
+char     Logger::_ring[Logger::RING_SIZE];
+size_t   Logger::_head = 0;
+size_t   Logger::_tail = 0;
+size_t   Logger::_highWater = 0;
+uint32_t Logger::_dropped = 0;
+uint32_t Logger::_droppedReported = 0;
+
+// Section critique très courte (memcpy ≤ LINE_MAX) : sûre depuis n'importe
+// quelle tâche, y compris AsyncTCP sur l'autre cœur
+static portMUX_TYPE ringMux = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t drainHandle = nullptr;
+
+// Tâche de vidage : cœur 0 (la loop Arduino monopolise le cœur 1 sans céder)
+static constexpr uint32_t    DRAIN_TASK_STACK    = 3072;
+static constexpr UBaseType_t DRAIN_TASK_PRIORITY = 1;
+static constexpr BaseType_t  DRAIN_TASK_CORE     = 0;
+
 void Logger::begin(Stream& output, Level level) {
     _output = &output;
     _currentLevel = level;
+
+    if (drainHandle == nullptr) {
+        xTaskCreatePinnedToCore(drainTask, "logger", DRAIN_TASK_STACK, nullptr,
+                                DRAIN_TASK_PRIORITY, &drainHandle, DRAIN_TASK_CORE);
+    }
 }
 
 void Logger::setLevel(Level level) {
@@ -16,6 +45,20 @@ Logger::Level Logger::getLevel() {
     return _currentLevel;
 }
 
+void Logger::setMirror(MirrorCapture capture, MirrorPersist persist, Level maxLevel) {
+    _mirrorLevel = maxLevel;
+    _mirrorPersist = persist;
+    _mirrorCapture = capture;
+}
+
+uint32_t Logger::getDroppedCount() {
+    return _dropped;
+}
+
+size_t Logger::getBufferHighWater() {
+    return _highWater;
+}
+
 // ---------- API publique sans tag ----------
 
 void Logger::error(const String& message) { log(Level::ERROR, "", message); }
@@ -35,26 +78,145 @@ void Logger::trace(const String& tag, const String& message) { log(Level::TRACE,
 // ---------- Implémentation centrale ----------
 
 void Logger::log(Level level, const String& tag, const String& message) {
-    if (_output == nullptr) return;
-    if (level > _currentLevel) return;
+    if (!isEnabled(level)) return;
+
+    logf(level, tag.c_str(), "%s", message.c_str());
+}
+
+void Logger::logf(Level level, const char* tag, const char* fmt, ...) {
+    if (!isEnabled(level)) return;
+
+    va_list args;
+    va_start(args, fmt);
+
+    if (_mirrorCapture != nullptr && level <= _mirrorLevel) {
+        va_list copy;
+        va_copy(copy, args);
+        _mirrorCapture(level, tag, fmt, copy);
+        va_end(copy);
+    }
+
+    vlogf(level, tag, fmt, args);
+    va_end(args);
+}
+
+void Logger::vlogf(Level level, const char* tag, const char* fmt, va_list args) {
+    // Formatage hors section critique (pile de l'appelant)
+    char line[LINE_MAX];
+    int len;
+
+    if (tag != nullptr && tag[0] != '\0') {
+        len = snprintf(line, sizeof(line), "[%lu ms] %s [%s] ",
+                       (unsigned long)millis(), levelToString(level), tag);
+    } else {
+        len = snprintf(line, sizeof(line), "[%lu ms] %s ",
+                       (unsigned long)millis(), levelToString(level));
+    }
+    if (len < 0) return;
+
+    // snprintf retourne la longueur voulue : en-tête tronqué (tag long) borné
+    size_t pos = (size_t)len;
+    if (pos > sizeof(line) - 3) pos = sizeof(line) - 3;
+
+    // Message (réserve 2 octets pour la fin de ligne), s'il reste de la place
+    size_t room = sizeof(line) - 2 - pos;
+    if (room > 1) {
+        int msgLen = vsnprintf(line + pos, room, fmt, args);
+        if (msgLen < 0) return;
+
+        pos += (size_t)msgLen;
+        if (pos > sizeof(line) - 3) pos = sizeof(line) - 3;  // Tronqué
+    }
+    line[pos++] = '\r';
+    line[pos++] = '\n';
+
+    push(line, pos);
 
-    // Timestamp simple (millis)
-    unsigned long timestamp = millis();
+    if (drainHandle != nullptr) {
+        xTaskNotifyGive(drainHandle);
+    }
+}
 
-    _output->print("[");
-    _output->print(timestamp);
-    _output->print(" ms] ");
+void Logger::push(const char* data, size_t len) {
+    portENTER_CRITICAL(&ringMux);
 
-    _output->print(levelToString(level));
+    size_t used = (_head + RING_SIZE - _tail) % RING_SIZE;
+    size_t freeSpace = RING_SIZE - 1 - used;
 
-    if (!tag.isEmpty()) {
-        _output->print(" [");
-        _output->print(tag);
-        _output->print("]");
+    if (len > freeSpace) {
+        _dropped++;
+        portEXIT_CRITICAL(&ringMux);
+        return;
     }
 
-    _output->print(" ");
-    _output->println(message);
+    size_t first = RING_SIZE - _head;
+    if (first > len) first = len;
+    memcpy(_ring + _head, data, first);
+    memcpy(_ring, data + first, len - first);
+    _head = (_head + len) % RING_SIZE;
+
+    if (used + len > _highWater) _highWater = used + len;
+
+    portEXIT_CRITICAL(&ringMux);
+}
+
+// Copie un bloc hors du ring puis l'écrit sans verrou
+// Retourne le nombre d'octets écrits (0 = buffer vide)
+size_t Logger::drainOnce() {
+    char chunk[DRAIN_CHUNK];
+    size_t n;
+
+    portENTER_CRITICAL(&ringMux);
+    size_t used = (_head + RING_SIZE - _tail) % RING_SIZE;
+    n = used < DRAIN_CHUNK ? used : DRAIN_CHUNK;
+
+    size_t first = RING_SIZE - _tail;
+    if (first > n) first = n;
+    memcpy(chunk, _ring + _tail, first);
+    memcpy(chunk + first, _ring, n - first);
+    _tail = (_tail + n) % RING_SIZE;
+    portEXIT_CRITICAL(&ringMux);
+
+    if (n > 0) {
+        _output->write((const uint8_t*)chunk, n);
+    }
+    return n;
+}
+
+void Logger::drainTask(void* arg) {
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(DRAIN_PERIOD_MS));
+
+        while (drainOnce() > 0) {
+        }
+
+        // Miroir persistant (E/S flash hors chemins chauds)
+        if (_mirrorPersist != nullptr) {
+            _mirrorPersist();
+        }
+
+        // Pertes signalées une fois le buffer vidé (place garantie)
+        uint32_t dropped = _dropped;
+        if (dropped != _droppedReported) {
+            char line[64];
+            int len = snprintf(line, sizeof(line), "[%lu ms] WARN  [Logger] %lu message(s) perdu(s)\r\n",
+                               (unsigned long)millis(), (unsigned long)(dropped - _droppedReported));
+            _droppedReported = dropped;
+            if (len > 0) _output->write((const uint8_t*)line, (size_t)len);
+        }
+    }
+}
+
+void Logger::flush() {
+    if (_output == nullptr) return;
+
+    while (drainOnce() > 0) {
+    }
+    _output->flush();
+
+    if (_mirrorPersist != nullptr) {
+        _mirrorPersist();
+    }
 }
 
 const char* Logger::levelToString(Level level) {
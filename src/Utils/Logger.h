@@ -1,6 +1,29 @@
 #pragma once
 
 #include <Arduino.h>
+#include <stdarg.h>
+
+// Logger asynchrone :
+// - les appels formatent la ligne dans un ring buffer préalloué (section
+//   critique de quelques µs, aucune écriture Serial dans l'appelant)
+// - une tâche FreeRTOS basse priorité vide le buffer vers la sortie
+// - buffer plein : message abandonné et compté (jamais de blocage)
+//
+// Chemins chauds : macros LOG_ERROR/WARN/INFO/DEBUG/TRACE(tag, fmt, ...)
+// - niveaux > LOG_MIN_LEVEL supprimés à la compilation (build flag)
+// - arguments évalués et formatés seulement si le niveau est actif
+//   (aucune allocation String pour un log filtré)
+
+// Niveaux compilés (build_flags : -DLOG_MIN_LEVEL=LOG_LEVEL_INFO, ...)
+#define LOG_LEVEL_ERROR 0
+#define LOG_LEVEL_WARN  1
+#define LOG_LEVEL_INFO  2
+#define LOG_LEVEL_DEBUG 3
+#define LOG_LEVEL_TRACE 4
+
+#ifndef LOG_MIN_LEVEL
+#define LOG_MIN_LEVEL LOG_LEVEL_TRACE
+#endif
 
 class Logger {
 public:
@@ -12,7 +35,7 @@ public:
         TRACE
     };
 
-    // Initialisation globale
+    // Initialisation globale (démarre la tâche de vidage)
     static void begin(Stream& output, Level level = Level::INFO);
 
     // Configuration
@@ -33,10 +56,101 @@ public:
     static void debug(const String& tag, const String& message);
     static void trace(const String& tag, const String& message);
 
+    // Format printf, rendu après filtrage du niveau (voir macros LOG_*)
+    static void logf(Level level, const char* tag, const char* fmt, ...)
+        __attribute__((format(printf, 3, 4)));
+
+    // Niveau actif à l'exécution (sortie configurée + niveau courant)
+    static inline bool isEnabled(Level level) {
+        return _output != nullptr && level <= _currentLevel;
+    }
+
+    // Miroir optionnel (journal persistant) pour les niveaux ≤ maxLevel
+    // capture : contexte de l'appelant (rapide, sans E/S)
+    // persist : appelé par la tâche de vidage (E/S flash autorisées)
+    typedef void (*MirrorCapture)(Level level, const char* tag, const char* fmt, va_list args);
+    typedef void (*MirrorPersist)();
+    static void setMirror(MirrorCapture capture, MirrorPersist persist, Level maxLevel = Level::WARN);
+
+    // Vidage synchrone (avant reboot volontaire)
+    static void flush();
+
+    // Monitoring
+    static uint32_t getDroppedCount();      // Messages perdus (buffer plein)
+    static size_t   getBufferHighWater();   // Occupation max du buffer (octets)
+
 private:
+    // Configuration
+    static constexpr size_t   RING_SIZE       = 4096;   // Octets en attente de sortie
+    static constexpr size_t   LINE_MAX        = 256;    // Ligne formatée max (tronquée)
+    static constexpr size_t   DRAIN_CHUNK     = 128;    // Octets écrits par passe
+    static constexpr uint32_t DRAIN_PERIOD_MS = 50;     // Réveil de secours de la tâche
+
     static void log(Level level, const String& tag, const String& message);
+    static void vlogf(Level level, const char* tag, const char* fmt, va_list args);
+    static void push(const char* data, size_t len);
+    static size_t drainOnce();
+    static void drainTask(void* arg);
     static const char* levelToString(Level level);
 
     static Stream* _output;
     static Level _currentLevel;
+
+    static MirrorCapture _mirrorCapture;
+    static MirrorPersist _mirrorPersist;
+    static Level _mirrorLevel;
+
+    // Ring buffer (producteurs multiples, consommateur unique)
+    static char     _ring[RING_SIZE];
+    static size_t   _head;          // Prochaine écriture
+    static size_t   _tail;          // Prochaine lecture
+    static size_t   _highWater;
+    static uint32_t _dropped;       // Total depuis le boot
+    static uint32_t _droppedReported;
 };
+
+// ---------- Macros (élision à la compilation) ----------
+
+#define LOGGER_EMIT_(lvl, tag, fmt, ...)                                   \
+    do {                                                                    \
+        if (Logger::isEnabled(Logger::Level::lvl))                          \
+            Logger::logf(Logger::Level::lvl, tag, fmt, ##__VA_ARGS__);      \
+    } while (0)
+
+// Niveau supprimé : code mort éliminé par le compilateur, format toujours
+// vérifié et variables toujours "utilisées" (pas de warning)
+#define LOGGER_NOP_(tag, fmt, ...)                                          \
+    do {                                                                    \
+        if (false)                                                          \
+            Logger::logf(Logger::Level::ERROR, tag, fmt, ##__VA_ARGS__);    \
+    } while (0)
+
+#if LOG_MIN_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_ERROR(tag, fmt, ...) LOGGER_EMIT_(ERROR, tag, fmt, ##__VA_ARGS__)
+#else
+#define LOG_ERROR(tag, fmt, ...) LOGGER_NOP_(tag, fmt, ##__VA_ARGS__)
+#endif
+
+#if LOG_MIN_LEVEL >= LOG_LEVEL_WARN
+#define LOG_WARN(tag, fmt, ...) LOGGER_EMIT_(WARN, tag, fmt, ##__VA_ARGS__)
+#else
+#define LOG_WARN(tag, fmt, ...) LOGGER_NOP_(tag, fmt, ##__VA_ARGS__)
+#endif
+
+#if LOG_MIN_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO(tag, fmt, ...) LOGGER_EMIT_(INFO, tag, fmt, ##__VA_ARGS__)
+#else
+#define LOG_INFO(tag, fmt, ...) LOGGER_NOP_(tag, fmt, ##__VA_ARGS__)
+#endif
+
+#if LOG_MIN_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(tag, fmt, ...) LOGGER_EMIT_(DEBUG, tag, fmt, ##__VA_ARGS__)
+#else
+#define LOG_DEBUG(tag, fmt, ...) LOGGER_NOP_(tag, fmt, ##__VA_ARGS__)
+#endif
+
+#if LOG_MIN_LEVEL >= LOG_LEVEL_TRACE
+#define LOG_TRACE(tag, fmt, ...) LOGGER_EMIT_(TRACE, tag, fmt, ##__VA_ARGS__)
+#else
+#define LOG_TRACE(tag, fmt, ...) LOGGER_NOP_(tag, fmt, ##__VA_ARGS__)
+#endif
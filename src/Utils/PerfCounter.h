@@ -0,0 +1,87 @@
+// Utils/PerfCounter.h
+// Statistiques de durée d'une opération (instrumentation embarquée)
+//
+// - Nombre d'appels, éléments traités, durée totale / max
+// - Percentiles via histogramme log-linéaire des durées en µs
+//   (4 cases par puissance de 2 : précision ~25 %, 496 octets, aucun
+//   échantillon stocké, enregistrement O(1) sans allocation)
+// - Écrit par une seule tâche ; lecture concurrente (page web) tolérée :
+//   valeurs de monitoring, une incohérence ponctuelle est sans conséquence
+
+#pragma once
+#include <Arduino.h>
+
+class PerfCounter {
+public:
+    void record(uint32_t us, uint32_t items = 1)
+    {
+        calls++;
+        totalItems += items;
+        totalUs += us;
+        if (us > maxUs) maxUs = us;
+        buckets[bucketOf(us)]++;
+    }
+
+    uint32_t getCalls() const      { return calls; }
+    uint64_t getItems() const      { return totalItems; }
+    uint64_t getTotalUs() const    { return totalUs; }
+    uint32_t getMaxUs() const      { return maxUs; }
+
+    // Borne haute de la case contenant le pct-ième percentile (0 si vide)
+    uint32_t percentileUs(uint8_t pct) const
+    {
+        if (calls == 0) return 0;
+        uint64_t rank = ((uint64_t)calls * pct + 99) / 100;
+        if (rank == 0) rank = 1;
+
+        uint64_t seen = 0;
+        for (uint8_t i = 0; i < BUCKET_COUNT; i++) {
+            seen += buckets[i];
+            if (seen >= rank) {
+                uint32_t upper = upperBoundOf(i);
+                return upper < maxUs ? upper : maxUs;
+            }
+        }
+        return maxUs;
+    }
+
+    // {"calls":N,"items":N,"totalUs":N,"p50Us":N,"p99Us":N,"maxUs":N}
+    void writeJson(Print& out) const
+    {
+        out.printf("{\"calls\":%lu,\"items\":%llu,\"totalUs\":%llu,"
+                   "\"p50Us\":%lu,\"p99Us\":%lu,\"maxUs\":%lu}",
+                   (unsigned long)calls,
+                   (unsigned long long)totalItems,
+                   (unsigned long long)totalUs,
+                   (unsigned long)percentileUs(50),
+                   (unsigned long)percentileUs(99),
+                   (unsigned long)maxUs);
+    }
+
+private:
+    static constexpr uint8_t BUCKET_COUNT = 124;   // 0..3 exacts, puis 4 par octave
+
+    static uint8_t bucketOf(uint32_t us)
+    {
+        if (us < 4) return (uint8_t)us;
+        uint8_t msb = 31 - __builtin_clz(us);
+        uint8_t sub = (us >> (msb - 2)) & 3;
+        return (uint8_t)((msb - 1) * 4 + sub);
+    }
+
+    static uint32_t upperBoundOf(uint8_t index)
+    {
+        if (index < 4) return index;
+        uint8_t msb = index / 4 + 1;
+        uint8_t sub = index % 4;
+        uint64_t lower = (uint64_t)(4 + sub) << (msb - 2);
+        uint64_t upper = lower + ((uint64_t)1 << (msb - 2)) - 1;
+        return upper > 0xFFFFFFFFull ? 0xFFFFFFFFul : (uint32_t)upper;
+    }
+
+    uint32_t calls = 0;
+    uint64_t totalItems = 0;
+    uint64_t totalUs = 0;
+    uint32_t maxUs = 0;
+    uint32_t buckets[BUCKET_COUNT] = {};
+};
@@ -0,0 +1,412 @@
+// Web/Assets/WebAssets.h
+// GÉNÉRÉ par scripts/embed_web_assets.py depuis web/ — ne pas modifier
+
+#pragma once
+#include <Arduino.h>
+
+struct WebAsset {
+    const char*    path;       // URL servie
+    const char*    mime;
+    const uint8_t* data;       // Contenu gzip (PROGMEM)
+    size_t         length;
+    const char*    etag;       // Hash du contenu (guillemets inclus)
+    bool           immutable;  // URL versionnée (?v=hash) → cache long
+};
+
+// app.css : 1561 octets → 602 octets gzip
+static const uint8_t ASSET_APP_CSS[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x54, 0xc9, 0x6e, 0xdb, 0x30,
+    0x10, 0xbd, 0xe7, 0x2b, 0x88, 0x18, 0x05, 0x62, 0xb4, 0x12, 0x68, 0x79, 0x89, 0x2d, 0x9d, 0x8a,
+    0x5e, 0xfb, 0x01, 0xbd, 0x8e, 0xc8, 0xb1, 0x44, 0x98, 0x26, 0x05, 0x92, 0xf2, 0xd2, 0x22, 0xff,
+    0x5e, 0x52, 0x4b, 0x18, 0x2f, 0x81, 0x63, 0x40, 0x80, 0x28, 0x73, 0xe6, 0xbd, 0x79, 0xf3, 0x66,
+    0x4a, 0xcd, 0xcf, 0xe4, 0x1f, 0xd9, 0x6a, 0xe5, 0x92, 0x2d, 0xec, 0x85, 0x3c, 0xe7, 0xe4, 0xa7,
+    0x11, 0x20, 0x0b, 0x52, 0x02, 0xdb, 0x55, 0x46, 0xb7, 0x8a, 0xe7, 0x64, 0x32, 0xdb, 0xbc, 0xae,
+    0x78, 0x56, 0x10, 0xa6, 0xa5, 0x36, 0x39, 0x39, 0xd6, 0xc2, 0x61, 0x41, 0x1c, 0x9e, 0x5c, 0x02,
+    0x52, 0x54, 0x2a, 0x27, 0x0c, 0x95, 0x43, 0x53, 0x90, 0x3d, 0x98, 0x4a, 0xf8, 0x33, 0x2d, 0x48,
+    0x03, 0x9c, 0x0b, 0x55, 0xe5, 0x24, 0xa3, 0xcd, 0xa9, 0x20, 0x6f, 0x4f, 0xf5, 0xcc, 0x63, 0x5d,
+    0xe4, 0xa5, 0x7c, 0xf1, 0x0a, 0xb3, 0x9b, 0xab, 0xa5, 0x36, 0x1c, 0x4d, 0x62, 0x80, 0x8b, 0xd6,
+    0xe6, 0x64, 0x36, 0xc4, 0xa7, 0x0c, 0x0c, 0xbf, 0x4a, 0x61, 0xaa, 0x12, 0x5e, 0xb2, 0xe5, 0xf2,
+    0xc7, 0xf8, 0xd0, 0x34, 0x9b, 0x46, 0x1a, 0x21, 0x1f, 0x81, 0xd6, 0xe9, 0xf0, 0xe9, 0x94, 0x1c,
+    0x05, 0x77, 0x75, 0x4e, 0x56, 0xb4, 0xcb, 0xf8, 0x00, 0x75, 0xf9, 0x01, 0x35, 0x65, 0x52, 0xb0,
+    0x1d, 0x94, 0x12, 0x3d, 0x3e, 0x6b, 0x8d, 0x0d, 0x32, 0x34, 0x5a, 0xf4, 0x45, 0x3b, 0x03, 0xca,
+    0x0a, 0x27, 0xb4, 0x47, 0x8c, 0xe4, 0x08, 0x4d, 0xe7, 0xf6, 0x4e, 0x86, 0xbc, 0xd6, 0x07, 0x34,
+    0x8f, 0xeb, 0x98, 0x4f, 0xbb, 0xe0, 0x03, 0xc8, 0x16, 0xc7, 0x26, 0x59, 0xf1, 0x17, 0x3d, 0xb5,
+    0x74, 0x8d, 0xfb, 0xa2, 0xff, 0x72, 0x44, 0x51, 0xd5, 0xce, 0xe3, 0x6a, 0xc9, 0xbb, 0xfb, 0xb6,
+    0x2d, 0x43, 0x63, 0xae, 0x23, 0xb2, 0x10, 0xd1, 0xcb, 0x92, 0x38, 0xdd, 0xc4, 0xfa, 0xec, 0x1e,
+    0xa4, 0xbc, 0xbc, 0x4d, 0xfb, 0xfc, 0x21, 0xd9, 0x51, 0x38, 0x56, 0xfb, 0x7f, 0x1b, 0x3d, 0x16,
+    0x68, 0x50, 0x82, 0x13, 0x07, 0xdf, 0x7f, 0x2e, 0x6c, 0x23, 0xc1, 0x5b, 0x46, 0x28, 0x29, 0x14,
+    0x26, 0xa5, 0xd4, 0x6c, 0x57, 0x90, 0x41, 0xe4, 0x4d, 0x27, 0x6a, 0x3d, 0xd0, 0x5b, 0x2c, 0x06,
+    0x35, 0x87, 0x8c, 0x42, 0x35, 0x6d, 0xe0, 0xa8, 0x1b, 0x60, 0xc2, 0x9d, 0x3b, 0xc3, 0x0c, 0x81,
+    0x34, 0x46, 0xd1, 0x3e, 0x44, 0x0a, 0xde, 0x09, 0x16, 0x49, 0x40, 0x69, 0xb5, 0x6c, 0x83, 0x09,
+    0x6f, 0x9a, 0x21, 0x94, 0xc5, 0x3e, 0x34, 0xea, 0x9b, 0x0c, 0xc6, 0x9d, 0x30, 0xc6, 0x2e, 0xdb,
+    0x95, 0x2e, 0xec, 0x4d, 0xe7, 0x23, 0xd7, 0x0e, 0x38, 0x2f, 0x71, 0xab, 0x0d, 0x7e, 0x86, 0xef,
+    0x65, 0xf3, 0xde, 0xcf, 0xc9, 0xf3, 0x73, 0xe4, 0x3d, 0x5f, 0x85, 0x0c, 0x43, 0x3d, 0xfd, 0x41,
+    0xe2, 0x36, 0xc8, 0xd0, 0x1b, 0xcd, 0x39, 0xbd, 0x1f, 0x0f, 0x37, 0x24, 0xc7, 0xe9, 0x7a, 0xc0,
+    0x72, 0x49, 0xbf, 0x05, 0x92, 0x9d, 0x90, 0x39, 0xab, 0x91, 0xed, 0x90, 0x93, 0xef, 0x24, 0xaa,
+    0x75, 0xa7, 0xfc, 0x71, 0xde, 0x3e, 0x0d, 0x8b, 0xb5, 0x76, 0xf0, 0xfe, 0xdd, 0xf3, 0xec, 0x5e,
+    0x7d, 0xd3, 0xf1, 0xcf, 0xcb, 0xc2, 0xd7, 0x32, 0x8d, 0xf1, 0xde, 0x01, 0xc1, 0xd1, 0x97, 0xb8,
+    0xb1, 0xa5, 0xe9, 0x32, 0xf6, 0x87, 0xe3, 0x16, 0x5a, 0xe9, 0x42, 0xec, 0xa4, 0x32, 0xd0, 0xd4,
+    0xbf, 0xbc, 0x70, 0xe0, 0x6d, 0x13, 0x42, 0xde, 0x9d, 0xa4, 0xb4, 0xc2, 0x2f, 0x4e, 0xef, 0x83,
+    0xe9, 0xd9, 0x4c, 0xbf, 0x3a, 0xe0, 0xd7, 0x74, 0x18, 0xa8, 0x03, 0x58, 0xcf, 0xea, 0x03, 0xe6,
+    0x8c, 0xf6, 0x6a, 0x0f, 0x77, 0xa5, 0xb6, 0x78, 0xbd, 0xcb, 0xd8, 0x2a, 0x5b, 0x67, 0xeb, 0xeb,
+    0x1d, 0xd9, 0x63, 0x8e, 0x85, 0xbd, 0x13, 0x0a, 0x2b, 0xed, 0x3e, 0xab, 0x8e, 0xd4, 0x8d, 0xa9,
+    0x2f, 0x06, 0x97, 0x5e, 0xf0, 0x0e, 0x5c, 0xee, 0xae, 0x94, 0xc9, 0x1a, 0xa9, 0xff, 0xc5, 0xab,
+    0xbf, 0x35, 0x04, 0xf4, 0xb0, 0xc1, 0x06, 0x3f, 0xcc, 0xe7, 0xf3, 0xe2, 0xce, 0x9a, 0x78, 0x7b,
+    0xfa, 0x0f, 0x64, 0xb0, 0xc6, 0x69, 0x19, 0x06, 0x00, 0x00,
+};
+
+// app.js : 8670 octets → 2862 octets gzip
+static const uint8_t ASSET_APP_JS[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x59, 0xdb, 0x72, 0xdb, 0xb8,
+    0x19, 0xbe, 0xf7, 0x53, 0x20, 0xb3, 0xb3, 0x4b, 0xb2, 0x91, 0x69, 0xd9, 0x4e, 0xb2, 0x1b, 0x7b,
+    0xbd, 0x99, 0x1c, 0x9c, 0x43, 0xc7, 0xd9, 0x78, 0x22, 0x27, 0xed, 0x4e, 0x9a, 0xe9, 0x40, 0x24,
+    0x24, 0x21, 0xa1, 0x48, 0x2e, 0x01, 0xca, 0xf1, 0xec, 0x7a, 0xa6, 0xb7, 0xbd, 0xef, 0x13, 0xf4,
+    0xa6, 0xf5, 0x73, 0xf8, 0x4d, 0xfa, 0x24, 0xfd, 0x7e, 0x00, 0x24, 0x41, 0x49, 0x56, 0xd2, 0x9b,
+    0x4e, 0x34, 0x89, 0x4c, 0x01, 0xff, 0x19, 0xff, 0x11, 0xdc, 0xd9, 0x61, 0x67, 0x7c, 0x9c, 0x09,
+    0x5e, 0xb3, 0x54, 0xb0, 0x71, 0x51, 0xa5, 0xec, 0x80, 0x25, 0xc5, 0xaf, 0xb5, 0xcc, 0x32, 0xc1,
+    0x94, 0xe6, 0x5a, 0xfe, 0x5a, 0x0b, 0x16, 0x26, 0x3c, 0x99, 0x09, 0x96, 0xf3, 0x85, 0x9c, 0x72,
+    0x2d, 0xea, 0x2a, 0x62, 0xb7, 0xd9, 0x82, 0x67, 0x78, 0x52, 0x6c, 0x87, 0x97, 0x72, 0x87, 0x40,
+    0x6b, 0xb5, 0xb5, 0x35, 0xa9, 0xf3, 0x44, 0xcb, 0x22, 0x67, 0xba, 0x98, 0x4e, 0x33, 0x31, 0xd2,
+    0x3c, 0x4c, 0xc6, 0x11, 0xfb, 0x6d, 0x8b, 0x81, 0x6c, 0xae, 0x34, 0x2b, 0x79, 0xc5, 0xe7, 0x8a,
+    0x1d, 0xb1, 0x5c, 0x9c, 0xb3, 0x37, 0xaf, 0x4f, 0x46, 0x82, 0x57, 0xc9, 0xec, 0xd4, 0xac, 0x86,
+    0xd1, 0x21, 0xe0, 0xe4, 0x04, 0xfc, 0xc6, 0x31, 0x18, 0x26, 0x1f, 0x45, 0x6a, 0x71, 0x99, 0xc3,
+    0x8b, 0x79, 0x59, 0x8a, 0x3c, 0x0d, 0x03, 0xe2, 0x27, 0x82, 0x01, 0x0b, 0x76, 0x03, 0x83, 0x74,
+    0x89, 0xff, 0x13, 0xa1, 0x93, 0x59, 0x18, 0xec, 0x9c, 0xcb, 0x89, 0xdc, 0xb6, 0xfc, 0x01, 0xf1,
+    0x1b, 0x9b, 0x0b, 0x3d, 0x2b, 0xd2, 0x03, 0x16, 0x9c, 0xbe, 0x1a, 0x9d, 0x61, 0x65, 0x5c, 0xa4,
+    0x17, 0x07, 0x8d, 0x20, 0x97, 0x40, 0xbf, 0x5c, 0x91, 0xfb, 0x61, 0xd9, 0x8a, 0x4d, 0xe2, 0xdc,
+    0x5a, 0x95, 0xa7, 0x61, 0xc6, 0xcb, 0xcf, 0xb3, 0x5a, 0xab, 0xaa, 0xe1, 0x4c, 0x82, 0xaf, 0x72,
+    0x7f, 0xa6, 0xe6, 0xff, 0x7f, 0xab, 0x4d, 0xd5, 0xfc, 0x7f, 0x35, 0xda, 0xce, 0x0e, 0xfb, 0xcf,
+    0x3f, 0xfe, 0xf6, 0x35, 0xfc, 0x23, 0x51, 0xde, 0x3a, 0x7f, 0x4c, 0x8a, 0xba, 0xe2, 0xb9, 0x16,
+    0xea, 0x6b, 0x92, 0xaf, 0x3b, 0xe2, 0x49, 0x51, 0xcd, 0xb9, 0x7e, 0xa3, 0x93, 0x50, 0xfb, 0x27,
+    0x9c, 0xba, 0xc3, 0x7d, 0x82, 0x13, 0x0a, 0x35, 0xfb, 0x03, 0xdb, 0x1d, 0x0e, 0x87, 0xe6, 0x90,
+    0x9c, 0x07, 0xd0, 0x3e, 0x3b, 0xfa, 0x89, 0x8d, 0x74, 0x25, 0xf3, 0x69, 0x98, 0x47, 0x71, 0xc9,
+    0x53, 0xc4, 0x57, 0xa5, 0xc3, 0x3d, 0x9c, 0xe8, 0xd0, 0x9e, 0x68, 0x25, 0x74, 0x5d, 0xe5, 0xac,
+    0x0c, 0xd3, 0x78, 0x2a, 0xb4, 0x21, 0x16, 0x51, 0xb0, 0x06, 0x3b, 0x01, 0xbe, 0xdd, 0xf2, 0xcb,
+    0x22, 0xd7, 0xb3, 0x90, 0x96, 0x77, 0x57, 0xf6, 0x9e, 0xd6, 0x59, 0xf6, 0x0b, 0xbc, 0x0b, 0xdb,
+    0xdf, 0x92, 0x0c, 0x00, 0x30, 0x9e, 0x64, 0x3e, 0x01, 0xf3, 0x20, 0x9f, 0xc3, 0xce, 0xca, 0x51,
+    0x3f, 0xf0, 0xa9, 0xcb, 0xbc, 0x86, 0xf5, 0xb1, 0xd3, 0x8f, 0x2c, 0xab, 0xf8, 0x48, 0xe6, 0x89,
+    0x08, 0xe7, 0xca, 0xea, 0x9e, 0x09, 0xcd, 0xc8, 0xad, 0x5f, 0x72, 0x3d, 0x8b, 0x27, 0x59, 0x51,
+    0x54, 0xd8, 0x62, 0x3b, 0x9d, 0xf2, 0x04, 0x30, 0xef, 0x03, 0xd0, 0xfe, 0x3d, 0xec, 0x02, 0xf1,
+    0xdb, 0x23, 0x3c, 0x35, 0x60, 0xb3, 0x25, 0x3a, 0x0d, 0xd8, 0xbc, 0x03, 0x73, 0xd6, 0x09, 0x9e,
+    0x88, 0xb2, 0x96, 0xca, 0x28, 0x13, 0xce, 0xd8, 0x03, 0xa0, 0x42, 0x87, 0x19, 0x7e, 0xc3, 0xdf,
+    0x03, 0x52, 0x08, 0xd8, 0x0f, 0x80, 0x88, 0xd5, 0xb9, 0xb7, 0xaa, 0x68, 0x41, 0x05, 0x8d, 0xef,
+    0x3f, 0x2f, 0xaa, 0x22, 0xe5, 0x9a, 0x4f, 0x05, 0x20, 0xde, 0x9c, 0x3d, 0x66, 0x4a, 0x52, 0x52,
+    0x94, 0xa9, 0x18, 0xe0, 0x31, 0x87, 0xca, 0xd7, 0xff, 0xc4, 0x5e, 0x25, 0x32, 0xa4, 0x51, 0x84,
+    0x27, 0x34, 0xaf, 0xae, 0xaf, 0xe6, 0x22, 0xd7, 0xd7, 0x57, 0x2c, 0x99, 0x71, 0xca, 0xac, 0x4a,
+    0xe0, 0x78, 0x53, 0x11, 0x75, 0x66, 0x52, 0x42, 0x9f, 0xc9, 0xb9, 0x08, 0x65, 0x3a, 0x60, 0x3d,
+    0x0f, 0x11, 0xd0, 0x2f, 0x2d, 0x92, 0x9a, 0x08, 0x90, 0x9d, 0x8f, 0x33, 0x41, 0x8f, 0x8f, 0x2e,
+    0x5e, 0xa4, 0x00, 0x36, 0xd6, 0x12, 0x71, 0x92, 0x71, 0xa5, 0x4e, 0xa4, 0xd2, 0x71, 0x25, 0xe6,
+    0xc5, 0x42, 0x84, 0x01, 0xc4, 0x0b, 0xda, 0x0c, 0x71, 0x4b, 0x37, 0x99, 0x41, 0xc4, 0x5a, 0x7c,
+    0xd2, 0x8f, 0xe1, 0x09, 0xa0, 0x01, 0xca, 0x41, 0x60, 0x12, 0x02, 0x13, 0x99, 0x12, 0x06, 0x54,
+    0xc7, 0xb5, 0x4e, 0xd8, 0xad, 0xa3, 0x23, 0x56, 0x43, 0xc0, 0x89, 0xcc, 0xbb, 0xac, 0xb2, 0x8c,
+    0xeb, 0xb9, 0x34, 0x21, 0x45, 0x1e, 0xa5, 0x06, 0xa1, 0x93, 0x8b, 0xa7, 0xa9, 0x27, 0x14, 0xed,
+    0x91, 0x0d, 0xa1, 0x75, 0x8c, 0xc5, 0x97, 0xe4, 0x0c, 0xee, 0xe9, 0x70, 0x03, 0x2f, 0xeb, 0x45,
+    0x0e, 0x70, 0x4d, 0x1e, 0x25, 0x23, 0x02, 0xcd, 0x1a, 0x11, 0x0f, 0x56, 0xf2, 0x0d, 0xd6, 0x5b,
+    0xe2, 0x42, 0xbf, 0xd6, 0x79, 0xef, 0x9b, 0x52, 0xd3, 0xd9, 0xe0, 0xd4, 0x54, 0x2f, 0x78, 0xf9,
+    0xc5, 0x92, 0x17, 0x13, 0x04, 0x1c, 0xf0, 0x87, 0x7b, 0x77, 0x86, 0xc6, 0x55, 0xe9, 0x27, 0xdc,
+    0xd0, 0xfc, 0xee, 0x82, 0x7a, 0x46, 0x21, 0xb4, 0x16, 0x71, 0xff, 0x5e, 0x0f, 0x8f, 0x7e, 0x76,
+    0x68, 0x73, 0x99, 0xaf, 0xc7, 0xba, 0xe7, 0xe3, 0xf4, 0x5c, 0xde, 0x48, 0x08, 0xef, 0xfd, 0x60,
+    0x9c, 0xde, 0xf2, 0x75, 0x3e, 0x7f, 0xdb, 0xd2, 0x73, 0xbe, 0x7e, 0xdb, 0xe2, 0x77, 0x8e, 0xde,
+    0x5a, 0xa0, 0x42, 0x09, 0x11, 0x60, 0x65, 0x15, 0x87, 0xff, 0xff, 0x49, 0x6e, 0x3f, 0x95, 0xad,
+    0x50, 0xe7, 0x90, 0x48, 0xc5, 0x54, 0x7b, 0x89, 0x6d, 0x73, 0x00, 0x54, 0x72, 0x46, 0xa6, 0x37,
+    0x08, 0x06, 0xe6, 0x3c, 0x6f, 0x9d, 0xc7, 0x58, 0x3a, 0xce, 0xa9, 0xeb, 0x48, 0x11, 0x64, 0xc1,
+    0x93, 0xeb, 0x2b, 0xc5, 0xc1, 0x61, 0x71, 0x7d, 0x85, 0x48, 0x33, 0x30, 0xa1, 0x81, 0xc1, 0x69,
+    0xe4, 0x22, 0xd1, 0x80, 0xfa, 0xee, 0x3b, 0x76, 0x1e, 0x57, 0x0a, 0xe1, 0x45, 0xee, 0x98, 0x23,
+    0x43, 0x11, 0xa2, 0xdb, 0x47, 0x2c, 0x85, 0x24, 0xb6, 0x83, 0x80, 0xe0, 0x2c, 0x7d, 0x34, 0x8f,
+    0x1a, 0x5a, 0x6c, 0x89, 0x96, 0x8f, 0x68, 0x22, 0xfb, 0xb5, 0x40, 0xcd, 0xac, 0xa8, 0xbd, 0x41,
+    0x70, 0x2a, 0x74, 0x42, 0x71, 0x1c, 0x07, 0x51, 0xb4, 0xa2, 0x84, 0x92, 0x29, 0xca, 0x20, 0xa8,
+    0x29, 0x17, 0x6c, 0xfe, 0xee, 0x8b, 0xd2, 0xee, 0xd1, 0x53, 0xbb, 0x49, 0x9e, 0x12, 0x90, 0x41,
+    0xe8, 0xc9, 0xec, 0x93, 0xf3, 0x98, 0xed, 0x9b, 0x3c, 0xd1, 0x70, 0x3a, 0x97, 0xa8, 0xc8, 0x41,
+    0xd4, 0xd4, 0x72, 0xd8, 0xd5, 0xb7, 0xd9, 0xe1, 0x96, 0xcf, 0x9b, 0x97, 0x8d, 0x75, 0x01, 0xc4,
+    0x4b, 0xcf, 0xae, 0x0f, 0x61, 0xd3, 0x89, 0xd1, 0xd0, 0xb7, 0x70, 0x5f, 0x72, 0x5e, 0x3a, 0xc1,
+    0xe9, 0xa1, 0x2f, 0x37, 0x2f, 0x57, 0xa5, 0xb6, 0x07, 0xcd, 0xcb, 0x0d, 0x89, 0x88, 0x04, 0x72,
+    0xf2, 0x13, 0x06, 0x2f, 0x7b, 0x5a, 0xb4, 0x02, 0xba, 0xbd, 0x54, 0x2a, 0x2b, 0xef, 0x11, 0xf9,
+    0x85, 0xb7, 0x6b, 0x1d, 0xec, 0xd9, 0xe8, 0x65, 0xcb, 0x75, 0x6a, 0xdc, 0x0b, 0x4d, 0x4a, 0x27,
+    0x48, 0x2a, 0x34, 0x97, 0x19, 0x45, 0xc2, 0xbb, 0xf7, 0x6d, 0x82, 0x9b, 0xc6, 0xc2, 0x12, 0x69,
+    0x92, 0x55, 0xab, 0x2c, 0x70, 0x5b, 0x5b, 0xad, 0xda, 0xc4, 0xcb, 0x7c, 0xa0, 0x91, 0x34, 0xfe,
+    0xb2, 0x99, 0xca, 0x7a, 0xdf, 0x59, 0x49, 0x7f, 0x6b, 0x91, 0xa7, 0x71, 0x3a, 0x9e, 0x6f, 0x72,
+    0x68, 0x0b, 0xe0, 0xf9, 0xb3, 0xef, 0xb9, 0x2e, 0x79, 0x92, 0xb8, 0xd3, 0xb8, 0x28, 0x45, 0xc5,
+    0x75, 0x81, 0xae, 0xdc, 0x99, 0x24, 0x2e, 0x6b, 0x85, 0x9e, 0xee, 0x55, 0x79, 0x7d, 0x55, 0x99,
+    0x7e, 0x9d, 0x90, 0x0d, 0xc9, 0x16, 0xd4, 0xc7, 0x97, 0xe5, 0x32, 0xe6, 0x8b, 0xd3, 0x16, 0x43,
+    0x96, 0x6d, 0xab, 0xe8, 0x4e, 0x22, 0xdd, 0x74, 0xfe, 0x50, 0xf1, 0x89, 0x25, 0x65, 0x65, 0x9c,
+    0xa6, 0x6b, 0x0b, 0x4d, 0xc3, 0x0e, 0x69, 0xf5, 0x18, 0xb3, 0x45, 0x18, 0x66, 0x28, 0x30, 0x03,
+    0x26, 0x23, 0x6a, 0x71, 0x7e, 0x6b, 0x65, 0xc3, 0x6f, 0x10, 0xb0, 0xed, 0xeb, 0xe3, 0x99, 0xcc,
+    0xd2, 0xb0, 0x65, 0x9c, 0x54, 0x02, 0xaa, 0x39, 0xde, 0x61, 0x30, 0xae, 0x5c, 0xd0, 0xb2, 0xcf,
+    0x60, 0xd0, 0x49, 0xfc, 0x5c, 0xa4, 0xc2, 0x70, 0xb4, 0x28, 0x97, 0x8d, 0xa4, 0x4a, 0x5f, 0x64,
+    0x82, 0xbc, 0xb2, 0xcc, 0xf8, 0x05, 0x69, 0xe9, 0xa4, 0xcc, 0x44, 0x3e, 0xd5, 0xd4, 0x28, 0x04,
+    0xe6, 0x18, 0x50, 0xda, 0x45, 0xd0, 0x8b, 0x16, 0x68, 0xed, 0xc2, 0x65, 0xfa, 0x05, 0x41, 0x4e,
+    0x6e, 0xb0, 0x1a, 0xe4, 0xad, 0xe7, 0x36, 0xee, 0xff, 0x30, 0x93, 0x84, 0xc3, 0x29, 0xfb, 0xf6,
+    0xfa, 0x40, 0x9c, 0x52, 0x71, 0x2e, 0xaa, 0x5e, 0x28, 0xe3, 0x4b, 0x54, 0x39, 0xcf, 0x4e, 0x69,
+    0x07, 0x72, 0x94, 0x71, 0xb3, 0xc2, 0x8e, 0x3c, 0x1f, 0x23, 0xf9, 0x43, 0x6f, 0x0f, 0x4b, 0xaf,
+    0x6a, 0x69, 0xb4, 0xfa, 0xb9, 0xc8, 0xbd, 0xbc, 0x67, 0xd4, 0xea, 0x11, 0x75, 0x0a, 0x96, 0x8d,
+    0x82, 0xad, 0x48, 0x63, 0x23, 0xd2, 0x98, 0x6b, 0x00, 0x5f, 0xf4, 0x84, 0x72, 0x6b, 0x27, 0xb0,
+    0x34, 0x30, 0xc3, 0x71, 0xbc, 0x28, 0x32, 0xd3, 0x2f, 0xf9, 0x22, 0x0d, 0xe3, 0xe1, 0x90, 0x04,
+    0x68, 0x77, 0x63, 0x5d, 0x3c, 0x95, 0x9f, 0x44, 0x1a, 0xee, 0xd9, 0xe6, 0x92, 0xbd, 0x0d, 0xfc,
+    0x26, 0x74, 0xf9, 0x03, 0xb2, 0x70, 0xea, 0x84, 0xbc, 0xcb, 0x8f, 0x26, 0x1b, 0x44, 0xdd, 0x1e,
+    0x11, 0xfa, 0x36, 0x72, 0xcd, 0x5c, 0x5f, 0x4d, 0x27, 0xa6, 0x53, 0x70, 0xdc, 0x9d, 0x60, 0xab,
+    0x08, 0xba, 0xb5, 0x6a, 0x8a, 0xb6, 0xdb, 0x6c, 0x37, 0x3f, 0x56, 0x0d, 0xeb, 0xed, 0x61, 0xe9,
+    0x38, 0x67, 0xe6, 0xa7, 0x30, 0x4c, 0x4f, 0xb9, 0x62, 0xa2, 0x5d, 0x89, 0xa2, 0x7e, 0x1e, 0xaf,
+    0x4d, 0x63, 0x01, 0xf2, 0xfd, 0x3e, 0x23, 0xb6, 0xeb, 0xa3, 0xa8, 0x1d, 0xb8, 0xae, 0xff, 0x0e,
+    0x87, 0x68, 0x66, 0x1c, 0x16, 0xa2, 0x22, 0xe7, 0x52, 0x54, 0xfe, 0x10, 0x0e, 0x4d, 0x53, 0x01,
+    0x43, 0x2a, 0x54, 0xec, 0xeb, 0x7f, 0xd5, 0x86, 0x6b, 0x2a, 0x2b, 0xe4, 0x8d, 0x68, 0xcb, 0xf4,
+    0xdb, 0x16, 0xca, 0x8a, 0x7e, 0xd8, 0x2b, 0xf0, 0x93, 0x4a, 0xa8, 0x99, 0xcd, 0x50, 0xa1, 0xcd,
+    0x7c, 0xdd, 0x98, 0xdb, 0x90, 0x37, 0xd3, 0xa1, 0xb9, 0x0f, 0x30, 0x91, 0xb0, 0xad, 0x90, 0x4d,
+    0xa0, 0xe1, 0x65, 0x64, 0x4e, 0x28, 0xd6, 0x33, 0x91, 0x87, 0x20, 0x53, 0xc2, 0x35, 0x04, 0x05,
+    0x73, 0xf3, 0x1c, 0x7f, 0x50, 0x45, 0x8e, 0xa1, 0xc0, 0x03, 0x53, 0x26, 0xd8, 0x3b, 0x81, 0xd4,
+    0x61, 0xd7, 0x64, 0x1c, 0xb6, 0x14, 0x13, 0x4e, 0x22, 0x84, 0x36, 0x33, 0x7c, 0x95, 0x93, 0xe7,
+    0x29, 0x72, 0x26, 0xcb, 0xe4, 0x42, 0xb0, 0x70, 0x24, 0xaa, 0x85, 0xa8, 0xb6, 0x47, 0xe4, 0x71,
+    0xc7, 0x0b, 0x7c, 0xa3, 0x5d, 0x3a, 0x40, 0x07, 0x6d, 0x8f, 0x84, 0xe6, 0x67, 0x9a, 0xf0, 0xf8,
+    0x8b, 0x94, 0xcd, 0x8b, 0x14, 0xad, 0xc1, 0xf5, 0x15, 0x11, 0x78, 0x91, 0xa7, 0x32, 0x11, 0x64,
+    0x82, 0xa2, 0x4a, 0x2b, 0x41, 0x77, 0x31, 0x59, 0x20, 0xf2, 0x7a, 0xde, 0x00, 0x87, 0x23, 0x58,
+    0x19, 0xa1, 0xb1, 0x43, 0xbf, 0x4f, 0x30, 0xa5, 0x8b, 0x2a, 0x9e, 0x45, 0x5f, 0xe7, 0x80, 0xab,
+    0xe4, 0x14, 0x29, 0xe3, 0xac, 0x40, 0xd5, 0x0a, 0xed, 0xb3, 0x75, 0x25, 0xd7, 0x89, 0xba, 0x35,
+    0x13, 0x3c, 0xf7, 0xef, 0xb3, 0xdf, 0x7f, 0x77, 0x08, 0xec, 0x47, 0x36, 0xf4, 0x7e, 0xfd, 0xc4,
+    0xf6, 0x31, 0x9c, 0x3e, 0xb0, 0xf1, 0x75, 0xc0, 0xb6, 0x77, 0x77, 0xf7, 0xe1, 0xd8, 0x7b, 0x18,
+    0x8c, 0x2d, 0x80, 0x71, 0x03, 0x9b, 0x7f, 0x1e, 0x9e, 0x9e, 0x9e, 0xfc, 0xf2, 0xd7, 0x27, 0xc7,
+    0x27, 0x67, 0x0f, 0x61, 0x41, 0x62, 0x35, 0x3c, 0x40, 0x5a, 0x50, 0x03, 0xb6, 0x30, 0x23, 0x94,
+    0x75, 0xb2, 0x26, 0x41, 0x75, 0x39, 0x88, 0x2d, 0x0e, 0xbd, 0x65, 0x8a, 0x33, 0xea, 0xfc, 0xe1,
+    0x78, 0x03, 0x66, 0xf2, 0xef, 0x23, 0xbb, 0xf3, 0xd6, 0xc2, 0x83, 0xec, 0x6e, 0x43, 0x36, 0x22,
+    0xc7, 0x5c, 0x22, 0xdb, 0xe4, 0x19, 0xd7, 0x97, 0xeb, 0x0a, 0xf6, 0x08, 0x17, 0x91, 0x23, 0xd7,
+    0x7c, 0x3a, 0xb2, 0xa7, 0x16, 0x1e, 0x64, 0xf7, 0x36, 0x91, 0xed, 0x92, 0x0d, 0x5b, 0xc0, 0x28,
+    0xc3, 0xf8, 0xee, 0x12, 0xc5, 0x86, 0xec, 0x63, 0x07, 0x08, 0x82, 0xfb, 0xeb, 0xd4, 0x37, 0x25,
+    0xc3, 0x2b, 0x0a, 0x1d, 0xb9, 0x66, 0xcf, 0xb7, 0x00, 0x08, 0x1e, 0xfb, 0xc9, 0x9f, 0xb4, 0x87,
+    0x55, 0x57, 0xa8, 0x52, 0x7b, 0xeb, 0x37, 0xf4, 0x3d, 0xb2, 0x66, 0xd3, 0xa7, 0x4a, 0x54, 0x76,
+    0x37, 0x50, 0xe9, 0xda, 0xf4, 0xcf, 0xd3, 0xd9, 0xbb, 0x89, 0x4e, 0xd7, 0x05, 0x7f, 0x9e, 0xc8,
+    0xfe, 0xc1, 0xaa, 0xe5, 0x0d, 0xa0, 0x99, 0x25, 0xd6, 0x1c, 0x25, 0x21, 0xdd, 0x59, 0xc3, 0x19,
+    0x25, 0xbd, 0x29, 0xdf, 0x7d, 0xb6, 0xb4, 0xb1, 0xcc, 0xf5, 0xee, 0x0d, 0x04, 0x92, 0xf5, 0xea,
+    0xaf, 0x23, 0x71, 0x6f, 0x8d, 0xe0, 0x04, 0xd7, 0xf4, 0x77, 0xd6, 0xbb, 0x2d, 0xec, 0xf7, 0x37,
+    0xc0, 0xca, 0xd2, 0x87, 0xfa, 0xe1, 0x06, 0x28, 0x6a, 0x42, 0x8f, 0x7a, 0x41, 0xdd, 0x33, 0x8a,
+    0xb5, 0xca, 0x25, 0xea, 0x08, 0xd5, 0x16, 0x93, 0x04, 0x31, 0xa4, 0x73, 0x34, 0xbf, 0x7e, 0x69,
+    0x51, 0x74, 0x4f, 0x75, 0x82, 0xcd, 0xd0, 0xbb, 0x54, 0x3d, 0x97, 0x79, 0x5a, 0x9c, 0xc7, 0x26,
+    0x4d, 0x8e, 0x50, 0xd0, 0x12, 0x11, 0xb9, 0x24, 0xd1, 0xf5, 0xf8, 0xca, 0xac, 0xbb, 0xbb, 0x31,
+    0x0f, 0x12, 0x25, 0x49, 0x98, 0xf4, 0xea, 0x26, 0x1a, 0xb3, 0x18, 0x17, 0x39, 0xf4, 0xcf, 0x01,
+    0xed, 0xaa, 0x45, 0x23, 0x0f, 0x84, 0x15, 0x90, 0xb3, 0x07, 0x29, 0xaa, 0xca, 0x98, 0x69, 0x09,
+    0xd4, 0x8a, 0x0e, 0x58, 0x1b, 0x55, 0xaf, 0x85, 0x39, 0x94, 0x4f, 0xa4, 0x04, 0xaf, 0x75, 0x31,
+    0x77, 0x37, 0xe2, 0x69, 0xed, 0xdd, 0x86, 0x77, 0x64, 0x79, 0x9a, 0x1a, 0x21, 0xe9, 0xa6, 0x43,
+    0x80, 0x45, 0x18, 0xd0, 0xd0, 0x28, 0xfa, 0x4d, 0xed, 0x2d, 0x5b, 0xf0, 0x7c, 0x65, 0xfd, 0x5b,
+    0xc0, 0x3f, 0x8e, 0x5e, 0xfd, 0x1c, 0xa3, 0x50, 0x28, 0x11, 0xda, 0xbb, 0x91, 0xc8, 0x87, 0x40,
+    0x67, 0x9b, 0x51, 0x6b, 0xea, 0x25, 0xbd, 0x77, 0x69, 0x2c, 0xdf, 0x77, 0xfd, 0xbc, 0x81, 0x68,
+    0xe6, 0x16, 0x66, 0x11, 0x42, 0xcb, 0x72, 0xc0, 0xd2, 0x78, 0x41, 0x5f, 0xda, 0xd1, 0x64, 0x6d,
+    0xc1, 0xb5, 0x22, 0xd9, 0xd5, 0x4b, 0xd7, 0x13, 0x7f, 0x75, 0x85, 0xf6, 0x59, 0xc5, 0xcb, 0x99,
+    0xb1, 0xbf, 0x4d, 0x8f, 0x52, 0x7c, 0xa5, 0x25, 0x70, 0x56, 0x9c, 0xbb, 0x34, 0x6f, 0x44, 0x0e,
+    0xfd, 0xcb, 0x22, 0x7c, 0x63, 0xaa, 0x80, 0x73, 0x6c, 0x1c, 0xa3, 0x08, 0xed, 0x71, 0x03, 0x19,
+    0x78, 0xe3, 0x77, 0x56, 0xf0, 0xd4, 0xd6, 0x83, 0xcd, 0xc8, 0x27, 0x16, 0xce, 0x47, 0x4d, 0x78,
+    0xbe, 0xe0, 0x6a, 0x13, 0xa6, 0xab, 0x3a, 0x54, 0x4b, 0xb4, 0xc5, 0xb4, 0xc8, 0x56, 0x8c, 0x95,
+    0xf9, 0x28, 0x18, 0x67, 0x45, 0xf2, 0xd1, 0x8c, 0x42, 0x4e, 0xac, 0x4d, 0x20, 0x96, 0xfd, 0x2a,
+    0x44, 0x3b, 0x4e, 0xf9, 0x6f, 0x23, 0x48, 0x05, 0x72, 0xfe, 0xe0, 0xb3, 0x7d, 0x25, 0x8d, 0x97,
+    0xfd, 0xbe, 0x32, 0x51, 0x8b, 0x2e, 0xe2, 0x36, 0x88, 0xd6, 0x32, 0x36, 0xe1, 0x75, 0x83, 0x74,
+    0x9d, 0xfc, 0xf4, 0xd9, 0x6a, 0xeb, 0xed, 0x29, 0x45, 0x68, 0xc5, 0x32, 0xc1, 0x1e, 0x8f, 0xde,
+    0x36, 0x34, 0xec, 0x09, 0xc1, 0x56, 0x64, 0x65, 0x88, 0x81, 0x34, 0x29, 0xe7, 0x61, 0x14, 0x83,
+    0x9a, 0x44, 0x97, 0xff, 0x97, 0x3c, 0x68, 0x03, 0xcf, 0xc2, 0x52, 0x5e, 0xef, 0x6e, 0x30, 0xba,
+    0xf5, 0x05, 0xcf, 0xea, 0xa5, 0x0d, 0xf7, 0x07, 0x03, 0x02, 0x0b, 0x29, 0xd7, 0x52, 0x7d, 0xda,
+    0x3d, 0xc4, 0x9f, 0x1f, 0x2d, 0x47, 0x37, 0xa5, 0x62, 0xe5, 0xf6, 0x6d, 0xf8, 0x9b, 0x11, 0x72,
+    0xf4, 0x11, 0x49, 0x7e, 0x26, 0x78, 0x6a, 0x2a, 0xb8, 0xcf, 0x00, 0x09, 0x46, 0x13, 0x7d, 0x83,
+    0xfa, 0x4e, 0xbe, 0x6f, 0x44, 0x1c, 0x74, 0x12, 0xda, 0x74, 0x62, 0x00, 0x9b, 0x09, 0xf8, 0xa7,
+    0x23, 0xb6, 0xd7, 0xa5, 0x16, 0xfa, 0x18, 0x05, 0xec, 0xad, 0x81, 0xc9, 0x59, 0x2f, 0x30, 0x8c,
+    0x1b, 0x94, 0x77, 0xc3, 0xf7, 0x91, 0x47, 0x8a, 0x39, 0x95, 0x3c, 0xd0, 0xa7, 0x38, 0x98, 0x06,
+    0x78, 0xb7, 0x07, 0x7c, 0xb9, 0xd5, 0xff, 0xdb, 0x59, 0xfd, 0xac, 0xe2, 0xc9, 0xf5, 0x15, 0x8e,
+    0x34, 0x41, 0x0f, 0x13, 0x96, 0x59, 0xa1, 0x31, 0x57, 0x44, 0x03, 0xe4, 0xe6, 0xa4, 0xce, 0x91,
+    0x16, 0xe4, 0x38, 0x93, 0x85, 0x9e, 0x5d, 0xff, 0x9b, 0x92, 0x84, 0x6d, 0x76, 0x44, 0xe3, 0x06,
+    0xd0, 0xf4, 0x14, 0x08, 0xa1, 0x3d, 0xe9, 0x81, 0xa7, 0x86, 0x96, 0x3a, 0xa3, 0x71, 0xe6, 0xb9,
+    0xa4, 0x69, 0xc6, 0x24, 0x18, 0xa4, 0x6f, 0x45, 0xa1, 0xdc, 0x24, 0x1a, 0x16, 0xee, 0x0f, 0x99,
+    0x9b, 0xb6, 0x14, 0xfb, 0x40, 0x17, 0xa8, 0x91, 0xbb, 0xd2, 0x34, 0xc4, 0xf9, 0x58, 0x64, 0xa0,
+    0x70, 0xb6, 0x82, 0xf6, 0xd6, 0x07, 0x4b, 0x8a, 0xac, 0xa8, 0x00, 0xf6, 0xcd, 0xee, 0xfd, 0xef,
+    0xef, 0xa5, 0x7b, 0xde, 0xce, 0x44, 0x66, 0x84, 0x5f, 0x4d, 0xc7, 0x3c, 0xdc, 0xbb, 0x3b, 0x40,
+    0x9f, 0xf4, 0xc3, 0x80, 0xed, 0xed, 0x0e, 0x07, 0xe8, 0x02, 0x76, 0x7d, 0x12, 0x9f, 0x0e, 0xac,
+    0xcd, 0xbb, 0x95, 0x8b, 0x03, 0x67, 0x5b, 0x6f, 0xe9, 0xa5, 0xcc, 0x0f, 0xd8, 0x7e, 0x3c, 0xf4,
+    0x97, 0x38, 0x50, 0xef, 0xc4, 0x77, 0x3d, 0x52, 0x67, 0x32, 0xf9, 0xa8, 0x0e, 0x98, 0xb7, 0x64,
+    0xc7, 0xcf, 0x3f, 0x83, 0x07, 0x45, 0xd0, 0xea, 0x0b, 0x29, 0xcc, 0xe6, 0x27, 0x64, 0x7b, 0x41,
+    0xcb, 0xee, 0x55, 0x54, 0x30, 0xa9, 0xb6, 0x9f, 0xbe, 0x0e, 0x06, 0x3d, 0xbf, 0x48, 0x39, 0xc4,
+    0x0a, 0xf6, 0xb6, 0x53, 0x39, 0x95, 0xda, 0x13, 0x9f, 0x61, 0xf0, 0xc9, 0xf5, 0xec, 0x86, 0x3d,
+    0xba, 0x98, 0xbe, 0x09, 0xcd, 0xbc, 0x56, 0xf2, 0x36, 0x3b, 0x6f, 0x89, 0x1a, 0x77, 0x69, 0xea,
+    0x57, 0x6f, 0x72, 0x74, 0x85, 0x7e, 0x35, 0x1f, 0x2c, 0xdd, 0x4b, 0x1d, 0x57, 0x15, 0xdd, 0x94,
+    0x61, 0xf6, 0xb2, 0x33, 0x3a, 0x65, 0x45, 0x77, 0x0b, 0x66, 0x48, 0x34, 0xb4, 0xfb, 0xb7, 0xe2,
+    0x33, 0x99, 0x0a, 0x3f, 0xc7, 0x7f, 0x71, 0x46, 0xbf, 0x31, 0x1d, 0x81, 0xba, 0x12, 0x1a, 0x71,
+    0x84, 0x51, 0x92, 0x67, 0xcd, 0xe0, 0xeb, 0x93, 0x86, 0x7f, 0x56, 0x17, 0x23, 0x91, 0xa1, 0x57,
+    0x2c, 0xaa, 0x87, 0x59, 0x16, 0x06, 0xb1, 0x79, 0xa1, 0xd2, 0xde, 0xa6, 0x79, 0x0d, 0x87, 0x79,
+    0x81, 0x46, 0x81, 0xde, 0x46, 0xe7, 0xd2, 0x0b, 0x17, 0x67, 0x33, 0xc0, 0xdc, 0x3e, 0x32, 0x67,
+    0x7c, 0xd3, 0x6b, 0x99, 0xf9, 0x17, 0xbc, 0x91, 0x99, 0xab, 0xf6, 0x42, 0x0d, 0x43, 0x8a, 0x7b,
+    0x8b, 0xe7, 0xbf, 0x9c, 0x95, 0xb9, 0xd4, 0x12, 0xcf, 0x8a, 0x99, 0x37, 0x70, 0x65, 0x3b, 0x39,
+    0xa3, 0xd1, 0x2d, 0xf2, 0x94, 0xe6, 0xb2, 0xd4, 0xbe, 0x15, 0x23, 0x68, 0x5d, 0xd0, 0x9b, 0x44,
+    0x46, 0xe0, 0x88, 0x3e, 0xf3, 0x42, 0x57, 0xf1, 0x5c, 0xb1, 0x49, 0x56, 0x7f, 0x1a, 0xf8, 0xbb,
+    0x77, 0xc9, 0x3d, 0x18, 0x5f, 0x88, 0x84, 0x85, 0xb3, 0xf6, 0xb5, 0x1c, 0xf5, 0x3b, 0x75, 0x75,
+    0x7d, 0x65, 0x68, 0x4e, 0x0a, 0x7b, 0x62, 0xb9, 0x39, 0x93, 0x68, 0x6b, 0xe9, 0xb6, 0xe3, 0x70,
+    0xcb, 0xeb, 0x51, 0x9b, 0x6e, 0x96, 0x2b, 0x7d, 0x5a, 0x64, 0x99, 0x51, 0x9f, 0x1c, 0x3e, 0xce,
+    0x8b, 0x73, 0x03, 0xba, 0xf6, 0x7c, 0x5c, 0x62, 0x45, 0xd8, 0x17, 0xa9, 0xc9, 0xac, 0x50, 0xeb,
+    0x01, 0x04, 0xa7, 0x0f, 0x1c, 0xc9, 0x3c, 0x34, 0xf7, 0xd4, 0x1d, 0x35, 0xb6, 0xed, 0xf3, 0x41,
+    0x82, 0xb5, 0x04, 0x9a, 0x2c, 0x7b, 0xa3, 0x0c, 0xb6, 0x79, 0x5b, 0xd2, 0xc1, 0xbc, 0x07, 0x1b,
+    0xb0, 0xbb, 0xd6, 0xf0, 0xff, 0x05, 0xac, 0x70, 0x40, 0xe8, 0xde, 0x21, 0x00, 0x00,
+};
+
+// index.html : 2315 octets → 878 octets gzip
+static const uint8_t ASSET_INDEX_HTML[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x56, 0xc1, 0x6e, 0xe3, 0x36,
+    0x10, 0xbd, 0xe7, 0x2b, 0x58, 0x9e, 0x12, 0xa0, 0xb6, 0xd6, 0xd9, 0x66, 0xb3, 0x75, 0x24, 0x15,
+    0xa9, 0xb3, 0x09, 0x0c, 0x78, 0xb1, 0x01, 0x9c, 0xa2, 0xe8, 0x91, 0xa2, 0xc6, 0x16, 0x1b, 0x8a,
+    0x64, 0x49, 0xca, 0x8e, 0xf7, 0x54, 0xf4, 0x07, 0x7a, 0xec, 0xb1, 0xb7, 0x02, 0xf9, 0x83, 0xde,
+    0xf3, 0x27, 0xfd, 0x81, 0xf6, 0x13, 0x3a, 0xa4, 0x22, 0xc7, 0x4d, 0x6d, 0xef, 0x1e, 0x76, 0x4f,
+    0x32, 0xc9, 0x37, 0xf3, 0xde, 0x3c, 0x8e, 0x34, 0x4e, 0xbf, 0xb8, 0x78, 0x37, 0xba, 0xf9, 0xe1,
+    0xfa, 0x0d, 0xa9, 0x7c, 0x2d, 0xf3, 0x83, 0x34, 0x3c, 0x88, 0x64, 0x6a, 0x9e, 0xd1, 0x99, 0xa5,
+    0x61, 0x03, 0x58, 0x89, 0x8f, 0x1a, 0x3c, 0x23, 0xbc, 0x62, 0xd6, 0x81, 0xcf, 0xe8, 0x77, 0x37,
+    0x97, 0xbd, 0xd7, 0xb4, 0xdb, 0x56, 0xac, 0x86, 0x8c, 0x2e, 0x04, 0x2c, 0x8d, 0xb6, 0x9e, 0x12,
+    0xae, 0x95, 0x07, 0x85, 0xb0, 0xa5, 0x28, 0x7d, 0x95, 0x95, 0xb0, 0x10, 0x1c, 0x7a, 0x71, 0xf1,
+    0x25, 0x11, 0x4a, 0x78, 0xc1, 0x64, 0xcf, 0x71, 0x26, 0x21, 0x1b, 0x84, 0x24, 0x5e, 0x78, 0x09,
+    0xf9, 0x14, 0xac, 0x05, 0x52, 0x02, 0x79, 0xcb, 0xac, 0x80, 0xde, 0xb5, 0x08, 0xeb, 0x34, 0x69,
+    0x0f, 0x0f, 0x52, 0x29, 0xd4, 0x2d, 0xb1, 0x20, 0x33, 0xea, 0xfc, 0x4a, 0x82, 0xab, 0x00, 0x90,
+    0xaa, 0xb2, 0x30, 0xcb, 0x68, 0xc2, 0x1c, 0xca, 0x72, 0x09, 0x33, 0xa6, 0xcf, 0x9d, 0xfb, 0x66,
+    0x91, 0xf1, 0xd9, 0xeb, 0xe3, 0xe2, 0xf8, 0x55, 0x19, 0xd2, 0x3b, 0x6e, 0x85, 0xf1, 0xc4, 0x59,
+    0xfe, 0x84, 0x34, 0x52, 0xfb, 0xfe, 0x8f, 0x01, 0x09, 0x03, 0x38, 0x3d, 0x3d, 0x81, 0x13, 0x8a,
+    0xd4, 0x33, 0xb0, 0x79, 0x9a, 0xb4, 0xf8, 0x1d, 0x81, 0x81, 0x22, 0xc6, 0xbd, 0x1c, 0x9c, 0x9e,
+    0xbc, 0x7c, 0xc5, 0xd8, 0x96, 0xb8, 0xe4, 0xd1, 0xb3, 0x42, 0x97, 0xab, 0xfc, 0x00, 0x2d, 0x1c,
+    0xec, 0x2a, 0x0e, 0x4f, 0xf0, 0xbc, 0x14, 0x0b, 0xc2, 0x25, 0x12, 0x64, 0x94, 0x33, 0x1b, 0x34,
+    0x13, 0x92, 0x9a, 0xfc, 0xfb, 0xf1, 0xe5, 0x38, 0x4d, 0x4c, 0xbb, 0xea, 0x00, 0x0b, 0x26, 0x1b,
+    0xa0, 0x44, 0x94, 0xc1, 0x07, 0x36, 0xf5, 0xcc, 0x37, 0x8e, 0xe6, 0x7f, 0xfd, 0xfc, 0xc7, 0xff,
+    0x90, 0xae, 0x29, 0x3c, 0xdc, 0x79, 0x9a, 0x4f, 0xa7, 0xe3, 0x0b, 0x32, 0x24, 0xa9, 0x33, 0x4c,
+    0xad, 0x03, 0x9d, 0x40, 0x1e, 0xd4, 0x8c, 0x7b, 0x79, 0x5a, 0xd8, 0x7c, 0x7c, 0xfd, 0x1c, 0x32,
+    0x36, 0x4f, 0x80, 0x2e, 0x77, 0x9e, 0xba, 0x9a, 0x49, 0x19, 0x21, 0x4b, 0x31, 0x13, 0x37, 0xa2,
+    0x86, 0x88, 0x0a, 0xbb, 0x6b, 0x98, 0x64, 0x05, 0xc8, 0xb5, 0x8c, 0xa5, 0xf0, 0xbc, 0x8a, 0x35,
+    0xe1, 0x91, 0x50, 0xa6, 0xf1, 0xc4, 0xaf, 0x0c, 0x36, 0x0c, 0xaf, 0x80, 0xdf, 0x16, 0xfa, 0xee,
+    0xa9, 0x9a, 0x16, 0x4a, 0xb4, 0xc2, 0x46, 0x53, 0x73, 0x84, 0x78, 0x3d, 0x9f, 0x4b, 0xc0, 0x2a,
+    0x0f, 0x7d, 0x25, 0xdc, 0x51, 0x97, 0x25, 0xca, 0xec, 0xf2, 0x4b, 0x51, 0x82, 0x5d, 0x4b, 0x0d,
+    0xfc, 0x49, 0x14, 0x10, 0x2e, 0x02, 0x9d, 0xdd, 0x63, 0xf0, 0xf9, 0x68, 0xf4, 0x66, 0x4a, 0x26,
+    0xef, 0x46, 0xe7, 0x93, 0x7d, 0x3e, 0x33, 0xf3, 0x51, 0x36, 0x3f, 0x73, 0x90, 0x99, 0x0f, 0x19,
+    0xc8, 0xcc, 0x27, 0xb4, 0x0f, 0x45, 0xee, 0x70, 0xef, 0xdc, 0x7c, 0x16, 0xf3, 0xae, 0xa6, 0x6f,
+    0xf7, 0x99, 0x36, 0x77, 0xf5, 0xc7, 0xb8, 0xd6, 0x61, 0x2f, 0xf0, 0x3b, 0x22, 0xa4, 0xa3, 0xdb,
+    0x9d, 0x42, 0xc0, 0x27, 0xb4, 0x2a, 0x48, 0xdb, 0xe1, 0xd5, 0x95, 0xab, 0x3f, 0x4f, 0xa7, 0x49,
+    0x51, 0x13, 0xac, 0x17, 0xac, 0x82, 0x7d, 0xae, 0xb5, 0x10, 0x26, 0xaf, 0xf5, 0xb2, 0x65, 0xda,
+    0x62, 0xc6, 0x7f, 0x30, 0x5b, 0x6c, 0xd9, 0xa5, 0x05, 0x7f, 0x0b, 0x7e, 0xcb, 0x0a, 0x09, 0xb1,
+    0xee, 0xb0, 0xc0, 0x9a, 0x2a, 0xbd, 0xfc, 0x96, 0x79, 0xcc, 0xb8, 0xba, 0xb2, 0xcc, 0x54, 0x87,
+    0x47, 0x9d, 0xe4, 0x76, 0x57, 0x00, 0x69, 0xa9, 0xf3, 0x43, 0x8c, 0xf8, 0xa9, 0x81, 0xf7, 0xc4,
+    0xe8, 0xc6, 0x12, 0x09, 0x64, 0x1e, 0xf0, 0x61, 0xeb, 0xe8, 0xf9, 0xad, 0x6c, 0xab, 0xac, 0x68,
+    0x49, 0x26, 0x42, 0xc1, 0x8e, 0xba, 0x1e, 0x11, 0xdb, 0x2f, 0xda, 0x44, 0x48, 0x98, 0x3f, 0x73,
+    0xa1, 0xe6, 0x74, 0x4b, 0xa5, 0xf1, 0x66, 0x83, 0xa4, 0x11, 0x4e, 0x1f, 0x86, 0x34, 0x96, 0x6e,
+    0x44, 0xc6, 0x93, 0x89, 0x66, 0x65, 0x8c, 0x1e, 0x85, 0x3c, 0x50, 0xe3, 0x8c, 0xc2, 0x4f, 0xb2,
+    0x23, 0xa5, 0x56, 0xea, 0xe1, 0x1e, 0x5c, 0xbf, 0xdf, 0xef, 0xf8, 0x38, 0x53, 0x0b, 0xe6, 0x36,
+    0x75, 0x85, 0x18, 0x1f, 0x88, 0xdb, 0xa3, 0x88, 0x2a, 0x1a, 0xef, 0xb5, 0xda, 0xa0, 0x96, 0xda,
+    0x6d, 0xba, 0x5b, 0x61, 0xc3, 0xac, 0x6d, 0xbd, 0x04, 0x5b, 0x83, 0x4d, 0x93, 0x36, 0xe8, 0xc3,
+    0x3d, 0x73, 0xd1, 0x58, 0x14, 0x15, 0x66, 0xc6, 0x0c, 0x13, 0x7a, 0x81, 0x22, 0xa3, 0xe4, 0x7d,
+    0x2e, 0x37, 0xc6, 0x3f, 0xda, 0xb7, 0xa7, 0x11, 0x28, 0x89, 0x13, 0x34, 0xa3, 0x75, 0x74, 0xb3,
+    0xe7, 0xb5, 0x19, 0x92, 0xaf, 0x5e, 0x98, 0xbb, 0xb3, 0x96, 0x9a, 0x75, 0x53, 0x55, 0xea, 0xb9,
+    0x5b, 0x83, 0xb9, 0x96, 0xda, 0x0e, 0xc9, 0xb2, 0x12, 0x1e, 0xce, 0x48, 0x78, 0x79, 0x7b, 0x25,
+    0x70, 0x6d, 0x59, 0x50, 0x36, 0x24, 0x4a, 0x2b, 0xdc, 0x2e, 0x85, 0x33, 0x92, 0xad, 0x86, 0xa4,
+    0x90, 0x9a, 0xdf, 0x9e, 0x75, 0x6f, 0x91, 0xe9, 0x92, 0x60, 0x25, 0xbe, 0xe7, 0xc4, 0x7b, 0x18,
+    0x92, 0x41, 0xff, 0x18, 0x6a, 0x44, 0xfc, 0xf3, 0xfb, 0x6f, 0xbf, 0xfc, 0xfd, 0xe7, 0xaf, 0xe4,
+    0x0a, 0x5c, 0xc8, 0x14, 0x2f, 0x64, 0x82, 0xc4, 0x8f, 0x65, 0xee, 0x88, 0x7e, 0xd1, 0xff, 0x3a,
+    0x46, 0xdf, 0x3c, 0xdc, 0xcb, 0x87, 0xfb, 0xd8, 0x17, 0x60, 0x89, 0x6e, 0x88, 0x6b, 0x8c, 0xb1,
+    0xe8, 0x41, 0x68, 0xd1, 0xa7, 0x9b, 0xed, 0x3c, 0x4b, 0xd8, 0x86, 0x2d, 0x49, 0x3b, 0x9f, 0x71,
+    0x0a, 0xc7, 0xbf, 0x3e, 0xff, 0x02, 0xfd, 0x14, 0x6e, 0xad, 0x0b, 0x09, 0x00, 0x00,
+};
+
+// plot.js : 4149 octets → 1611 octets gzip
+static const uint8_t ASSET_PLOT_JS[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x57, 0xe9, 0x6e, 0x1b, 0x37,
+    0x10, 0xfe, 0xef, 0xa7, 0x98, 0x26, 0x40, 0xb4, 0x1b, 0xcb, 0xb2, 0x24, 0xc7, 0x6a, 0x2b, 0x45,
+    0x09, 0x52, 0x07, 0x69, 0x7a, 0x24, 0x08, 0x92, 0x00, 0x49, 0x61, 0xf8, 0x07, 0xbd, 0x4b, 0xad,
+    0x59, 0xaf, 0x96, 0x0b, 0x92, 0x92, 0x57, 0x4d, 0xdc, 0xff, 0x7d, 0x93, 0xfa, 0x39, 0xf4, 0x62,
+    0x9d, 0xe1, 0xb1, 0x87, 0x8f, 0x20, 0x40, 0xe3, 0x1c, 0x26, 0x39, 0x33, 0xdf, 0xdc, 0x43, 0xee,
+    0xfe, 0x3e, 0xbc, 0x57, 0x2c, 0xe1, 0x2b, 0x05, 0x29, 0x87, 0x44, 0xae, 0xd4, 0x29, 0xd7, 0xb0,
+    0x14, 0x85, 0x58, 0xb2, 0x1c, 0xa2, 0x84, 0x15, 0x6b, 0xa6, 0x63, 0x98, 0x82, 0xe2, 0xcb, 0x32,
+    0x47, 0x46, 0x38, 0x3a, 0x63, 0xca, 0x0c, 0xfe, 0xd4, 0x10, 0x1d, 0x3d, 0x7f, 0x1d, 0xef, 0xec,
+    0xef, 0xc3, 0x0b, 0x59, 0x24, 0x46, 0xc8, 0xa2, 0xe0, 0x70, 0x26, 0x95, 0x86, 0x5c, 0x64, 0xb8,
+    0xd4, 0x08, 0x99, 0x73, 0x28, 0xa5, 0x28, 0x0c, 0xa4, 0x3d, 0x96, 0x24, 0xdb, 0x7f, 0x91, 0x26,
+    0x13, 0x96, 0xf7, 0xe1, 0xef, 0x31, 0xfc, 0x26, 0x21, 0xfb, 0x4b, 0x94, 0x08, 0x40, 0x18, 0xb9,
+    0x28, 0xf8, 0x9b, 0x5c, 0x1a, 0xaf, 0xb1, 0x0f, 0x9f, 0xe8, 0x14, 0xc0, 0x08, 0x93, 0xf3, 0x3e,
+    0xe4, 0xec, 0x94, 0xa3, 0x58, 0x22, 0x73, 0xa9, 0xfa, 0xb0, 0x10, 0x39, 0x6e, 0x5a, 0x3f, 0xc8,
+    0xca, 0xca, 0x92, 0x29, 0x5e, 0x24, 0xdc, 0xc9, 0x55, 0x53, 0x38, 0x36, 0x62, 0xc9, 0xb5, 0x61,
+    0xcb, 0x52, 0x83, 0x3e, 0xe9, 0xc3, 0x06, 0x8f, 0xd6, 0x2c, 0x47, 0x57, 0x69, 0x17, 0xe4, 0x52,
+    0xb4, 0x7b, 0x7b, 0x85, 0x3e, 0x47, 0x15, 0x24, 0x4a, 0x0a, 0xad, 0x59, 0x61, 0x62, 0x07, 0xb2,
+    0x79, 0x25, 0x0a, 0x94, 0x7b, 0xc5, 0xaa, 0x8e, 0xb6, 0x6b, 0x3f, 0xc8, 0x7a, 0x2a, 0x55, 0x81,
+    0x10, 0x7a, 0x95, 0x65, 0xdb, 0x2b, 0xe5, 0xe0, 0xb6, 0x57, 0x39, 0x53, 0x99, 0xa0, 0x63, 0x01,
+    0x18, 0x54, 0x8c, 0x83, 0x87, 0xad, 0xde, 0x8b, 0xe4, 0x5c, 0x4f, 0x61, 0x82, 0x9e, 0x48, 0xb5,
+    0x64, 0xe6, 0xe3, 0x14, 0x0c, 0xcc, 0x9f, 0x40, 0x6f, 0x30, 0x18, 0xf4, 0x5a, 0xb0, 0x99, 0x62,
+    0xe9, 0x8a, 0x51, 0x68, 0x35, 0x18, 0x8c, 0xbf, 0x54, 0x3c, 0xcf, 0xb9, 0x26, 0x94, 0xcb, 0x78,
+    0x67, 0x67, 0xb1, 0x72, 0x71, 0xbf, 0x19, 0x3c, 0x59, 0x9a, 0x18, 0x23, 0x08, 0x18, 0xb0, 0x42,
+    0x63, 0xf4, 0x4b, 0x05, 0x73, 0xb8, 0x10, 0x45, 0x2a, 0x2f, 0x06, 0x29, 0x5f, 0x8b, 0x84, 0xbf,
+    0x11, 0x15, 0xcf, 0xdf, 0x12, 0x36, 0x7c, 0xfe, 0x0c, 0xa3, 0x59, 0xcd, 0x7b, 0x21, 0x52, 0x73,
+    0x86, 0xdc, 0x0e, 0x6a, 0x90, 0xe4, 0x82, 0x17, 0xe6, 0x83, 0x3d, 0x44, 0x46, 0x7f, 0x6a, 0x43,
+    0x6d, 0x5e, 0xcb, 0x94, 0x5f, 0x67, 0x38, 0x18, 0x0e, 0x1b, 0xac, 0x33, 0x2e, 0xb2, 0x33, 0xf4,
+    0x0c, 0x5e, 0x31, 0x73, 0x36, 0x50, 0x72, 0x55, 0xa4, 0x91, 0xc3, 0x7f, 0x08, 0xc3, 0xc1, 0xe1,
+    0x61, 0x3c, 0xdb, 0x21, 0x5e, 0x87, 0x19, 0x14, 0x07, 0x06, 0x34, 0x7a, 0xd6, 0x50, 0x6b, 0x28,
+    0xbf, 0xb8, 0x4e, 0xd7, 0x66, 0x93, 0xf3, 0x1b, 0x5c, 0xbb, 0xd0, 0x2b, 0xab, 0x9e, 0xd3, 0x62,
+    0x2d, 0x4a, 0x4c, 0xd5, 0xf8, 0x96, 0x71, 0x73, 0x24, 0x0b, 0xc3, 0x2b, 0x13, 0xf5, 0xc6, 0x69,
+    0x2f, 0xb6, 0x70, 0xa6, 0x1a, 0x68, 0x6e, 0xb0, 0x27, 0x0a, 0x4d, 0xc9, 0x89, 0x50, 0x4d, 0x1f,
+    0x86, 0xf6, 0x6f, 0xbd, 0xac, 0x39, 0x93, 0x9c, 0x33, 0xf5, 0x96, 0x27, 0x26, 0x72, 0x1c, 0xd6,
+    0xf6, 0xbe, 0xd7, 0x5e, 0x73, 0x2d, 0x50, 0x09, 0x6a, 0xed, 0x8d, 0xc6, 0x65, 0x05, 0xcf, 0x94,
+    0x60, 0x79, 0xdb, 0x24, 0xd2, 0x4f, 0xd4, 0xfb, 0x07, 0x07, 0x07, 0xbd, 0x26, 0x76, 0x99, 0x12,
+    0x29, 0x1d, 0xab, 0xec, 0x94, 0x21, 0xba, 0xfd, 0x33, 0x18, 0xc5, 0x2d, 0x8e, 0x92, 0x11, 0xc3,
+    0x27, 0x6c, 0xb2, 0x85, 0x99, 0xc2, 0xa3, 0x71, 0x1f, 0x14, 0xa9, 0x9d, 0xc2, 0x08, 0x2d, 0x31,
+    0xb2, 0x9c, 0x52, 0x19, 0x0c, 0x6c, 0x03, 0xc1, 0x53, 0x18, 0xff, 0x00, 0x8e, 0x72, 0x2a, 0x8d,
+    0x91, 0xcb, 0x29, 0x1c, 0x4c, 0xe0, 0xb2, 0x05, 0x86, 0xe5, 0xf3, 0xa1, 0x8e, 0xfe, 0x1e, 0x81,
+    0x0f, 0x08, 0xd8, 0x2f, 0x2d, 0x72, 0x97, 0xfb, 0x65, 0x13, 0x66, 0xc7, 0x83, 0x2a, 0xfd, 0xca,
+    0xa9, 0xb0, 0x3e, 0x8a, 0x05, 0x44, 0xb5, 0x19, 0xae, 0x26, 0x7d, 0x50, 0xb0, 0x87, 0xdf, 0x51,
+    0xd2, 0x10, 0x86, 0x42, 0x30, 0xab, 0x29, 0xb4, 0x7b, 0x46, 0x33, 0x84, 0xdc, 0x4f, 0xb0, 0xb8,
+    0xb8, 0xea, 0xcd, 0x3a, 0x72, 0xef, 0x29, 0x65, 0x35, 0xaa, 0x0f, 0x3b, 0xec, 0x03, 0x86, 0x60,
+    0x34, 0xb1, 0x61, 0xbf, 0x6c, 0xe2, 0x5b, 0x84, 0xfa, 0xc3, 0xa1, 0x66, 0x85, 0x2a, 0x74, 0xac,
+    0xc8, 0x28, 0x4f, 0xb4, 0xdb, 0xf8, 0x9d, 0x15, 0x23, 0x6b, 0x91, 0x7f, 0x3e, 0xc7, 0x1c, 0x7f,
+    0x4b, 0x5b, 0x7b, 0xcf, 0x56, 0xc9, 0x0a, 0x67, 0xa2, 0x1f, 0x36, 0xbd, 0x8e, 0xc9, 0x3e, 0x88,
+    0xb8, 0x8e, 0x9d, 0xa8, 0xe2, 0x66, 0xa5, 0x8a, 0xda, 0x0d, 0xec, 0xf6, 0xed, 0x3f, 0xc9, 0x99,
+    0x6d, 0x7d, 0x88, 0x6e, 0x19, 0x35, 0xcd, 0xa4, 0x61, 0xab, 0xaa, 0x1e, 0x68, 0x31, 0x8a, 0xe6,
+    0xdc, 0xd8, 0x21, 0x86, 0xd6, 0x59, 0x5f, 0x69, 0xf9, 0x1d, 0x7a, 0x87, 0x8d, 0xc8, 0x17, 0x38,
+    0x34, 0x52, 0x2c, 0x8c, 0x9a, 0x30, 0x85, 0x5f, 0x0a, 0x3c, 0x14, 0x66, 0x33, 0xab, 0x45, 0x59,
+    0x55, 0x8b, 0xe2, 0xf2, 0x76, 0x51, 0x24, 0x4c, 0x61, 0xaf, 0x2d, 0x8b, 0x8d, 0x03, 0x11, 0x01,
+    0x08, 0x94, 0x1e, 0xce, 0xf0, 0xd7, 0x63, 0x28, 0xf0, 0xd7, 0xee, 0x6e, 0x88, 0x6a, 0x28, 0x8b,
+    0xcd, 0xb1, 0x38, 0x41, 0x22, 0xe9, 0x8f, 0x3b, 0x96, 0xe2, 0xf9, 0xec, 0x26, 0xe7, 0x13, 0x6b,
+    0x52, 0xdc, 0x31, 0xcc, 0x73, 0x5e, 0xfa, 0xf4, 0x39, 0x12, 0x1a, 0xea, 0x30, 0x3f, 0x39, 0xde,
+    0xdd, 0x39, 0xce, 0x38, 0xa7, 0x60, 0xcf, 0x2e, 0x5b, 0x05, 0x52, 0x35, 0x6a, 0xab, 0xe3, 0xe1,
+    0xc9, 0xac, 0x45, 0xa8, 0xb5, 0x54, 0xc7, 0x28, 0x08, 0x23, 0xb2, 0xc0, 0xb2, 0x3f, 0xed, 0x9e,
+    0x4e, 0xdd, 0xe9, 0x2e, 0x0d, 0xd2, 0xa6, 0x49, 0x48, 0xd8, 0xce, 0xf5, 0xba, 0x99, 0x76, 0x21,
+    0xa2, 0x6e, 0xa9, 0xac, 0x69, 0xfb, 0x78, 0xe5, 0x90, 0x86, 0xb0, 0x7f, 0xe8, 0x9a, 0xb0, 0xd5,
+    0x65, 0x1b, 0x04, 0x58, 0x07, 0x00, 0x6a, 0x2f, 0x94, 0x1f, 0x21, 0x7f, 0xb4, 0xc6, 0xff, 0x36,
+    0x01, 0x64, 0xe3, 0x40, 0xec, 0x3e, 0xa0, 0xbc, 0x9c, 0xf9, 0xca, 0xf9, 0xb9, 0x75, 0x85, 0xfc,
+    0x01, 0x51, 0xc9, 0x34, 0xdc, 0x53, 0xb2, 0x48, 0xef, 0xc5, 0xb5, 0x1a, 0xc5, 0x2e, 0xde, 0x19,
+    0x5e, 0xa2, 0xae, 0x0e, 0x14, 0x42, 0x1f, 0x36, 0xb6, 0x2c, 0x59, 0x16, 0xfa, 0xa8, 0x94, 0x17,
+    0x11, 0x0d, 0x12, 0xbb, 0x59, 0xe4, 0x52, 0xaa, 0xc8, 0x2e, 0x73, 0x99, 0x8d, 0x86, 0x91, 0x47,
+    0x8b, 0xe3, 0xb8, 0x11, 0xd6, 0x0e, 0xfe, 0x78, 0xd4, 0xa7, 0x7a, 0x3f, 0xc4, 0x2e, 0x1d, 0x9e,
+    0x0c, 0x96, 0xac, 0x8c, 0x96, 0xe4, 0xdc, 0x12, 0x6d, 0x46, 0xf8, 0x18, 0xdb, 0x05, 0xef, 0x07,
+    0x4d, 0x47, 0x1a, 0x9e, 0xcc, 0x83, 0x5d, 0x2d, 0x9c, 0x94, 0x27, 0xf4, 0x2c, 0xd1, 0x75, 0x47,
+    0xb3, 0x8a, 0x06, 0xef, 0xde, 0xed, 0x96, 0xe8, 0x60, 0xc6, 0xce, 0x2d, 0xbd, 0x6a, 0x07, 0x5a,
+    0x6f, 0xd6, 0x22, 0xfd, 0xc4, 0x34, 0xa7, 0x8b, 0x94, 0xa8, 0x4b, 0x91, 0xa6, 0x39, 0xef, 0x75,
+    0x6a, 0x79, 0x1d, 0xb4, 0x26, 0x5c, 0xe4, 0x91, 0x2d, 0xa5, 0x7d, 0xeb, 0x19, 0xc5, 0x9c, 0x7e,
+    0xcf, 0x90, 0xe5, 0xf1, 0xdc, 0xd7, 0x9b, 0xf3, 0xf9, 0x21, 0x8c, 0xf8, 0xde, 0x84, 0x08, 0x58,
+    0x80, 0x8e, 0xd7, 0x4f, 0x15, 0xeb, 0x0f, 0xe5, 0xb7, 0xdc, 0x44, 0xeb, 0xb8, 0x19, 0x19, 0xda,
+    0x28, 0x79, 0xce, 0xc3, 0xb0, 0xa1, 0x4b, 0xa0, 0xa1, 0x9d, 0xf2, 0x4c, 0x14, 0x6f, 0xd0, 0x84,
+    0xa8, 0x25, 0xb0, 0x94, 0x6b, 0xfe, 0x5e, 0x46, 0xa1, 0xc4, 0xf0, 0xb9, 0xd2, 0x22, 0x92, 0x3f,
+    0x2d, 0x22, 0x9a, 0x65, 0x4b, 0xac, 0xcb, 0xe4, 0x54, 0xb6, 0x31, 0xef, 0x9e, 0x77, 0xf5, 0x44,
+    0x5b, 0x63, 0x3d, 0xbe, 0xc0, 0x37, 0x44, 0x1a, 0x85, 0xa4, 0xc4, 0xfd, 0xf6, 0xa5, 0x31, 0x09,
+    0x3a, 0x2e, 0x6f, 0x29, 0xc4, 0x8f, 0x4d, 0x8b, 0xd9, 0xa7, 0x50, 0x68, 0x32, 0xb7, 0xc1, 0x57,
+    0xc4, 0xa4, 0xc9, 0xb9, 0x7f, 0x21, 0x79, 0x96, 0xb0, 0x43, 0x9e, 0xc8, 0xb6, 0xd6, 0x3b, 0xa3,
+    0x44, 0x91, 0x45, 0x26, 0x8e, 0x67, 0x3b, 0x5f, 0x1e, 0xc9, 0xb7, 0xe5, 0x19, 0x7b, 0xaa, 0x9b,
+    0xe4, 0x73, 0x37, 0xb0, 0xce, 0x29, 0x91, 0xce, 0x1c, 0xdc, 0x34, 0x63, 0xcb, 0xdf, 0xd8, 0xc8,
+    0xe4, 0xfb, 0xfd, 0x7a, 0x07, 0x9f, 0x63, 0x4d, 0x78, 0xb9, 0x96, 0x00, 0x0d, 0x82, 0xb2, 0x8a,
+    0xcc, 0x37, 0xc8, 0x73, 0xd5, 0x0f, 0xc3, 0xe0, 0x66, 0x9a, 0x1b, 0x9a, 0x4f, 0xf4, 0xcb, 0xff,
+    0x9b, 0x65, 0x1f, 0x6e, 0xb4, 0xbc, 0x0f, 0x37, 0xd1, 0xf1, 0xf7, 0xa4, 0x93, 0xe3, 0x23, 0xfb,
+    0xf9, 0x80, 0x53, 0x86, 0xde, 0xfc, 0x1a, 0xd2, 0xed, 0x15, 0x96, 0xc6, 0xf6, 0x8a, 0xee, 0x25,
+    0x28, 0xe9, 0xc1, 0x09, 0xa5, 0xc2, 0x8f, 0x80, 0x66, 0xf4, 0xd8, 0xf7, 0xbc, 0x4f, 0xad, 0x5b,
+    0x63, 0x62, 0x7b, 0xf7, 0x47, 0x3f, 0x7e, 0x3f, 0x49, 0xc7, 0x9d, 0xa7, 0x8e, 0x7d, 0x1a, 0x16,
+    0xfc, 0x02, 0x28, 0x2e, 0xe3, 0xe7, 0xce, 0x0f, 0xca, 0x58, 0xce, 0xb4, 0xad, 0x8e, 0xbd, 0x51,
+    0x38, 0x59, 0x08, 0xe5, 0x8e, 0x8a, 0x55, 0x9e, 0x87, 0x43, 0x5e, 0xa4, 0x1f, 0x6d, 0x6e, 0xbf,
+    0xea, 0x7a, 0xea, 0xa4, 0xcd, 0x4d, 0x7a, 0x71, 0x12, 0x37, 0x17, 0x92, 0xb0, 0x57, 0xa1, 0x1d,
+    0xfe, 0xf0, 0xe0, 0x81, 0x1b, 0x0b, 0xec, 0x54, 0x47, 0x54, 0x0a, 0xd6, 0xa0, 0x18, 0x21, 0xf1,
+    0x85, 0x1b, 0x13, 0x92, 0x11, 0xc5, 0x8a, 0xcf, 0x6e, 0xb6, 0x7d, 0xb8, 0xbd, 0x5a, 0xb8, 0xc1,
+    0xf4, 0xb9, 0x33, 0x9e, 0xae, 0xaf, 0xd2, 0x0e, 0xba, 0x3a, 0xf9, 0xd8, 0x54, 0x8d, 0x83, 0x15,
+    0xde, 0x63, 0xc0, 0x73, 0xcd, 0x03, 0x5f, 0x53, 0x08, 0xc4, 0x77, 0x69, 0x71, 0x43, 0x80, 0x2a,
+    0xa7, 0xc6, 0x07, 0xa2, 0xaa, 0xf3, 0x16, 0x2e, 0x58, 0x4a, 0x7a, 0xd7, 0x7f, 0x7c, 0xe4, 0xb3,
+    0x6e, 0xd4, 0x49, 0x89, 0x37, 0x97, 0x88, 0x41, 0x1f, 0x61, 0xde, 0x55, 0x7b, 0x6d, 0x3e, 0x67,
+    0xf8, 0x17, 0x39, 0x93, 0x5c, 0x6a, 0x7e, 0xbd, 0xf6, 0xdb, 0x95, 0x1a, 0x4c, 0xed, 0x52, 0x23,
+    0x12, 0x6e, 0xbd, 0xfc, 0x6e, 0x74, 0x98, 0xad, 0xae, 0x30, 0x06, 0xc8, 0x9c, 0x0f, 0xfe, 0x73,
+    0x63, 0xdc, 0x3e, 0xfc, 0x55, 0x0a, 0x77, 0x3b, 0xd0, 0xa7, 0x4a, 0x3d, 0x35, 0x7c, 0xeb, 0x78,
+    0xe7, 0x5d, 0xa9, 0xff, 0xbe, 0xbd, 0xca, 0xd0, 0x6d, 0xde, 0x0a, 0xa0, 0xfd, 0x46, 0xbd, 0xeb,
+    0xd9, 0x58, 0xeb, 0x6f, 0x48, 0xf6, 0xbb, 0xa1, 0x99, 0xdb, 0xf5, 0x5b, 0x7a, 0x44, 0xcf, 0xd8,
+    0x21, 0xfd, 0xfb, 0xaa, 0x66, 0xed, 0xcc, 0x3b, 0x82, 0xea, 0x75, 0x69, 0xed, 0x79, 0xe7, 0x1e,
+    0xe6, 0x77, 0xbd, 0xa6, 0xfd, 0x47, 0x76, 0xeb, 0xb6, 0x18, 0x3d, 0x6a, 0xdb, 0xe5, 0xe3, 0x7b,
+    0xb9, 0xf3, 0x1f, 0x4a, 0x95, 0xe4, 0x77, 0x35, 0x10, 0x00, 0x00,
+};
+
+static const WebAsset WEB_ASSETS[] = {
+    { "/assets/app.css", "text/css", ASSET_APP_CSS, sizeof(ASSET_APP_CSS), "\"cf82b26d\"", true },
+    { "/assets/app.js", "application/javascript", ASSET_APP_JS, sizeof(ASSET_APP_JS), "\"317536aa\"", true },
+    { "/", "text/html", ASSET_INDEX_HTML, sizeof(ASSET_INDEX_HTML), "\"0ee568c2\"", false },
+    { "/assets/plot.js", "application/javascript", ASSET_PLOT_JS, sizeof(ASSET_PLOT_JS), "\"e1e775e5\"", true },
+};
+
+static constexpr size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);
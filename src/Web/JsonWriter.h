@@ -0,0 +1,46 @@
+// Web/JsonWriter.h
+// Écriture JSON en flux (Print) : pas de document intermédiaire en RAM
+#pragma once
+
+#include <Arduino.h>
+
+// Chaîne JSON échappée (guillemets inclus)
+inline void writeJsonString(Print& out, const char* str)
+{
+    out.print('"');
+    for (const char* p = str; *p; p++) {
+        char c = *p;
+        if (c == '"' || c == '\\') {
+            out.print('\\');
+            out.print(c);
+        } else if ((uint8_t)c < 0x20) {
+            out.printf("\\u%04x", c);
+        } else {
+            out.print(c);
+        }
+    }
+    out.print('"');
+}
+
+// Print vers un tampon fixe (messages courts : événements SSE)
+// Tronqué silencieusement si plein, toujours terminé par '\0'
+class JsonBuffer : public Print {
+public:
+    JsonBuffer(char* buf, size_t size) : _buf(buf), _size(size), _len(0) { _buf[0] = '\0'; }
+
+    size_t write(uint8_t c) override
+    {
+        if (_len + 1 >= _size) return 0;
+        _buf[_len++] = (char)c;
+        _buf[_len] = '\0';
+        return 1;
+    }
+
+    const char* c_str() const { return _buf; }
+    size_t length() const { return _len; }
+
+private:
+    char*  _buf;
+    size_t _size;
+    size_t _len;
+};
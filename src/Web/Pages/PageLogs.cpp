@@ -28,8 +28,9 @@ String PageLogs::getHtml(bool gsmActive, const LogFileStats& stats)
     if (stats.exists) {
         String statsLine = 
             "Taille : " + String(stats.sizeMB, 2) + " MB (" +
-            String(stats.percentFull, 3) + "% de " +
-            String(stats.totalGB, 2) + " Go)";
+            String(stats.percentFull, 1) + "% de " +
+            String(stats.totalMB, 2) + " MB, " +
+            String(stats.freeMB, 2) + " MB libres)";
         
         statsInfo = 
             "<div class=\"card\">"
@@ -38,7 +39,7 @@ String PageLogs::getHtml(bool gsmActive, const LogFileStats& stats)
             "<p style=\"font-size: 0.9em;\">Fichier existant : Oui</p>"
             "</div>";
     } else {
-        String availableSpace = "Espace disponible : " + String(stats.totalGB, 2) + " Go";
+        String availableSpace = "Espace disponible : " + String(stats.freeMB, 2) + " MB";
         
         statsInfo = 
             "<div class=\"card\">"
@@ -75,6 +76,8 @@ button {
 }
 button:hover:not(:disabled) { background: #0d47a1; }
 button:disabled { background: #666; cursor: not-allowed; opacity: 0.5; }
+table.events { width: 100%; border-collapse: collapse; font-size: 0.85em; text-align: left; margin: 10px 0; }
+table.events th, table.events td { padding: 4px 6px; border-bottom: 1px solid rgba(255,255,255,0.3); }
 button.danger { background: #c62828; }
 button.danger:hover:not(:disabled) { background: #8e0000; }
 .back-link { 
@@ -119,6 +122,41 @@ async function downloadLogs() {
   }
 }
 
+// Journal d'événements (WARN/ERROR) : page 0 = plus récents
+let eventsPage = 0;
+
+function formatEventTime(ev) {
+  if (ev.utc > 0) return new Date(ev.utc * 1000).toLocaleString('fr-FR');
+  return '+' + Math.floor(ev.ms / 1000) + ' s (boot)';
+}
+
+async function loadEvents(page) {
+  if (page < 0) return;
+  try {
+    const response = await fetch('/logs/events?page=' + page);
+    const data = await response.json();
+    if (page > 0 && page >= data.pages) return;
+    eventsPage = page;
+
+    const body = document.getElementById('events');
+    body.innerHTML = '';
+    for (const ev of data.events) {
+      const row = body.insertRow();
+      row.insertCell().textContent = formatEventTime(ev);
+      row.insertCell().textContent = ev.level;
+      row.insertCell().textContent = ev.tag;
+      row.insertCell().textContent = ev.msg;
+    }
+    document.getElementById('eventsInfo').textContent =
+      data.count + ' événement(s) — page ' + (data.pages ? page + 1 : 0) + '/' + data.pages +
+      (data.dropped ? ' — ' + data.dropped + ' perdu(s)' : '');
+  } catch (error) {
+    document.getElementById('eventsInfo').textContent = '❌ Erreur : ' + error;
+  }
+}
+
+window.addEventListener('load', () => loadEvents(0));
+
 function clearLogs() {
   if (confirm('⚠️ ATTENTION ⚠️\n\nÊtes-vous ABSOLUMENT SÛR de vouloir supprimer TOUTES les données historiques ?\n\nCette action est IRRÉVERSIBLE !')) {
     if (confirm('Dernière confirmation :\n\nToutes les données seront DÉFINITIVEMENT perdues.\n\nContinuer ?')) {
@@ -151,6 +189,17 @@ function clearLogs() {
   <button onclick="downloadLogs()" )HTML" + downloadDisabled + R"HTML(>📥 Télécharger les données</button>
 </div>
 
+<div class="card">
+  <p style="font-size: 1.3em;">Journal d'événements</p>
+  <p class="subtext" id="eventsInfo">Chargement...</p>
+  <table class="events">
+    <thead><tr><th>Date</th><th>Niveau</th><th>Module</th><th>Message</th></tr></thead>
+    <tbody id="events"></tbody>
+  </table>
+  <button onclick="loadEvents(eventsPage + 1)">◀ Plus anciens</button>
+  <button onclick="loadEvents(eventsPage - 1)">Plus récents ▶</button>
+</div>
+
 <div class="card">
   <p style="font-size: 1.3em;">Suppression des données</p>
   <p class="subtext">⚠️ DANGER : Supprime définitivement tout l'historique</p>
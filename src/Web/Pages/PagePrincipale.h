@@ -3,13 +3,14 @@
 
 #include <Arduino.h>
 
+// Page principale (dashboard)
+// La coquille HTML/CSS/JS est statique (web/, embarquée gzip dans
+// Web/Assets/WebAssets.h) ; seules les valeurs courantes sont générées ici
 class PagePrincipale {
 public:
     /**
-     * Retourne le code HTML complet de la page principale (dashboard)
+     * Écrit l'état courant en JSON (GET /api/status), en flux
+     * Aucune chaîne intermédiaire : valeurs lues dans DataLogger
      */
-    static String getHtml();
-
-private:
-    static String getUptimeString();
+    static void writeStatusJson(Print& out);
 };
@@ -3,32 +3,55 @@
 
 #include "Web/Pages/PagePrincipale.h"
 #include "Web/Pages/PageLogs.h"
-#include "Connectivity/WiFiManager.h"
+#include "Web/JsonWriter.h"
+#include "Web/Assets/WebAssets.h"
+#include "Connectivity/WifiManager.h"
 #include "Connectivity/CellularManager.h"
+#include "Connectivity/CellularEvent.h"
+#include "Connectivity/ManagerUTC.h"
 #include "Storage/DataLogger.h"
+#include "Storage/EventLog.h"
+#include "Storage/FileSystem.h"
+#include "Storage/GraphCache.h"
 #include "Utils/Logger.h"
 
-#include <SPIFFS.h>
-
 // Tag pour logs
 static const char* TAG = "WebServer";
 
 AsyncWebServer WebServer::server(80);
+AsyncEventSource WebServer::events("/events");
+uint32_t WebServer::bootNonce = 0;
 
 void WebServer::init()
 {
+    bootNonce = esp_random();
+
+    // Pages statiques embarquées (gzip, PROGMEM) : "/" et "/assets/*"
+    for (size_t i = 0; i < WEB_ASSET_COUNT; i++) {
+        const WebAsset* asset = &WEB_ASSETS[i];
+        server.on(asset->path, HTTP_GET, [asset](AsyncWebServerRequest *request) {
+            handleAsset(request, *asset);
+        });
+    }
+
     // Configuration des routes
-    server.on("/", HTTP_GET, handleRoot);
+    server.on("/api/status", HTTP_GET, handleApiStatus);
+    server.on("/api/perf", HTTP_GET, handleApiPerf);
     server.on("/wifi-toggle", HTTP_POST, handleWifiToggle);
     server.on("/ap-toggle", HTTP_POST, handleApToggle);
     server.on("/gsm-toggle", HTTP_POST, handleGsmToggle);
     server.on("/graphdata", HTTP_GET, handleGraphData);
     server.on("/reset", HTTP_POST, handleReset);
+
+    // Push live : un événement "d" par DataId dont la valeur change
+    server.addHandler(&events);
+    DataLogger::setChangeCallback(onDataChanged);
     
     // Routes de gestion des logs
     // ⚠️ CORRECTION : routes spécifiques AVANT /logs
     server.on("/logs/download", HTTP_GET, handleLogsDownload);
     server.on("/logs/clear", HTTP_POST, handleLogsClear);
+    server.on("/logs/events", HTTP_GET, handleLogsEvents);
     server.on("/logs", HTTP_GET, handleLogs);
 
     // Démarrage du serveur asynchrone
@@ -37,18 +60,80 @@ void WebServer::init()
 }
 
 // ─────────────────────────────────────────────────────────────────────────────
-// Page principale
+// Page principale : coquille statique + état JSON
 // ─────────────────────────────────────────────────────────────────────────────
 
-void WebServer::handleRoot(AsyncWebServerRequest *request)
+// Contenu inchangé depuis la dernière visite : 304 sans corps
+// Retourne true si la réponse a été envoyée
+bool WebServer::sendNotModified(AsyncWebServerRequest *request, const char* etag)
+{
+    if (!request->hasHeader("If-None-Match") ||
+        request->getHeader("If-None-Match")->value() != etag) {
+        return false;
+    }
+
+    AsyncWebServerResponse* response = request->beginResponse(304);
+    response->addHeader("ETag", etag);
+    request->send(response);
+    return true;
+}
+
+void WebServer::handleAsset(AsyncWebServerRequest *request, const WebAsset& asset)
+{
+    if (sendNotModified(request, asset.etag)) return;
+
+    // Blob gzip servi tel quel depuis la flash (aucune copie en RAM)
+    AsyncWebServerResponse* response =
+        request->beginResponse_P(200, asset.mime, asset.data, asset.length);
+    response->addHeader("Content-Encoding", "gzip");
+    response->addHeader("ETag", asset.etag);
+
+    // Assets à URL versionnée : cache long. Page : revalidation (ETag → 304)
+    response->addHeader("Cache-Control", asset.immutable
+                                             ? "public, max-age=31536000, immutable"
+                                             : "no-cache");
+    request->send(response);
+}
+
+// Delta compact : {"i":<DataId>,"v":<valeur>,"t":{"utc":N}|{"ageMs":0}}
+// Appelé dans DataLogger::push (loop) : rien n'est formaté sans client connecté
+// Hors contexte async_tcp : count() et send() prennent le verrou de la liste
+// des clients de la bibliothèque (fork mathieucarbou, voir platformio.ini),
+// une déconnexion simultanée ne peut pas invalider le parcours
+void WebServer::onDataChanged(DataId id, const LastDataForWeb& entry)
+{
+    if (events.count() == 0) return;
+
+    char buf[160];
+    JsonBuffer out(buf, sizeof(buf));
+
+    out.printf("{\"i\":%u,\"v\":", (unsigned)id);
+    if (std::holds_alternative<float>(entry.value)) {
+        float v = std::get<float>(entry.value);
+        if (isnan(v)) out.print("null"); else out.printf("%.3f", v);
+    } else {
+        writeJsonString(out, std::get<String>(entry.value).c_str());
+    }
+    if (entry.utc_valid) {
+        out.printf(",\"t\":{\"utc\":%lu}}", (unsigned long)entry.t_utc);
+    } else {
+        out.print(",\"t\":{\"ageMs\":0}}");
+    }
+
+    events.send(out.c_str(), "d", millis());
+}
+
+void WebServer::handleApiStatus(AsyncWebServerRequest *request)
 {
     // IMPORTANT :
     // Aucune mise à jour de données ici.
     // Toutes les données (batterie, wifi) sont mises à jour
     // périodiquement par TaskManager et stockées dans DataLogger.
 
-    String html = PagePrincipale::getHtml();
-    request->send(200, "text/html", html);
+    AsyncResponseStream* out = request->beginResponseStream("application/json");
+    out->addHeader("Cache-Control", "no-store");
+    PagePrincipale::writeStatusJson(*out);
+    request->send(out);
 }
 
 // ─────────────────────────────────────────────────────────────────────────────
@@ -107,16 +192,122 @@ void WebServer::handleGsmToggle(AsyncWebServerRequest *request)
     CellularManager::setEnabled(newState);
 }
 
+// ─────────────────────────────────────────────────────────────────────────────
+// Performances du stockage (JSON, comparaison objective entre versions)
+// Durées en µs, percentiles à ~25 % près (voir PerfCounter)
+// ─────────────────────────────────────────────────────────────────────────────
+
+void WebServer::handleApiPerf(AsyncWebServerRequest *request)
+{
+    AsyncResponseStream* out = request->beginResponseStream("application/json");
+    out->addHeader("Cache-Control", "no-store");
+
+    const DataLoggerPerf& perf = DataLogger::getPerf();
+    uint64_t records = perf.flush.getItems();
+
+    out->printf("{\"uptimeS\":%lu,", (unsigned long)(millis() / 1000));
+
+    out->printf("\"heap\":{\"free\":%lu,\"min\":%lu,\"maxAlloc\":%lu,"
+                "\"psramFree\":%lu,\"psramMin\":%lu},",
+                (unsigned long)ESP.getFreeHeap(), (unsigned long)ESP.getMinFreeHeap(),
+                (unsigned long)ESP.getMaxAllocHeap(),
+                (unsigned long)ESP.getFreePsram(), (unsigned long)ESP.getMinFreePsram());
+
+    out->print("\"dataLogger\":{\"push\":");
+    perf.push.writeJson(*out);
+    out->print(",\"flush\":");
+    perf.flush.writeJson(*out);
+    out->print(",\"scan\":");
+    perf.scan.writeJson(*out);
+    out->printf(",\"fullPageWrites\":%lu,\"partialPageWrites\":%lu,\"sectorsStarted\":%lu",
+                (unsigned long)perf.fullPageWrites,
+                (unsigned long)perf.partialPageWrites,
+                (unsigned long)perf.sectorsStarted);
+    out->printf(",\"bytesWritten\":%llu,\"bytesPerRecord\":%.1f,"
+                "\"pending\":%u,\"pendingDropped\":%lu,\"recoveredBytes\":%lu,"
+                "\"flushFailures\":%lu,\"dataVersion\":%lu},",
+                (unsigned long long)perf.bytesWritten,
+                records ? (double)perf.bytesWritten / records : 0.0,
+                (unsigned)DataLogger::getPendingCount(),
+                (unsigned long)perf.pendingDropped,
+                (unsigned long)perf.recoveredBytes,
+                (unsigned long)perf.flushFailures,
+                (unsigned long)DataLogger::getDataVersion());
+
+    out->print("\"graphCache\":{\"query\":");
+    GraphCache::getQueryPerf().writeJson(*out);
+    out->printf(",\"hits\":%lu,\"appends\":%lu,\"misses\":%lu},",
+                (unsigned long)GraphCache::getHitCount(),
+                (unsigned long)GraphCache::getAppendCount(),
+                (unsigned long)GraphCache::getMissCount());
+
+    // Lignes modem : débit observé (lignes/s depuis le boot) et débit CPU
+    // du traitement d'une ligne (lignes par seconde de CPU consommée)
+    const PerfCounter& dispatch = CellularEvent::getDispatchPerf();
+    uint32_t uptimeS = millis() / 1000;
+    out->print("\"cellularEvent\":{\"dispatch\":");
+    dispatch.writeJson(*out);
+    out->printf(",\"lines\":%lu,\"linesPerS\":%.2f,\"cpuLinesPerS\":%.0f,"
+                "\"overflows\":%lu,\"urcDispatched\":%lu},",
+                (unsigned long)CellularEvent::getLinesReceived(),
+                uptimeS ? (double)CellularEvent::getLinesReceived() / uptimeS : 0.0,
+                dispatch.getTotalUs() ? dispatch.getCalls() * 1e6 / dispatch.getTotalUs() : 0.0,
+                (unsigned long)CellularEvent::getBufferOverflows(),
+                (unsigned long)CellularEvent::getUrcDispatched());
+
+    out->printf("\"logger\":{\"dropped\":%lu,\"bufferHighWater\":%lu}}",
+                (unsigned long)Logger::getDroppedCount(),
+                (unsigned long)Logger::getBufferHighWater());
+
+    request->send(out);
+}
+
 // ─────────────────────────────────────────────────────────────────────────────
 // Graphique batterie (FLASH via DataLogger)
 // ─────────────────────────────────────────────────────────────────────────────
 
 void WebServer::handleGraphData(AsyncWebServerRequest *request)
 {
-    // Historique tension batterie depuis DataLogger (FLASH)
-    // Utilisation exceptionnelle, déclenchée par l'utilisateur
-    String csv = DataLogger::getGraphCsv(DataId::BatteryVoltage, 30);
-    request->send(200, "text/plain", csv);
+    // Version des données + jour UTC (fenêtre glissante de 30 jours) :
+    // tant que rien n'a été écrit en flash, le navigateur réutilise sa copie
+    char etag[40];
+    snprintf(etag, sizeof(etag), "\"g%08lx-%lu-%lu\"",
+             (unsigned long)bootNonce,
+             (unsigned long)DataLogger::getDataVersion(),
+             (unsigned long)(ManagerUTC::nowUtc() / 86400UL));
+    if (sendNotModified(request, etag)) return;
+
+    // Historique tension batterie (FLASH via GraphCache)
+    // Diffusé depuis le tampon PSRAM partagé : aucune copie en RAM interne
+    GraphCache::Result result;
+    if (!GraphCache::query(DataId::BatteryVoltage, 30, result)) {
+        request->send(503, "text/plain", "Historique indisponible");
+        return;
+    }
+
+    static const char header[] = "timestamp,value\n";
+    static const size_t headerLen = sizeof(header) - 1;
+
+    AsyncWebServerResponse* response = request->beginResponse(
+        "text/plain", headerLen + result.length,
+        [result](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+            size_t written = 0;
+            if (index < headerLen) {
+                written = min(maxLen, headerLen - index);
+                memcpy(buffer, header + index, written);
+                index += written;
+            }
+            size_t pos = index - headerLen;
+            if (written < maxLen && pos < result.length) {
+                size_t n = min(maxLen - written, result.length - pos);
+                memcpy(buffer + written, result.blob->data + result.offset + pos, n);
+                written += n;
+            }
+            return written;
+        });
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
 }
 
 // ─────────────────────────────────────────────────────────────────────────────
@@ -153,20 +344,31 @@ void WebServer::handleLogsDownload(AsyncWebServerRequest *request)
     if (CellularManager::isConnected()) {
         request->send(403, "text/plain", 
             "Erreur : GSM actif. Désactivez le GSM avant de télécharger les logs.");
-        Logger::warn(TAG, "Téléchargement logs avec GSM actif - BLOQUÉ");
+        LOG_WARN(TAG, "Téléchargement logs avec GSM actif - BLOQUÉ");
         return;
     }
     
     // Vérifier que le fichier existe
-    if (!SPIFFS.exists("/datalog.csv")) {
+    if (!FileSystem::fs().exists("/datalog.csv")) {
         request->send(404, "text/plain", "Aucune donnée disponible");
-        Logger::warn(TAG, "Téléchargement logs demandé mais fichier inexistant");
+        LOG_WARN(TAG, "Téléchargement logs demandé mais fichier inexistant");
         return;
     }
     
+    // Fichier inchangé depuis le dernier téléchargement : 304
+    char etag[32];
+    snprintf(etag, sizeof(etag), "\"l%08lx-%lu\"",
+             (unsigned long)bootNonce, (unsigned long)DataLogger::getDataVersion());
+    if (sendNotModified(request, etag)) return;
+
     // Envoyer le fichier directement (pas de chargement en RAM)
     // Le paramètre 'true' force le téléchargement (Content-Disposition: attachment)
-    request->send(SPIFFS, "/datalog.csv", "text/csv", true);
+
+    AsyncWebServerResponse* response =
+        request->beginResponse(FileSystem::fs(), "/datalog.csv", "text/csv", true);
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
     Logger::info(TAG, "Téléchargement logs démarré");
 }
 
@@ -181,3 +383,49 @@ void WebServer::handleLogsClear(AsyncWebServerRequest *request)
     request->send(200, "text/plain", "Historique supprimé avec succès");
     Logger::info(TAG, "Logs supprimés par l'utilisateur");
 }
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Journal d'événements (WARN/ERROR persistants)
+// GET /logs/events?page=N → JSON, décodé à la volée, plus récent d'abord
+// ─────────────────────────────────────────────────────────────────────────────
+
+static void writeEventJson(AsyncResponseStream* out, const EventEntry& entry)
+{
+    static const char* levels[] = { "ERROR", "WARN", "INFO", "DEBUG", "TRACE" };
+
+    uint8_t level = (uint8_t)entry.level;
+
+    out->printf("{\"seq\":%lu,\"utc\":%lu,\"ms\":%lu,\"level\":\"%s\",\"tag\":",
+                (unsigned long)entry.seq, (unsigned long)entry.utc, (unsigned long)entry.relMs,
+                level < 5 ? levels[level] : "?");
+    writeJsonString(*out, entry.tag);
+    out->print(",\"msg\":");
+    writeJsonString(*out, entry.message);
+    out->print('}');
+}
+
+void WebServer::handleLogsEvents(AsyncWebServerRequest *request)
+{
+    uint16_t page = 0;
+    if (request->hasParam("page")) {
+        page = (uint16_t)request->getParam("page")->value().toInt();
+    }
+
+    AsyncResponseStream* out = request->beginResponseStream("application/json");
+    out->addHeader("Cache-Control", "no-store");
+
+    out->printf("{\"page\":%u,\"pages\":%u,\"count\":%lu,\"dropped\":%lu,\"events\":[",
+                page, EventLog::getPageCount(),
+                (unsigned long)EventLog::getCount(), (unsigned long)EventLog::getDroppedCount());
+
+    struct Ctx { AsyncResponseStream* out; bool first; } ctx{out, true};
+    EventLog::readPage(page, [](const EventEntry& entry, void* c) {
+        Ctx* ctx = static_cast<Ctx*>(c);
+        if (!ctx->first) ctx->out->print(',');
+        ctx->first = false;
+        writeEventJson(ctx->out, entry);
+    }, &ctx);
+
+    out->print("]}");
+    request->send(out);
+}
@@ -4,6 +4,9 @@
 #include <Arduino.h>
 #include <ESPAsyncWebServer.h>
 #include <AsyncTCP.h>
+#include "Storage/DataLogger.h"
+
+struct WebAsset;
 
 class WebServer {
 public:
@@ -18,8 +21,19 @@ private:
     // Instance du serveur asynchrone (port 80)
     static AsyncWebServer server;
 
+    // Flux Server-Sent Events (GET /events) : deltas DataLogger en direct
+    static AsyncEventSource events;
+    static void onDataChanged(DataId id, const LastDataForWeb& entry);
+
+    // Requêtes conditionnelles (ETag / If-None-Match)
+    // bootNonce distingue les ETag de deux boots (DataLogger repart à la version 0)
+    static uint32_t bootNonce;
+    static bool sendNotModified(AsyncWebServerRequest *request, const char* etag);
+
     // Handlers pour chaque route
-    static void handleRoot(AsyncWebServerRequest *request);
+    static void handleAsset(AsyncWebServerRequest *request, const WebAsset& asset);
+    static void handleApiStatus(AsyncWebServerRequest *request);
+    static void handleApiPerf(AsyncWebServerRequest *request);
     static void handleWifiToggle(AsyncWebServerRequest *request);
     static void handleApToggle(AsyncWebServerRequest *request);
     static void handleGsmToggle(AsyncWebServerRequest *request);
@@ -30,4 +44,5 @@ private:
     static void handleLogs(AsyncWebServerRequest *request);
     static void handleLogsDownload(AsyncWebServerRequest *request);
     static void handleLogsClear(AsyncWebServerRequest *request);
+    static void handleLogsEvents(AsyncWebServerRequest *request);
 };
@@ -3,18 +3,18 @@
 // Rôle : orchestration globale, aucune logique métier
 
 #include <Arduino.h>
-#include <SPIFFS.h>
 #include <time.h>
 #include <stdlib.h>
 
 #include "Config/Config.h"
 #include "Config/TimingConfig.h"
 
-#include "Connectivity/WiFiManager.h"
+#include "Connectivity/WifiManager.h"
 #include "Connectivity/CellularStream.h"
 #include "Connectivity/CellularEvent.h"
 #include "Connectivity/CellularManager.h"
 #include "Connectivity/SmsManager.h"
+#include "Connectivity/MqttUplink.h"
 #include "Connectivity/ManagerUTC.h"
 
 #include "Core/PowerManager.h"
@@ -25,6 +25,8 @@
 
 #include "Storage/FileSystem.h"
 #include "Storage/DataLogger.h"
+#include "Storage/EventLog.h"
+#include "Storage/GraphCache.h"
 
 #include "Web/WebServer.h"
 #include "Utils/Logger.h"
@@ -62,7 +64,7 @@ void onCellularLine(CellularLineType type, const char* line)
     
     // Erreurs : toujours logger
     if (type == CellularLineType::ERROR) {
-        Logger::error("CellEvent", "✗ ERROR");
+        LOG_ERROR("CellEvent", "✗ ERROR");
         return;
     }
     
@@ -111,13 +113,10 @@ void setup()
     startTime  = bootTimeMs;
 
     // --- Système de fichiers ---
-    if (!SPIFFS.begin(true)) {
-        Logger::error("Erreur SPIFFS");
-        // On continue quand même
-    }
-
-    FileSystem::init();
+    FileSystem::init();     // Montage flash (on continue même en cas d'échec)
+    EventLog::init();       // Miroir WARN/ERROR du Logger sur flash
     DataLogger::init();
+    GraphCache::init();     // Cache PSRAM des séries de graphe (/graphdata)
 
     // --- Alimentation / PMU ---
     PowerManager::init();   // Initialise + première lecture immédiate
@@ -139,6 +138,7 @@ void setup()
     WiFiManager::init();        // Active radio WiFi + lwIP (AP/STA démarrés par TaskManager)
     CellularManager::init();    // Modem SIM7080G Cat-M (instancie TinyGSM sur CellularStream)
     SmsManager::init();         // Gestionnaire SMS
+    MqttUplink::init();         // Uplink télémétrie MQTT (point de reprise NVS)
 
     // --- Capteurs ---
     DataAcquisition::init();    // Initialisation matérielle uniquement
@@ -195,6 +195,7 @@ static void loopInit()
         []() {
             if (CellularManager::isEnabled()) {
                 CellularEvent::poll();
+                CellularManager::poll();  // File AT : enchaîne la commande suivante
             }
         },
         20UL  // 20 millisecondes
@@ -260,7 +261,33 @@ static void loopInit()
     );
 
     // -------------------------------------------------------------------------
-    // TÂCHE DATALOGGER (flush SPIFFS + réparation UTC)
+    // TÂCHE MQTTUPLINK (fenêtres store-and-forward)
+    // -------------------------------------------------------------------------
+    // Guard : uplink impossible sans GSM actif
+    // Les étapes AT avancent par callbacks (poll 20ms), cette tâche ouvre
+    // les fenêtres et surveille les étapes bloquées ; la lecture du journal
+    // et l'encodage des messages se font dans la tâche pump ci-dessous
+    TaskManager::addTask(
+        []() {
+            if (CellularManager::isEnabled()) {
+                MqttUplink::handle();
+            }
+        },
+        2000UL  // 2 secondes
+    );
+
+    // Publication : lecture du journal + encodage d'un message (hors tâche 20ms)
+    TaskManager::addTask(
+        []() {
+            if (CellularManager::isEnabled()) {
+                MqttUplink::pump();
+            }
+        },
+        MQTT_UPLINK_PUMP_PERIOD_MS
+    );
+
+    // -------------------------------------------------------------------------
+    // TÂCHE DATALOGGER (flush flash + réparation UTC)
     // -------------------------------------------------------------------------
     TaskManager::addTask(
         []() {
@@ -406,13 +433,17 @@ static void loopInit()
             uint32_t ovf = CellularStream::instance().getOverflows();
             uint32_t lines = CellularEvent::getLinesReceived();
             uint32_t lineOvf = CellularEvent::getBufferOverflows();
+            unsigned long maxMs = CellularManager::getHandleMaxDurationMs();
+            uint32_t overruns = CellularManager::getBudgetOverruns();
             
             Logger::info("CellDbg", 
                 String("poll=") + poll +
                 " tap=" + tap + 
                 " ovf=" + ovf + 
                 " lines=" + lines + 
-                " lineOvf=" + lineOvf
+                " lineOvf=" + lineOvf +
+                " maxMs=" + maxMs +
+                " overruns=" + overruns
             );
         },
         10000UL  // 10 secondes
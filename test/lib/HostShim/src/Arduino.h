@@ -0,0 +1,86 @@
+// test/lib/HostShim/src/Arduino.h
+// Cœur Arduino-ESP32 minimal pour l'hôte (env:native)
+//
+// - Temps virtuel : millis()/micros()/delay()/yield() lisent et avancent
+//   l'horloge de HostSim (aucune attente réelle, sauf mode temps réel)
+// - gettimeofday()/settimeofday() redirigés vers l'horloge système simulée
+//   (SNTP et NITZ réglent l'heure de la simulation, pas celle de l'hôte)
+// - Mono-tâche : sections critiques et sémaphores sans effet bloquant
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <math.h>
+#include <time.h>
+#include <sys/time.h>
+
+#ifdef __cplusplus
+#include <algorithm>
+#include <cmath>
+
+using std::min;
+using std::max;
+using std::isinf;
+using std::isnan;
+#endif
+
+typedef uint8_t byte;
+typedef bool    boolean;
+
+#define HIGH   0x1
+#define LOW    0x0
+#define INPUT  0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+#define PROGMEM
+#define F(s) (s)
+
+// ─────────────────────────────────────────────
+// Temps (HostSim)
+// ─────────────────────────────────────────────
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+// ─────────────────────────────────────────────
+// Broches (niveaux mémorisés par HostSim)
+// ─────────────────────────────────────────────
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int  digitalRead(uint8_t pin);
+
+// ─────────────────────────────────────────────
+// Heure système simulée
+// ─────────────────────────────────────────────
+
+void configTzTime(const char* tz, const char* server1,
+                  const char* server2 = nullptr, const char* server3 = nullptr);
+
+int hostGettimeofday(struct timeval* tv, void* tz);
+int hostSettimeofday(const struct timeval* tv, const void* tz);
+#define gettimeofday hostGettimeofday
+#define settimeofday hostSettimeofday
+
+// ─────────────────────────────────────────────
+// Mémoire (pas de PSRAM distincte)
+// ─────────────────────────────────────────────
+
+inline void* ps_malloc(size_t size) { return malloc(size); }
+
+#ifdef __cplusplus
+#include "WString.h"
+#include "Print.h"
+#include "Stream.h"
+#include "IPAddress.h"
+#include "HardwareSerial.h"
+#endif
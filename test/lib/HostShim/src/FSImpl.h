@@ -0,0 +1,55 @@
+// test/lib/HostShim/src/FSImpl.h
+// Interfaces de backend (mêmes signatures que arduino-esp32 FSImpl.h)
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+#include <memory>
+
+namespace fs {
+
+enum SeekMode {
+    SeekSet = 0,
+    SeekCur = 1,
+    SeekEnd = 2
+};
+
+class FileImpl;
+typedef std::shared_ptr<FileImpl> FileImplPtr;
+class FSImpl;
+typedef std::shared_ptr<FSImpl> FSImplPtr;
+
+class FileImpl {
+public:
+    virtual ~FileImpl() {}
+    virtual size_t write(const uint8_t* buf, size_t size) = 0;
+    virtual size_t read(uint8_t* buf, size_t size) = 0;
+    virtual void flush() = 0;
+    virtual bool seek(uint32_t pos, SeekMode mode) = 0;
+    virtual size_t position() const = 0;
+    virtual size_t size() const = 0;
+    virtual bool setBufferSize(size_t size) = 0;
+    virtual void close() = 0;
+    virtual time_t getLastWrite() = 0;
+    virtual const char* path() const = 0;
+    virtual const char* name() const = 0;
+    virtual bool isDirectory() = 0;
+    virtual FileImplPtr openNextFile(const char* mode) = 0;
+    virtual void rewindDirectory() = 0;
+    virtual operator bool() = 0;
+};
+
+class FSImpl {
+public:
+    virtual ~FSImpl() {}
+    virtual FileImplPtr open(const char* path, const char* mode, const bool create) = 0;
+    virtual bool exists(const char* path) = 0;
+    virtual bool rename(const char* pathFrom, const char* pathTo) = 0;
+    virtual bool remove(const char* path) = 0;
+    virtual bool mkdir(const char* path) = 0;
+    virtual bool rmdir(const char* path) = 0;
+};
+
+} // namespace fs
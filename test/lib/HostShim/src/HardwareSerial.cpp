@@ -0,0 +1,25 @@
+// test/lib/HostShim/src/HardwareSerial.cpp
+
+#include "HardwareSerial.h"
+
+#include <stdio.h>
+
+HardwareSerial Serial(0);
+HardwareSerial Serial1(1);
+
+size_t HardwareSerial::write(uint8_t c)
+{
+    if (uartNum != 0) return 1;
+    return fputc(c, stdout) == EOF ? 0 : 1;
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size)
+{
+    if (uartNum != 0) return size;
+    return fwrite(buffer, 1, size, stdout);
+}
+
+void HardwareSerial::flush()
+{
+    if (uartNum == 0) fflush(stdout);
+}
@@ -0,0 +1,41 @@
+// test/lib/HostShim/src/HardwareSerial.h
+// Serial : sortie standard de l'hôte ; Serial1 : UART modem sans modem
+// (les tests relient CellularStream à un ModemEmulator après init())
+
+#pragma once
+
+#include "Stream.h"
+
+#define SERIAL_8N1 0x800001c
+
+class HardwareSerial : public Stream {
+public:
+    explicit HardwareSerial(int uartNum) : uartNum(uartNum) {}
+
+    void begin(unsigned long baud, uint32_t config = SERIAL_8N1,
+               int8_t rxPin = -1, int8_t txPin = -1)
+    {
+        (void)config; (void)rxPin; (void)txPin;
+        this->baud = baud;
+    }
+    void end() { baud = 0; }
+    unsigned long baudRate() const { return baud; }
+
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+
+    using Print::write;
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+    void flush() override;
+
+    explicit operator bool() const { return true; }
+
+private:
+    int uartNum;
+    unsigned long baud = 0;
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
@@ -0,0 +1,138 @@
+// test/lib/HostShim/src/HostHeap.cpp
+
+#include "HostHeap.h"
+#include "esp_heap_caps.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <new>
+
+// En-tête devant chaque bloc compté (garde l'alignement de malloc)
+struct alignas(16) BlockHeader {
+    size_t size;
+    size_t caps;    // 0 = new/delete
+};
+
+static size_t liveBytes = 0;
+static size_t peakBytes = 0;
+static size_t capsBytes = 0;
+static size_t capsLimit = 0;
+
+static void* countedAlloc(size_t size, size_t caps)
+{
+    BlockHeader* h = (BlockHeader*)malloc(sizeof(BlockHeader) + size);
+    if (!h) return nullptr;
+    h->size = size;
+    h->caps = caps;
+    liveBytes += size;
+    if (caps) capsBytes += size;
+    if (liveBytes > peakBytes) peakBytes = liveBytes;
+    return h + 1;
+}
+
+static void countedFree(void* ptr)
+{
+    if (!ptr) return;
+    BlockHeader* h = (BlockHeader*)ptr - 1;
+    liveBytes -= h->size;
+    if (h->caps) capsBytes -= h->size;
+    free(h);
+}
+
+static bool capsRoom(size_t size)
+{
+    return capsLimit == 0 || capsBytes + size <= capsLimit;
+}
+
+// ─────────────────────────────────────────────
+// HostHeap
+// ─────────────────────────────────────────────
+
+size_t HostHeap::current() { return liveBytes; }
+size_t HostHeap::peak() { return peakBytes; }
+void HostHeap::resetPeak() { peakBytes = liveBytes; }
+void HostHeap::setCapsLimit(size_t bytes) { capsLimit = bytes; }
+
+// ─────────────────────────────────────────────
+// esp_heap_caps.h
+// ─────────────────────────────────────────────
+
+void* heap_caps_malloc(size_t size, uint32_t caps)
+{
+    if (!capsRoom(size)) return nullptr;
+    return countedAlloc(size, caps ? caps : MALLOC_CAP_DEFAULT);
+}
+
+void* heap_caps_calloc(size_t n, size_t size, uint32_t caps)
+{
+    if (size && n > (size_t)-1 / size) return nullptr;
+    void* p = heap_caps_malloc(n * size, caps);
+    if (p) memset(p, 0, n * size);
+    return p;
+}
+
+void* heap_caps_realloc(void* ptr, size_t size, uint32_t caps)
+{
+    if (!ptr) return heap_caps_malloc(size, caps);
+    if (size == 0) {
+        heap_caps_free(ptr);
+        return nullptr;
+    }
+    size_t oldSize = ((BlockHeader*)ptr - 1)->size;
+    if (size > oldSize && !capsRoom(size - oldSize)) return nullptr;
+
+    void* fresh = countedAlloc(size, caps ? caps : MALLOC_CAP_DEFAULT);
+    if (!fresh) return nullptr;
+    memcpy(fresh, ptr, oldSize < size ? oldSize : size);
+    countedFree(ptr);
+    return fresh;
+}
+
+void heap_caps_free(void* ptr)
+{
+    countedFree(ptr);
+}
+
+size_t heap_caps_get_free_size(uint32_t caps)
+{
+    (void)caps;
+    return capsLimit ? capsLimit - capsBytes : (size_t)8 * 1024 * 1024;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps)
+{
+    return heap_caps_get_free_size(caps);
+}
+
+// ─────────────────────────────────────────────
+// new / delete C++
+// ─────────────────────────────────────────────
+
+void* operator new(size_t size)
+{
+    void* p = countedAlloc(size ? size : 1, 0);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    return countedAlloc(size ? size : 1, 0);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    return countedAlloc(size ? size : 1, 0);
+}
+
+void operator delete(void* ptr) noexcept { countedFree(ptr); }
+void operator delete[](void* ptr) noexcept { countedFree(ptr); }
+void operator delete(void* ptr, size_t) noexcept { countedFree(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { countedFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { countedFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { countedFree(ptr); }
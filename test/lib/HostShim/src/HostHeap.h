@@ -0,0 +1,17 @@
+// test/lib/HostShim/src/HostHeap.h
+// Comptage du tas simulé : heap_caps_* et new/delete C++ (les malloc()
+// directs du firmware ne sont pas comptés : tampons transitoires de lecture)
+
+#pragma once
+
+#include <stddef.h>
+
+class HostHeap {
+public:
+    static size_t current();            // Octets vivants
+    static size_t peak();               // Maximum depuis resetPeak()
+    static void   resetPeak();
+
+    // Plafond heap_caps_* (PSRAM épuisée) ; 0 = illimité
+    static void   setCapsLimit(size_t bytes);
+};
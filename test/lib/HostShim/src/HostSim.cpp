@@ -0,0 +1,344 @@
+// test/lib/HostShim/src/HostSim.cpp
+
+#include <chrono>
+
+#include "HostSim.h"
+#include "Arduino.h"
+#include "Preferences.h"
+
+// ─────────────────────────────────────────────
+// État du monde simulé
+// ─────────────────────────────────────────────
+
+namespace {
+
+struct World {
+    // Horloge
+    uint32_t startMs = 0;
+    uint64_t virtualUs = 0;
+    bool     realTime = false;
+    std::chrono::steady_clock::time_point realBase;
+
+    // Heure
+    time_t   utcAtReset = HostSim::DEFAULT_UTC;
+    double   driftPpm = 0.0;
+    bool     systemTimeSet = false;
+    int64_t  systemBaseMs = 0;               // Heure système au réglage
+    uint64_t systemBaseUs = 0;               // Horloge virtuelle au réglage
+
+    // Réseau
+    bool     wifiConnected = false;
+    int      wifiRssi = -60;
+    bool     ntpReachable = true;
+    uint32_t ntpLatencyMs = 200;
+    bool     sntpPending = false;
+    uint64_t sntpDueUs = 0;
+    bool     sntpCompleted = false;
+    uint32_t ntpRequests = 0;
+
+    // Alimentation
+    bool  pmuDetected = true;
+    bool  externalPower = true;
+    float batteryVolts = 4.1f;
+    int   batteryPercent = 90;
+    bool  charging = false;
+
+    // Broches
+    int pins[64] = {};
+};
+
+World world;
+
+uint64_t nowUs()
+{
+    uint64_t us = world.virtualUs;
+    if (world.realTime) {
+        auto real = std::chrono::steady_clock::now() - world.realBase;
+        us += (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(real).count();
+    }
+    return us;
+}
+
+} // namespace
+
+void HostSim::reset(uint32_t startMs)
+{
+    world = World();
+    world.startMs = startMs;
+    Preferences::hostClearAll();
+}
+
+// ─────────────────────────────────────────────
+// Horloge
+// ─────────────────────────────────────────────
+
+void HostSim::advanceMs(uint32_t ms)
+{
+    world.virtualUs += (uint64_t)ms * 1000;
+}
+
+void HostSim::advanceUs(uint64_t us)
+{
+    world.virtualUs += us;
+}
+
+uint64_t HostSim::elapsedUs()
+{
+    return nowUs();
+}
+
+uint32_t HostSim::millis()
+{
+    return (uint32_t)(world.startMs + nowUs() / 1000);
+}
+
+uint32_t HostSim::micros()
+{
+    return (uint32_t)((uint64_t)world.startMs * 1000 + nowUs());
+}
+
+void HostSim::setRealTime(bool enabled)
+{
+    if (enabled == world.realTime) return;
+    // Le temps réel écoulé est acquis dans l'horloge virtuelle à la bascule
+    world.virtualUs = nowUs();
+    world.realTime = enabled;
+    world.realBase = std::chrono::steady_clock::now();
+}
+
+// ─────────────────────────────────────────────
+// Heure
+// ─────────────────────────────────────────────
+
+void HostSim::setTrueUtc(time_t utcAtReset)
+{
+    world.utcAtReset = utcAtReset;
+}
+
+void HostSim::setDriftPpm(double ppm)
+{
+    world.driftPpm = ppm;
+}
+
+int64_t HostSim::trueUtcMs()
+{
+    double localMs = (double)nowUs() / 1000.0;
+    return (int64_t)world.utcAtReset * 1000 + (int64_t)(localMs * (1.0 + world.driftPpm * 1e-6));
+}
+
+int64_t HostSim::systemTimeMs()
+{
+    // Horloge système non réglée : epoch + temps local (comme après boot)
+    if (!world.systemTimeSet) return (int64_t)(nowUs() / 1000);
+    return world.systemBaseMs + (int64_t)((nowUs() - world.systemBaseUs) / 1000);
+}
+
+void HostSim::setSystemTimeMs(int64_t utcMs)
+{
+    world.systemTimeSet = true;
+    world.systemBaseMs = utcMs;
+    world.systemBaseUs = nowUs();
+}
+
+// ─────────────────────────────────────────────
+// Réseau
+// ─────────────────────────────────────────────
+
+void HostSim::setWifiConnected(bool connected)
+{
+    world.wifiConnected = connected;
+}
+
+bool HostSim::isWifiConnected()
+{
+    return world.wifiConnected;
+}
+
+void HostSim::setWifiRssi(int rssi)
+{
+    world.wifiRssi = rssi;
+}
+
+int HostSim::getWifiRssi()
+{
+    return world.wifiConnected ? world.wifiRssi : 0;
+}
+
+void HostSim::setNtpReachable(bool reachable)
+{
+    world.ntpReachable = reachable;
+}
+
+void HostSim::setNtpLatencyMs(uint32_t latencyMs)
+{
+    world.ntpLatencyMs = latencyMs;
+}
+
+uint32_t HostSim::getNtpRequestCount()
+{
+    return world.ntpRequests;
+}
+
+void HostSim::sntpRequest()
+{
+    world.ntpRequests++;
+    world.sntpPending = true;
+    world.sntpCompleted = false;
+    world.sntpDueUs = nowUs() + (uint64_t)world.ntpLatencyMs * 1000;
+}
+
+void HostSim::sntpStop()
+{
+    world.sntpPending = false;
+}
+
+void HostSim::sntpReset()
+{
+    world.sntpCompleted = false;
+}
+
+bool HostSim::sntpPoll()
+{
+    if (world.sntpPending && nowUs() >= world.sntpDueUs) {
+        world.sntpPending = false;
+        // Réponse perdue si le réseau est tombé pendant la requête
+        if (world.wifiConnected && world.ntpReachable) {
+            setSystemTimeMs(trueUtcMs());
+            world.sntpCompleted = true;
+        }
+    }
+    return world.sntpCompleted;
+}
+
+// ─────────────────────────────────────────────
+// Alimentation
+// ─────────────────────────────────────────────
+
+void HostSim::setPmuDetected(bool detected)
+{
+    world.pmuDetected = detected;
+}
+
+void HostSim::setExternalPower(bool present)
+{
+    world.externalPower = present;
+}
+
+void HostSim::setBattery(float volts, int percent, bool charging)
+{
+    world.batteryVolts = volts;
+    world.batteryPercent = percent;
+    world.charging = charging;
+}
+
+bool HostSim::isPmuDetected()
+{
+    return world.pmuDetected;
+}
+
+bool HostSim::isExternalPowerPresent()
+{
+    return world.pmuDetected && world.externalPower;
+}
+
+float HostSim::getBatteryVoltage()
+{
+    return world.pmuDetected ? world.batteryVolts : 0.0f;
+}
+
+int HostSim::getBatteryPercent()
+{
+    return world.pmuDetected ? world.batteryPercent : 0;
+}
+
+bool HostSim::isCharging()
+{
+    return world.pmuDetected && world.charging;
+}
+
+// ─────────────────────────────────────────────
+// Broches
+// ─────────────────────────────────────────────
+
+void HostSim::setPin(uint8_t pin, int level)
+{
+    if (pin < 64) world.pins[pin] = level;
+}
+
+int HostSim::getPin(uint8_t pin)
+{
+    return pin < 64 ? world.pins[pin] : LOW;
+}
+
+// ─────────────────────────────────────────────
+// Cœur Arduino (Arduino.h)
+// ─────────────────────────────────────────────
+
+unsigned long millis()
+{
+    return HostSim::millis();
+}
+
+unsigned long micros()
+{
+    return HostSim::micros();
+}
+
+void delay(uint32_t ms)
+{
+    if (ms == 0) yield();
+    else HostSim::advanceMs(ms);
+}
+
+void delayMicroseconds(uint32_t us)
+{
+    HostSim::advanceUs(us);
+}
+
+void yield()
+{
+    HostSim::advanceUs(HostSim::YIELD_QUANTUM_US);
+}
+
+void pinMode(uint8_t pin, uint8_t mode)
+{
+    (void)pin;
+    (void)mode;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val)
+{
+    HostSim::setPin(pin, val);
+}
+
+int digitalRead(uint8_t pin)
+{
+    return HostSim::getPin(pin);
+}
+
+void configTzTime(const char* tz, const char* server1, const char* server2, const char* server3)
+{
+    (void)server1;
+    (void)server2;
+    (void)server3;
+    setenv("TZ", tz, 1);
+    tzset();
+    HostSim::sntpRequest();
+}
+
+int hostGettimeofday(struct timeval* tv, void* tz)
+{
+    (void)tz;
+    if (!tv) return 0;
+    int64_t ms = HostSim::systemTimeMs();
+    tv->tv_sec = (time_t)(ms / 1000);
+    tv->tv_usec = (suseconds_t)((ms % 1000) * 1000);
+    return 0;
+}
+
+int hostSettimeofday(const struct timeval* tv, const void* tz)
+{
+    (void)tz;
+    if (tv) HostSim::setSystemTimeMs((int64_t)tv->tv_sec * 1000 + tv->tv_usec / 1000);
+    return 0;
+}
@@ -0,0 +1,81 @@
+// test/lib/HostShim/src/HostSim.h
+// Monde simulé des tests hôte : horloge virtuelle, réseau, heure vraie,
+// alimentation et broches
+//
+// - Horloge virtuelle en µs : millis()/micros() la lisent, delay()/yield()
+//   la font avancer (yield = YIELD_QUANTUM_US, attente active d'un module)
+// - Départ configurable (reset(startMs)) : un démarrage proche de 2^32 ms
+//   exerce le rebouclage de millis() dès les premières minutes simulées
+// - Mode temps réel (banc) : le temps écoulé réel de l'hôte s'ajoute au
+//   temps virtuel, les durées PerfCounter deviennent des mesures réelles
+// - Heure vraie : UTC de référence au reset, dérive de l'horloge locale
+//   (ppm) ; SNTP et les URC réseau la lisent pour régler l'heure système
+
+#pragma once
+
+#include <stdint.h>
+#include <time.h>
+
+class HostSim {
+public:
+    static constexpr uint32_t YIELD_QUANTUM_US = 100;
+    static constexpr time_t DEFAULT_UTC = 1767225600;   // 2026-01-01T00:00:00Z
+
+    // Remise à zéro du monde simulé (NVS comprise) ; startMs = millis() initial
+    static void reset(uint32_t startMs = 0);
+
+    // ─────────────────────────────────────────────
+    // Horloge
+    // ─────────────────────────────────────────────
+    static void advanceMs(uint32_t ms);
+    static void advanceUs(uint64_t us);
+    static uint64_t elapsedUs();             // Depuis reset(), sans rebouclage
+    static uint32_t millis();
+    static uint32_t micros();
+    static void setRealTime(bool enabled);
+
+    // ─────────────────────────────────────────────
+    // Heure vraie (référence UTC) et horloge système
+    // ─────────────────────────────────────────────
+    static void setTrueUtc(time_t utcAtReset);
+    // ppm > 0 : l'horloge locale retarde, l'UTC avance de ppm µs par seconde locale
+    static void setDriftPpm(double ppm);
+    static int64_t trueUtcMs();
+    static int64_t systemTimeMs();           // gettimeofday() du firmware
+    static void setSystemTimeMs(int64_t utcMs);
+
+    // ─────────────────────────────────────────────
+    // Réseau
+    // ─────────────────────────────────────────────
+    static void setWifiConnected(bool connected);
+    static bool isWifiConnected();
+    static void setWifiRssi(int rssi);
+    static int  getWifiRssi();
+    static void setNtpReachable(bool reachable);
+    static void setNtpLatencyMs(uint32_t latencyMs);
+    static uint32_t getNtpRequestCount();
+
+    // SNTP (lwip/apps/sntp.h)
+    static void sntpRequest();
+    static void sntpStop();
+    static void sntpReset();
+    static bool sntpPoll();                  // true si synchro terminée
+
+    // ─────────────────────────────────────────────
+    // Alimentation (PMU AXP2101)
+    // ─────────────────────────────────────────────
+    static void setPmuDetected(bool detected);
+    static void setExternalPower(bool present);
+    static void setBattery(float volts, int percent, bool charging);
+    static bool isPmuDetected();
+    static bool isExternalPowerPresent();
+    static float getBatteryVoltage();
+    static int   getBatteryPercent();
+    static bool  isCharging();
+
+    // ─────────────────────────────────────────────
+    // Broches
+    // ─────────────────────────────────────────────
+    static void setPin(uint8_t pin, int level);
+    static int  getPin(uint8_t pin);
+};
@@ -0,0 +1,54 @@
+// test/lib/HostShim/src/IPAddress.cpp
+
+#include "IPAddress.h"
+
+#include <stdio.h>
+#include <string.h>
+
+IPAddress::IPAddress(uint32_t address)
+{
+    memcpy(addr, &address, sizeof(addr));
+}
+
+bool IPAddress::fromString(const char* address)
+{
+    uint16_t acc = 0;
+    uint8_t dots = 0;
+
+    while (*address) {
+        char c = *address++;
+        if (c >= '0' && c <= '9') {
+            acc = acc * 10 + (c - '0');
+            if (acc > 255) return false;
+        } else if (c == '.') {
+            if (dots == 3) return false;
+            addr[dots++] = (uint8_t)acc;
+            acc = 0;
+        } else {
+            return false;
+        }
+    }
+
+    if (dots != 3) return false;
+    addr[3] = (uint8_t)acc;
+    return true;
+}
+
+String IPAddress::toString() const
+{
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", addr[0], addr[1], addr[2], addr[3]);
+    return String(buf);
+}
+
+IPAddress::operator uint32_t() const
+{
+    uint32_t value;
+    memcpy(&value, addr, sizeof(value));
+    return value;
+}
+
+bool IPAddress::operator==(const IPAddress& other) const
+{
+    return memcmp(addr, other.addr, sizeof(addr)) == 0;
+}
@@ -0,0 +1,28 @@
+// test/lib/HostShim/src/IPAddress.h
+// IPv4 uniquement ; fromString() reproduit arduino-esp32 2.x (remplissage
+// partiel des octets avant un échec)
+
+#pragma once
+
+#include <stdint.h>
+#include "WString.h"
+
+class IPAddress {
+public:
+    IPAddress() : addr{0, 0, 0, 0} {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : addr{a, b, c, d} {}
+    IPAddress(uint32_t address);
+
+    bool fromString(const char* address);
+    bool fromString(const String& address) { return fromString(address.c_str()); }
+    String toString() const;
+
+    operator uint32_t() const;
+    bool operator==(const IPAddress& other) const;
+    bool operator!=(const IPAddress& other) const { return !(*this == other); }
+    uint8_t operator[](int index) const { return addr[index]; }
+    uint8_t& operator[](int index) { return addr[index]; }
+
+private:
+    uint8_t addr[4];
+};
@@ -0,0 +1,48 @@
+// test/lib/HostShim/src/LittleFS.cpp
+
+#include "LittleFS.h"
+#include "SPIFFS.h"
+
+#include <stdlib.h>
+#include <string>
+
+// Taille de la partition "spiffs" de partitions/custom_16MB_2MB_spiffs.csv
+static constexpr size_t PARTITION_BYTES = 2 * 1024 * 1024;
+
+static std::string partitionDir()
+{
+    const char* tmp = getenv("TMPDIR");
+    return std::string(tmp && *tmp ? tmp : "/tmp") + "/host_littlefs";
+}
+
+LittleFSFS LittleFS;
+SPIFFSFS SPIFFS;
+
+LittleFSFS::LittleFSFS() : PosixFS(partitionDir().c_str())
+{
+    setCapacity(PARTITION_BYTES);
+}
+
+bool LittleFSFS::begin(bool formatOnFail, const char* basePath,
+                       uint8_t maxOpenFiles, const char* partitionLabel)
+{
+    (void)formatOnFail; (void)basePath; (void)maxOpenFiles; (void)partitionLabel;
+    mounted = true;
+    return true;
+}
+
+void LittleFSFS::end()
+{
+    mounted = false;
+}
+
+bool LittleFSFS::format()
+{
+    clear();
+    return true;
+}
+
+size_t LittleFSFS::totalBytes() const
+{
+    return mounted ? PosixFS::totalBytes() : 0;
+}
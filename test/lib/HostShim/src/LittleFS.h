@@ -0,0 +1,25 @@
+// test/lib/HostShim/src/LittleFS.h
+// Partition LittleFS de l'hôte : répertoire host_littlefs/ du dossier
+// temporaire (les tests préfèrent FileSystem::setFs sur leur propre PosixFS)
+
+#pragma once
+
+#include "PosixFS.h"
+
+class LittleFSFS : public PosixFS {
+public:
+    LittleFSFS();
+
+    bool begin(bool formatOnFail = false, const char* basePath = "/littlefs",
+               uint8_t maxOpenFiles = 10, const char* partitionLabel = "spiffs");
+    void end();
+    bool format();
+
+    size_t totalBytes() const;
+    size_t usedBytes() const { return PosixFS::usedBytes(); }
+
+private:
+    bool mounted = false;
+};
+
+extern LittleFSFS LittleFS;
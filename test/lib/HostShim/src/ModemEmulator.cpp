@@ -0,0 +1,258 @@
+// test/lib/HostShim/src/ModemEmulator.cpp
+
+#include "ModemEmulator.h"
+#include "HostSim.h"
+
+static constexpr uint8_t CTRL_Z = 0x1A;
+
+void ModemEmulator::reset()
+{
+    rules.clear();
+    echo = true;
+    silent = false;
+    scheduled.clear();
+    wire.clear();
+    wireFreeUs = 0;
+    rxLine.clear();
+    afterCr = false;
+    inPayload = false;
+    payloadExpected = 0;
+    payload.clear();
+    afterPayload.clear();
+    afterPayloadLatencyMs = 0;
+    log.clear();
+}
+
+// ─────────────────────────────────────────────
+// Script
+// ─────────────────────────────────────────────
+
+void ModemEmulator::on(const char* pattern, const char* response, uint32_t latencyMs, size_t payloadLen)
+{
+    Rule rule{ pattern, response != nullptr, response ? response : "", latencyMs, payloadLen };
+    for (Rule& r : rules) {
+        if (r.pattern == rule.pattern) {
+            r = rule;
+            return;
+        }
+    }
+    rules.push_back(rule);
+}
+
+void ModemEmulator::setEcho(bool enabled)
+{
+    echo = enabled;
+}
+
+void ModemEmulator::setSilent(bool s)
+{
+    silent = s;
+}
+
+void ModemEmulator::urc(const char* line, uint32_t delayMs)
+{
+    schedule(HostSim::elapsedUs() + (uint64_t)delayMs * 1000, std::string("\r\n") + line + "\r\n");
+}
+
+void ModemEmulator::inject(const char* text, uint32_t delayMs)
+{
+    inject((const uint8_t*)text, strlen(text), delayMs);
+}
+
+void ModemEmulator::inject(const uint8_t* data, size_t len, uint32_t delayMs)
+{
+    schedule(HostSim::elapsedUs() + (uint64_t)delayMs * 1000, std::string((const char*)data, len));
+}
+
+// ─────────────────────────────────────────────
+// Observation
+// ─────────────────────────────────────────────
+
+size_t ModemEmulator::countCommand(const char* pattern) const
+{
+    size_t n = 0;
+    for (const std::string& c : log) {
+        if (matches(pattern, c)) n++;
+    }
+    return n;
+}
+
+size_t ModemEmulator::bytesInFlight() const
+{
+    size_t n = wire.size();
+    for (const Chunk& c : scheduled) n += c.bytes.size();
+    return n;
+}
+
+void ModemEmulator::clearLog()
+{
+    log.clear();
+}
+
+// ─────────────────────────────────────────────
+// Règles
+// ─────────────────────────────────────────────
+
+bool ModemEmulator::matches(const std::string& pattern, const std::string& command)
+{
+    if (!pattern.empty() && pattern.back() == '*') {
+        return command.compare(0, pattern.size() - 1, pattern, 0, pattern.size() - 1) == 0;
+    }
+    return pattern == command;
+}
+
+// Motif exact prioritaire, puis le préfixe le plus long
+const ModemEmulator::Rule* ModemEmulator::findRule(const std::string& command) const
+{
+    const Rule* best = nullptr;
+    for (const Rule& r : rules) {
+        if (!matches(r.pattern, command)) continue;
+        if (r.pattern.back() != '*') return &r;
+        if (!best || r.pattern.size() > best->pattern.size()) best = &r;
+    }
+    return best;
+}
+
+void ModemEmulator::onCommand(const std::string& command)
+{
+    log.push_back(command);
+    if (silent) return;
+
+    const uint64_t now = HostSim::elapsedUs();
+    if (echo) schedule(now, command + "\r");
+
+    const Rule* rule = findRule(command);
+    if (!rule) {
+        emitLines("ERROR", now + (uint64_t)DEFAULT_LATENCY_MS * 1000);
+        return;
+    }
+    if (!rule->hasResponse) return;
+
+    const uint64_t at = now + (uint64_t)rule->latencyMs * 1000;
+    const std::string& text = rule->response;
+
+    // Prompt : la suite de la réponse attend la charge utile
+    size_t promptLine = text.find(">");
+    if (promptLine != std::string::npos &&
+        (promptLine == 0 || text[promptLine - 1] == '\n') &&
+        (promptLine + 1 == text.size() || text[promptLine + 1] == '\n')) {
+        emitLines(text.substr(0, promptLine), at);
+        schedule(at, "\r\n> ");
+        inPayload = true;
+        payloadExpected = rule->payloadLen;
+        payload.clear();
+        afterPayload = promptLine + 2 <= text.size() ? text.substr(promptLine + 2) : "";
+        afterPayloadLatencyMs = rule->latencyMs;
+        return;
+    }
+
+    emitLines(text, at);
+}
+
+void ModemEmulator::emitLines(const std::string& text, uint64_t atUs)
+{
+    size_t start = 0;
+    while (start < text.size()) {
+        size_t nl = text.find('\n', start);
+        if (nl == std::string::npos) nl = text.size();
+        if (nl > start) schedule(atUs, "\r\n" + text.substr(start, nl - start) + "\r\n");
+        start = nl + 1;
+    }
+}
+
+// ─────────────────────────────────────────────
+// Ligne série (modem → firmware)
+// ─────────────────────────────────────────────
+
+void ModemEmulator::schedule(uint64_t atUs, const std::string& bytes)
+{
+    if (!bytes.empty()) scheduled.push_back({ atUs, bytes });
+}
+
+// Un seul émetteur : les chunks échus partent dans l'ordre de leur date
+// (ordre d'ajout à date égale), chaque octet occupe la ligne BYTE_US
+void ModemEmulator::transmit()
+{
+    const uint64_t now = HostSim::elapsedUs();
+    for (;;) {
+        size_t next = scheduled.size();
+        for (size_t i = 0; i < scheduled.size(); i++) {
+            if (scheduled[i].atUs > now) continue;
+            if (next == scheduled.size() || scheduled[i].atUs < scheduled[next].atUs) next = i;
+        }
+        if (next == scheduled.size()) return;
+
+        uint64_t t = wireFreeUs > scheduled[next].atUs ? wireFreeUs : scheduled[next].atUs;
+        for (char c : scheduled[next].bytes) {
+            t += BYTE_US;
+            wire.push_back({ t, (uint8_t)c });
+        }
+        wireFreeUs = t;
+        scheduled.erase(scheduled.begin() + next);
+    }
+}
+
+int ModemEmulator::available()
+{
+    transmit();
+    const uint64_t now = HostSim::elapsedUs();
+    int n = 0;
+    for (const WireByte& b : wire) {
+        if (b.dueUs > now) break;
+        n++;
+    }
+    return n;
+}
+
+int ModemEmulator::read()
+{
+    int c = peek();
+    if (c >= 0) wire.pop_front();
+    return c;
+}
+
+int ModemEmulator::peek()
+{
+    transmit();
+    if (wire.empty() || wire.front().dueUs > HostSim::elapsedUs()) return -1;
+    return wire.front().c;
+}
+
+// ─────────────────────────────────────────────
+// Firmware → modem
+// ─────────────────────────────────────────────
+
+size_t ModemEmulator::write(uint8_t c)
+{
+    // "\r\n" de fin de commande : le LF suit le CR qui a pu ouvrir le prompt
+    const bool lfAfterCr = afterCr && c == '\n';
+    afterCr = false;
+    if (lfAfterCr) return 1;
+
+    if (inPayload) {
+        bool done;
+        if (payloadExpected == 0) {
+            done = c == CTRL_Z;
+            if (!done) payload += (char)c;
+        } else {
+            payload += (char)c;
+            done = payload.size() >= payloadExpected;
+        }
+        if (done) {
+            inPayload = false;
+            if (!silent) {
+                emitLines(afterPayload, HostSim::elapsedUs() + (uint64_t)afterPayloadLatencyMs * 1000);
+            }
+        }
+        return 1;
+    }
+
+    if (c == '\r') {
+        afterCr = true;
+        if (!rxLine.empty()) onCommand(rxLine);
+        rxLine.clear();
+    } else if (c != '\n') {
+        rxLine += (char)c;
+    }
+    return 1;
+}
@@ -0,0 +1,111 @@
+// test/lib/HostShim/src/ModemEmulator.h
+// SIM7080G scripté : Stream relié à CellularStream à la place de Serial1
+// (CellularStream::instance().begin(emulator) après CellularManager::init())
+//
+// - Règles commande → réponse : motif exact ("AT+CSQ") ou préfixe ("AT+CMGS=*"),
+//   latence avant la première ligne ; réponse nullptr = modem muet (timeout)
+// - Réponse multi-lignes séparées par '\n', chacune émise "\r\n<ligne>\r\n" ;
+//   une ligne ">" émet le prompt "\r\n> " puis attend la charge utile
+//   (Ctrl+Z, ou payloadLen octets) avant d'émettre la suite de la réponse
+// - Commande sans règle : "ERROR" ; écho des commandes (ATE1) activable
+// - Débit UART : un octet toutes les BYTE_US µs de temps virtuel (HostSim),
+//   une réponse longue arrive donc par morceaux au fil des pompages
+// - URC, bruit et octets quelconques injectables à une date future
+// - Journal des commandes reçues (countCommand accepte les mêmes motifs)
+
+#pragma once
+
+#include "Stream.h"
+
+#include <deque>
+#include <string>
+#include <vector>
+
+class ModemEmulator : public Stream {
+public:
+    static constexpr uint32_t BYTE_US = 87;               // 115200 bauds 8N1
+    static constexpr uint32_t DEFAULT_LATENCY_MS = 10;
+
+    // Oublie règles, journal et octets en transit ; écho réactivé
+    void reset();
+
+    // ─────────────────────────────────────────────
+    // Script
+    // ─────────────────────────────────────────────
+    // Un motif déjà présent est remplacé (changement de comportement en cours de test)
+    void on(const char* pattern, const char* response,
+            uint32_t latencyMs = DEFAULT_LATENCY_MS, size_t payloadLen = 0);
+    void setEcho(bool enabled);
+    // Modem sourd : commandes journalisées, aucune réponse (UART non synchronisé, éteint)
+    void setSilent(bool silent);
+
+    // Ligne non sollicitée "\r\n<line>\r\n" dans delayMs
+    void urc(const char* line, uint32_t delayMs = 0);
+    // Octets bruts (bruit UART, fragments) dans delayMs
+    void inject(const char* text, uint32_t delayMs = 0);
+    void inject(const uint8_t* data, size_t len, uint32_t delayMs = 0);
+
+    // ─────────────────────────────────────────────
+    // Observation
+    // ─────────────────────────────────────────────
+    const std::vector<std::string>& commands() const { return log; }
+    size_t countCommand(const char* pattern) const;
+    static bool matches(const std::string& pattern, const std::string& command);
+    const std::string& lastPayload() const { return payload; }
+    size_t bytesInFlight() const;          // Octets pas encore arrivés
+    void clearLog();
+
+    // ─────────────────────────────────────────────
+    // Stream (côté firmware)
+    // ─────────────────────────────────────────────
+    int available() override;
+    int read() override;
+    int peek() override;
+
+    using Print::write;
+    size_t write(uint8_t c) override;
+
+private:
+    struct Rule {
+        std::string pattern;
+        bool hasResponse;
+        std::string response;
+        uint32_t latencyMs;
+        size_t payloadLen;
+    };
+
+    struct Chunk {
+        uint64_t atUs;
+        std::string bytes;
+    };
+
+    struct WireByte {
+        uint64_t dueUs;
+        uint8_t c;
+    };
+
+    const Rule* findRule(const std::string& command) const;
+
+    void onCommand(const std::string& command);
+    void emitLines(const std::string& text, uint64_t atUs);
+    void schedule(uint64_t atUs, const std::string& bytes);
+    void transmit();                       // Chunks échus → octets sur la ligne
+
+    std::vector<Rule> rules;
+    bool echo = true;
+    bool silent = false;
+
+    std::vector<Chunk> scheduled;
+    std::deque<WireByte> wire;
+    uint64_t wireFreeUs = 0;
+
+    std::string rxLine;
+    bool afterCr = false;
+    bool inPayload = false;
+    size_t payloadExpected = 0;            // 0 = jusqu'à Ctrl+Z
+    std::string payload;
+    std::string afterPayload;              // Suite de la réponse après la charge utile
+    uint32_t afterPayloadLatencyMs = 0;
+
+    std::vector<std::string> log;
+};
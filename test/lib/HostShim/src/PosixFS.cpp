@@ -0,0 +1,329 @@
+// test/lib/HostShim/src/PosixFS.cpp
+
+#include "PosixFS.h"
+
+#include <dirent.h>
+#include <errno.h>
+#include <stdio.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+
+// ─────────────────────────────────────────────
+// Backend
+// ─────────────────────────────────────────────
+
+class PosixFSImpl : public fs::FSImpl, public std::enable_shared_from_this<PosixFSImpl> {
+public:
+    explicit PosixFSImpl(const char* rootDir) : rootDir(rootDir) {}
+
+    std::string fullPath(const char* path) const
+    {
+        std::string p = path ? path : "";
+        if (p.empty() || p[0] != '/') p = "/" + p;
+        return rootDir + p;
+    }
+
+    fs::FileImplPtr open(const char* path, const char* mode, const bool create) override;
+    bool exists(const char* path) override;
+    bool rename(const char* pathFrom, const char* pathTo) override;
+    bool remove(const char* path) override;
+    bool mkdir(const char* path) override;
+    bool rmdir(const char* path) override;
+
+    size_t usedBytes() const;
+
+    // Octets acceptés pour une écriture de size octets (capacité, panne)
+    size_t admit(size_t size);
+
+    std::string rootDir;
+    size_t capacity = 0;
+    long   failAfter = -1;
+    uint32_t failedWrites = 0;
+};
+
+// ─────────────────────────────────────────────
+// Fichier / répertoire
+// ─────────────────────────────────────────────
+
+class PosixFileImpl : public fs::FileImpl {
+public:
+    PosixFileImpl(std::shared_ptr<PosixFSImpl> owner, const std::string& fwPath,
+                  FILE* file, DIR* dir)
+        : owner(owner), fwPath(fwPath), file(file), dir(dir)
+    {
+        size_t slash = fwPath.find_last_of('/');
+        baseName = slash == std::string::npos ? fwPath : fwPath.substr(slash + 1);
+    }
+
+    ~PosixFileImpl() override { close(); }
+
+    size_t write(const uint8_t* buf, size_t size) override
+    {
+        if (!file) return 0;
+        size_t allowed = owner->admit(size);
+        if (allowed == 0) return 0;
+        return fwrite(buf, 1, allowed, file);
+    }
+
+    size_t read(uint8_t* buf, size_t size) override
+    {
+        return file ? fread(buf, 1, size, file) : 0;
+    }
+
+    void flush() override
+    {
+        if (file) fflush(file);
+    }
+
+    bool seek(uint32_t pos, fs::SeekMode mode) override
+    {
+        if (!file) return false;
+        int whence = mode == fs::SeekSet ? SEEK_SET : mode == fs::SeekCur ? SEEK_CUR : SEEK_END;
+        return fseek(file, (long)pos, whence) == 0;
+    }
+
+    size_t position() const override
+    {
+        if (!file) return 0;
+        long pos = ftell(file);
+        return pos < 0 ? 0 : (size_t)pos;
+    }
+
+    size_t size() const override
+    {
+        if (!file) return 0;
+        fflush(file);
+        struct stat st;
+        return fstat(fileno(file), &st) == 0 ? (size_t)st.st_size : 0;
+    }
+
+    bool setBufferSize(size_t size) override
+    {
+        return file && setvbuf(file, nullptr, _IOFBF, size) == 0;
+    }
+
+    void close() override
+    {
+        if (file) {
+            fclose(file);
+            file = nullptr;
+        }
+        if (dir) {
+            closedir(dir);
+            dir = nullptr;
+        }
+    }
+
+    time_t getLastWrite() override
+    {
+        struct stat st;
+        return stat(owner->fullPath(fwPath.c_str()).c_str(), &st) == 0 ? st.st_mtime : 0;
+    }
+
+    const char* path() const override { return fwPath.c_str(); }
+    const char* name() const override { return baseName.c_str(); }
+    bool isDirectory() override { return dir != nullptr; }
+
+    fs::FileImplPtr openNextFile(const char* mode) override
+    {
+        if (!dir) return nullptr;
+        while (struct dirent* e = readdir(dir)) {
+            if (e->d_name[0] == '.' && (e->d_name[1] == '\0' ||
+                (e->d_name[1] == '.' && e->d_name[2] == '\0'))) {
+                continue;
+            }
+            std::string child = fwPath == "/" ? "/" + std::string(e->d_name)
+                                              : fwPath + "/" + e->d_name;
+            return owner->open(child.c_str(), mode, false);
+        }
+        return nullptr;
+    }
+
+    void rewindDirectory() override
+    {
+        if (dir) rewinddir(dir);
+    }
+
+    operator bool() override { return file != nullptr || dir != nullptr; }
+
+private:
+    std::shared_ptr<PosixFSImpl> owner;
+    std::string fwPath;
+    std::string baseName;
+    FILE* file;
+    DIR* dir;
+};
+
+// ─────────────────────────────────────────────
+// PosixFSImpl
+// ─────────────────────────────────────────────
+
+fs::FileImplPtr PosixFSImpl::open(const char* path, const char* mode, const bool create)
+{
+    (void)create;
+    std::string full = fullPath(path);
+    std::string fwPath = full.substr(rootDir.size());
+
+    struct stat st;
+    if (stat(full.c_str(), &st) == 0 && S_ISDIR(st.st_mode)) {
+        DIR* d = opendir(full.c_str());
+        if (!d) return nullptr;
+        return std::make_shared<PosixFileImpl>(shared_from_this(), fwPath, nullptr, d);
+    }
+
+    const char* posixMode = "rb";
+    if (mode && mode[0] == 'w') posixMode = "wb";
+    else if (mode && mode[0] == 'a') posixMode = "ab";
+
+    FILE* f = fopen(full.c_str(), posixMode);
+    if (!f) return nullptr;
+    // Capacité simulée : pas de tampon stdio, usedBytes() reste exact
+    if (capacity > 0) setvbuf(f, nullptr, _IONBF, 0);
+    return std::make_shared<PosixFileImpl>(shared_from_this(), fwPath, f, nullptr);
+}
+
+bool PosixFSImpl::exists(const char* path)
+{
+    struct stat st;
+    return stat(fullPath(path).c_str(), &st) == 0;
+}
+
+bool PosixFSImpl::rename(const char* pathFrom, const char* pathTo)
+{
+    return ::rename(fullPath(pathFrom).c_str(), fullPath(pathTo).c_str()) == 0;
+}
+
+bool PosixFSImpl::remove(const char* path)
+{
+    return ::unlink(fullPath(path).c_str()) == 0;
+}
+
+bool PosixFSImpl::mkdir(const char* path)
+{
+    return ::mkdir(fullPath(path).c_str(), 0755) == 0 || errno == EEXIST;
+}
+
+bool PosixFSImpl::rmdir(const char* path)
+{
+    return ::rmdir(fullPath(path).c_str()) == 0;
+}
+
+static size_t directoryBytes(const std::string& dirPath)
+{
+    size_t total = 0;
+    DIR* d = opendir(dirPath.c_str());
+    if (!d) return 0;
+    while (struct dirent* e = readdir(d)) {
+        std::string name = e->d_name;
+        if (name == "." || name == "..") continue;
+        std::string child = dirPath + "/" + name;
+        struct stat st;
+        if (stat(child.c_str(), &st) != 0) continue;
+        total += S_ISDIR(st.st_mode) ? directoryBytes(child) : (size_t)st.st_size;
+    }
+    closedir(d);
+    return total;
+}
+
+size_t PosixFSImpl::usedBytes() const
+{
+    return directoryBytes(rootDir);
+}
+
+size_t PosixFSImpl::admit(size_t size)
+{
+    size_t allowed = size;
+
+    if (failAfter >= 0) {
+        if ((size_t)failAfter < allowed) allowed = (size_t)failAfter;
+        failAfter -= (long)allowed;
+    }
+
+    if (capacity > 0 && allowed > 0) {
+        size_t used = usedBytes();
+        size_t room = used < capacity ? capacity - used : 0;
+        if (room < allowed) allowed = room;
+    }
+
+    if (allowed < size) failedWrites++;
+    return allowed;
+}
+
+// ─────────────────────────────────────────────
+// PosixFS
+// ─────────────────────────────────────────────
+
+static void removeTree(const std::string& dirPath, bool removeSelf)
+{
+    DIR* d = opendir(dirPath.c_str());
+    if (d) {
+        while (struct dirent* e = readdir(d)) {
+            std::string name = e->d_name;
+            if (name == "." || name == "..") continue;
+            std::string child = dirPath + "/" + name;
+            struct stat st;
+            if (lstat(child.c_str(), &st) == 0 && S_ISDIR(st.st_mode)) removeTree(child, true);
+            else ::unlink(child.c_str());
+        }
+        closedir(d);
+    }
+    if (removeSelf) ::rmdir(dirPath.c_str());
+}
+
+static void makeTree(const std::string& dirPath)
+{
+    for (size_t i = 1; i <= dirPath.size(); i++) {
+        if (i == dirPath.size() || dirPath[i] == '/') {
+            ::mkdir(dirPath.substr(0, i).c_str(), 0755);
+        }
+    }
+}
+
+PosixFS::PosixFS(const char* rootDir)
+    : fs::FS(std::make_shared<PosixFSImpl>(rootDir))
+{
+    makeTree(impl()->rootDir);
+}
+
+PosixFSImpl* PosixFS::impl() const
+{
+    return static_cast<PosixFSImpl*>(_impl.get());
+}
+
+const char* PosixFS::root() const
+{
+    return impl()->rootDir.c_str();
+}
+
+void PosixFS::clear()
+{
+    removeTree(impl()->rootDir, false);
+    makeTree(impl()->rootDir);
+}
+
+void PosixFS::setCapacity(size_t bytes)
+{
+    impl()->capacity = bytes;
+}
+
+size_t PosixFS::totalBytes() const
+{
+    return impl()->capacity;
+}
+
+size_t PosixFS::usedBytes() const
+{
+    return impl()->usedBytes();
+}
+
+void PosixFS::failWritesAfter(long bytes)
+{
+    impl()->failAfter = bytes;
+}
+
+uint32_t PosixFS::getFailedWrites() const
+{
+    return impl()->failedWrites;
+}
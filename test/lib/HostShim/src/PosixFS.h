@@ -0,0 +1,36 @@
+// test/lib/HostShim/src/PosixFS.h
+// fs::FS sur un répertoire de l'hôte (FileSystem::setFs dans les tests)
+//
+// - Chemins firmware ("/datalog.csv") résolus sous rootDir
+// - Capacité simulée : une écriture qui dépasserait la capacité est
+//   tronquée (write() court), comme une partition LittleFS pleine
+// - Injection de panne : failWritesAfter(n) accepte encore n octets puis
+//   fait échouer toutes les écritures (coupure, flash usée)
+
+#pragma once
+
+#include "FS.h"
+
+class PosixFSImpl;
+
+class PosixFS : public fs::FS {
+public:
+    explicit PosixFS(const char* rootDir);
+
+    const char* root() const;
+
+    // Supprime tout le contenu de rootDir (crée le répertoire si absent)
+    void clear();
+
+    // 0 = illimitée
+    void setCapacity(size_t bytes);
+    size_t totalBytes() const;
+    size_t usedBytes() const;
+
+    // n octets encore acceptés puis échec ; -1 = désactivé
+    void failWritesAfter(long bytes);
+    uint32_t getFailedWrites() const;
+
+protected:
+    PosixFSImpl* impl() const;
+};
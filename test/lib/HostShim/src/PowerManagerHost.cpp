@@ -0,0 +1,15 @@
+// test/lib/HostShim/src/PowerManagerHost.cpp
+// PowerManager hôte (Core/PowerManager.cpp exclu de env:native) :
+// état PMU lu dans HostSim
+
+#include "Core/PowerManager.h"
+#include "HostSim.h"
+
+void PowerManager::init() {}
+void PowerManager::update() {}
+
+bool PowerManager::isPmuDetected()           { return HostSim::isPmuDetected(); }
+float PowerManager::getBatteryVoltage()      { return HostSim::getBatteryVoltage(); }
+int PowerManager::getBatteryPercent()        { return HostSim::getBatteryPercent(); }
+bool PowerManager::isCharging()              { return HostSim::isCharging(); }
+bool PowerManager::isExternalPowerPresent()  { return HostSim::isExternalPowerPresent(); }
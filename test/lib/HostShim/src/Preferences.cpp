@@ -0,0 +1,125 @@
+// test/lib/HostShim/src/Preferences.cpp
+
+#include "Preferences.h"
+
+#include <map>
+#include <string>
+
+// Valeurs stockées sous forme texte, clé = "espace/clé"
+static std::map<std::string, std::string>& store()
+{
+    static std::map<std::string, std::string> values;
+    return values;
+}
+
+static std::string fullKey(const String& space, const char* key)
+{
+    return std::string(space.c_str()) + "/" + (key ? key : "");
+}
+
+bool Preferences::begin(const char* name, bool readOnly, const char* partitionLabel)
+{
+    (void)partitionLabel;
+    if (!name || !*name) return false;
+    space = name;
+    opened = true;
+    this->readOnly = readOnly;
+    return true;
+}
+
+void Preferences::end()
+{
+    opened = false;
+}
+
+bool Preferences::clear()
+{
+    if (!writable()) return false;
+    std::string prefix = fullKey(space, "");
+    auto& values = store();
+    for (auto it = values.begin(); it != values.end();) {
+        if (it->first.compare(0, prefix.size(), prefix) == 0) it = values.erase(it);
+        else ++it;
+    }
+    return true;
+}
+
+bool Preferences::remove(const char* key)
+{
+    if (!writable()) return false;
+    return store().erase(fullKey(space, key)) > 0;
+}
+
+bool Preferences::isKey(const char* key)
+{
+    return opened && store().count(fullKey(space, key)) > 0;
+}
+
+size_t Preferences::putBool(const char* key, bool value)
+{
+    return putUChar(key, value ? 1 : 0);
+}
+
+size_t Preferences::putUChar(const char* key, uint8_t value)
+{
+    if (!writable()) return 0;
+    store()[fullKey(space, key)] = std::to_string(value);
+    return 1;
+}
+
+size_t Preferences::putInt(const char* key, int32_t value)
+{
+    if (!writable()) return 0;
+    store()[fullKey(space, key)] = std::to_string(value);
+    return 4;
+}
+
+size_t Preferences::putUInt(const char* key, uint32_t value)
+{
+    if (!writable()) return 0;
+    store()[fullKey(space, key)] = std::to_string(value);
+    return 4;
+}
+
+size_t Preferences::putString(const char* key, const char* value)
+{
+    if (!writable() || !value) return 0;
+    store()[fullKey(space, key)] = value;
+    return strlen(value);
+}
+
+bool Preferences::getBool(const char* key, bool defaultValue)
+{
+    return getUChar(key, defaultValue ? 1 : 0) != 0;
+}
+
+uint8_t Preferences::getUChar(const char* key, uint8_t defaultValue)
+{
+    return (uint8_t)getUInt(key, defaultValue);
+}
+
+int32_t Preferences::getInt(const char* key, int32_t defaultValue)
+{
+    if (!opened) return defaultValue;
+    auto it = store().find(fullKey(space, key));
+    return it == store().end() ? defaultValue : (int32_t)strtol(it->second.c_str(), nullptr, 10);
+}
+
+uint32_t Preferences::getUInt(const char* key, uint32_t defaultValue)
+{
+    if (!opened) return defaultValue;
+    auto it = store().find(fullKey(space, key));
+    return it == store().end() ? defaultValue : (uint32_t)strtoul(it->second.c_str(), nullptr, 10);
+}
+
+String Preferences::getString(const char* key, const String& defaultValue)
+{
+    if (!opened) return defaultValue;
+    auto it = store().find(fullKey(space, key));
+    return it == store().end() ? defaultValue : String(it->second);
+}
+
+void Preferences::hostClearAll()
+{
+    store().clear();
+}
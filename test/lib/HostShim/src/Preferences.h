@@ -0,0 +1,42 @@
+// test/lib/HostShim/src/Preferences.h
+// NVS en mémoire : espaces de noms partagés par toutes les instances,
+// conservés jusqu'à Preferences::hostClearAll() (reboot simulé = conservé)
+
+#pragma once
+
+#include "Arduino.h"
+
+class Preferences {
+public:
+    bool begin(const char* name, bool readOnly = false, const char* partitionLabel = nullptr);
+    void end();
+
+    bool clear();
+    bool remove(const char* key);
+    bool isKey(const char* key);
+
+    size_t putBool(const char* key, bool value);
+    size_t putUChar(const char* key, uint8_t value);
+    size_t putInt(const char* key, int32_t value);
+    size_t putUInt(const char* key, uint32_t value);
+    size_t putULong(const char* key, uint32_t value) { return putUInt(key, value); }
+    size_t putString(const char* key, const char* value);
+    size_t putString(const char* key, const String& value) { return putString(key, value.c_str()); }
+
+    bool     getBool(const char* key, bool defaultValue = false);
+    uint8_t  getUChar(const char* key, uint8_t defaultValue = 0);
+    int32_t  getInt(const char* key, int32_t defaultValue = 0);
+    uint32_t getUInt(const char* key, uint32_t defaultValue = 0);
+    uint32_t getULong(const char* key, uint32_t defaultValue = 0) { return getUInt(key, defaultValue); }
+    String   getString(const char* key, const String& defaultValue = String());
+
+    // Hôte uniquement : efface la NVS simulée (flash neuve)
+    static void hostClearAll();
+
+private:
+    bool writable() const { return opened && !readOnly; }
+
+    String space;
+    bool opened = false;
+    bool readOnly = false;
+};
@@ -0,0 +1,24 @@
+// test/lib/HostShim/src/SPIFFS.h
+// Aucune partition SPIFFS héritée sur l'hôte : begin() échoue toujours
+
+#pragma once
+
+#include "FS.h"
+
+class SPIFFSFS : public fs::FS {
+public:
+    SPIFFSFS() : fs::FS(nullptr) {}
+
+    bool begin(bool formatOnFail = false, const char* basePath = "/spiffs",
+               uint8_t maxOpenFiles = 10, const char* partitionLabel = nullptr)
+    {
+        (void)formatOnFail; (void)basePath; (void)maxOpenFiles; (void)partitionLabel;
+        return false;
+    }
+    void end() {}
+    bool format() { return false; }
+    size_t totalBytes() { return 0; }
+    size_t usedBytes() { return 0; }
+};
+
+extern SPIFFSFS SPIFFS;
@@ -0,0 +1,97 @@
+// test/lib/HostShim/src/TinyGsmClient.h
+// Sous-ensemble TinyGSM 0.12 utilisé par le firmware (sendAT, waitResponse,
+// testAT), mêmes boucles d'attente que TinyGsmModem.tpp / SIM7080 :
+// sendAT() écrit "AT…\r\n" puis cède (delay(0)), waitResponse() lit octet
+// par octet jusqu'à une réponse attendue ou l'expiration, en cédant à
+// chaque tour. La gestion des URC de sockets (+CARECV, +CASTATE…) est omise.
+
+#pragma once
+
+#include "Arduino.h"
+
+#define GSM_NL "\r\n"
+
+static const char GSM_OK[]        = "OK" GSM_NL;
+static const char GSM_ERROR[]     = "ERROR" GSM_NL;
+static const char GSM_CME_ERROR[] = GSM_NL "+CME ERROR:";
+static const char GSM_CMS_ERROR[] = GSM_NL "+CMS ERROR:";
+
+class TinyGsm {
+public:
+    explicit TinyGsm(Stream& stream) : stream(stream) {}
+
+    template <typename... Args>
+    void sendAT(Args... cmd)
+    {
+        streamWrite("AT", cmd..., GSM_NL);
+        stream.flush();
+        delay(0);
+    }
+
+    int8_t waitResponse(uint32_t timeoutMs, String& data,
+                        const char* r1 = GSM_OK, const char* r2 = GSM_ERROR,
+                        const char* r3 = GSM_CME_ERROR, const char* r4 = GSM_CMS_ERROR,
+                        const char* r5 = nullptr)
+    {
+        data.reserve(64);
+        int8_t index = 0;
+        uint32_t start = millis();
+        do {
+            delay(0);
+            while (stream.available() > 0) {
+                delay(0);
+                int8_t a = (int8_t)stream.read();
+                if (a <= 0) continue;
+                data += (char)a;
+                if (r1 && data.endsWith(r1))      { index = 1; break; }
+                else if (r2 && data.endsWith(r2)) { index = 2; break; }
+                else if (r3 && data.endsWith(r3)) { index = 3; break; }
+                else if (r4 && data.endsWith(r4)) { index = 4; break; }
+                else if (r5 && data.endsWith(r5)) { index = 5; break; }
+            }
+        } while (index == 0 && millis() - start < timeoutMs);
+
+        if (!index) data = "";
+        return index;
+    }
+
+    int8_t waitResponse(uint32_t timeoutMs,
+                        const char* r1 = GSM_OK, const char* r2 = GSM_ERROR,
+                        const char* r3 = GSM_CME_ERROR, const char* r4 = GSM_CMS_ERROR,
+                        const char* r5 = nullptr)
+    {
+        String data;
+        return waitResponse(timeoutMs, data, r1, r2, r3, r4, r5);
+    }
+
+    int8_t waitResponse()
+    {
+        return waitResponse(1000);
+    }
+
+    bool testAT(uint32_t timeoutMs = 10000L)
+    {
+        for (uint32_t start = millis(); millis() - start < timeoutMs;) {
+            sendAT("");
+            if (waitResponse(200) == 1) return true;
+            delay(100);
+        }
+        return false;
+    }
+
+    Stream& stream;
+
+private:
+    template <typename T>
+    void streamWrite(T last)
+    {
+        stream.print(last);
+    }
+
+    template <typename T, typename... Args>
+    void streamWrite(T head, Args... tail)
+    {
+        stream.print(head);
+        streamWrite(tail...);
+    }
+};
@@ -0,0 +1,193 @@
+// test/lib/HostShim/src/WString.cpp
+
+#include "WString.h"
+
+#include <ctype.h>
+#include <cmath>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ─────────────────────────────────────────────
+// Conversions numériques (mêmes règles que ltoa/ultoa/dtostrf)
+// ─────────────────────────────────────────────
+
+static std::string toBase(unsigned long long value, unsigned char base, bool negative)
+{
+    if (base < 2 || base > 36) base = 10;
+    char buf[72];
+    char* p = buf + sizeof(buf);
+    *--p = '\0';
+    do {
+        unsigned digit = (unsigned)(value % base);
+        *--p = (char)(digit < 10 ? '0' + digit : 'a' + digit - 10);
+        value /= base;
+    } while (value);
+    if (negative) *--p = '-';
+    return std::string(p);
+}
+
+static std::string signedToBase(long long value, unsigned char base)
+{
+    // Base 10 : signe explicite ; autres bases : complément à deux (ltoa)
+    if (base == 10 && value < 0) {
+        return toBase(0ULL - (unsigned long long)value, base, true);
+    }
+    return toBase((unsigned long long)value, base, false);
+}
+
+String::String(unsigned char value, unsigned char base) : s(toBase(value, base, false)) {}
+String::String(int value, unsigned char base)
+    : s(base == 10 ? signedToBase(value, base) : toBase((unsigned int)value, base, false)) {}
+String::String(unsigned int value, unsigned char base) : s(toBase(value, base, false)) {}
+String::String(long value, unsigned char base)
+    : s(base == 10 ? signedToBase(value, base) : toBase((unsigned long)value, base, false)) {}
+String::String(unsigned long value, unsigned char base) : s(toBase(value, base, false)) {}
+String::String(long long value, unsigned char base) : s(signedToBase(value, base)) {}
+String::String(unsigned long long value, unsigned char base) : s(toBase(value, base, false)) {}
+
+String::String(float value, unsigned int decimalPlaces) : String((double)value, decimalPlaces) {}
+
+String::String(double value, unsigned int decimalPlaces)
+{
+    if (std::isnan(value)) { s = "nan"; return; }
+    if (std::isinf(value)) { s = value < 0 ? "-inf" : "inf"; return; }
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.*f", (int)decimalPlaces, value);
+    s = buf;
+}
+
+// ─────────────────────────────────────────────
+// Comparaison
+// ─────────────────────────────────────────────
+
+bool String::equalsIgnoreCase(const String& other) const
+{
+    if (s.size() != other.s.size()) return false;
+    for (size_t i = 0; i < s.size(); i++) {
+        if (tolower((unsigned char)s[i]) != tolower((unsigned char)other.s[i])) return false;
+    }
+    return true;
+}
+
+bool String::startsWith(const String& prefix, unsigned int offset) const
+{
+    if (offset > s.size()) return false;
+    return s.compare(offset, prefix.s.size(), prefix.s) == 0;
+}
+
+bool String::endsWith(const String& suffix) const
+{
+    if (suffix.s.size() > s.size()) return false;
+    return s.compare(s.size() - suffix.s.size(), suffix.s.size(), suffix.s) == 0;
+}
+
+// ─────────────────────────────────────────────
+// Recherche / extraction
+// ─────────────────────────────────────────────
+
+int String::indexOf(char c, unsigned int from) const
+{
+    size_t pos = s.find(c, from);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::indexOf(const String& str, unsigned int from) const
+{
+    size_t pos = s.find(str.s, from);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::lastIndexOf(char c) const
+{
+    size_t pos = s.rfind(c);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::lastIndexOf(const String& str) const
+{
+    size_t pos = s.rfind(str.s);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+String String::substring(unsigned int beginIndex) const
+{
+    return substring(beginIndex, length());
+}
+
+String String::substring(unsigned int beginIndex, unsigned int endIndex) const
+{
+    if (beginIndex > endIndex) std::swap(beginIndex, endIndex);
+    if (beginIndex >= s.size()) return String();
+    if (endIndex > s.size()) endIndex = (unsigned int)s.size();
+    return String(s.substr(beginIndex, endIndex - beginIndex));
+}
+
+// ─────────────────────────────────────────────
+// Modification
+// ─────────────────────────────────────────────
+
+void String::replace(char find, char replacement)
+{
+    for (char& c : s) {
+        if (c == find) c = replacement;
+    }
+}
+
+void String::replace(const String& find, const String& replacement)
+{
+    if (find.s.empty()) return;
+    size_t pos = 0;
+    while ((pos = s.find(find.s, pos)) != std::string::npos) {
+        s.replace(pos, find.s.size(), replacement.s);
+        pos += replacement.s.size();
+    }
+}
+
+void String::remove(unsigned int index)
+{
+    if (index < s.size()) s.erase(index);
+}
+
+void String::remove(unsigned int index, unsigned int count)
+{
+    if (index < s.size()) s.erase(index, count);
+}
+
+void String::toLowerCase()
+{
+    for (char& c : s) c = (char)tolower((unsigned char)c);
+}
+
+void String::toUpperCase()
+{
+    for (char& c : s) c = (char)toupper((unsigned char)c);
+}
+
+void String::trim()
+{
+    size_t begin = 0;
+    while (begin < s.size() && isspace((unsigned char)s[begin])) begin++;
+    size_t end = s.size();
+    while (end > begin && isspace((unsigned char)s[end - 1])) end--;
+    s = s.substr(begin, end - begin);
+}
+
+// ─────────────────────────────────────────────
+// Conversion
+// ─────────────────────────────────────────────
+
+long String::toInt() const
+{
+    return atol(s.c_str());
+}
+
+float String::toFloat() const
+{
+    return (float)atof(s.c_str());
+}
+
+double String::toDouble() const
+{
+    return atof(s.c_str());
+}
@@ -0,0 +1,103 @@
+// test/lib/HostShim/src/WString.h
+// String Arduino adossée à std::string (sous-ensemble utilisé par le firmware)
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string>
+
+class String {
+public:
+    String() = default;
+    String(const char* cstr) : s(cstr ? cstr : "") {}
+    String(const char* cstr, size_t len) : s(cstr ? cstr : "", cstr ? len : 0) {}
+    explicit String(const std::string& str) : s(str) {}
+    explicit String(char c) : s(1, c) {}
+    explicit String(unsigned char value, unsigned char base = 10);
+    explicit String(int value, unsigned char base = 10);
+    explicit String(unsigned int value, unsigned char base = 10);
+    explicit String(long value, unsigned char base = 10);
+    explicit String(unsigned long value, unsigned char base = 10);
+    explicit String(long long value, unsigned char base = 10);
+    explicit String(unsigned long long value, unsigned char base = 10);
+    explicit String(float value, unsigned int decimalPlaces = 2);
+    explicit String(double value, unsigned int decimalPlaces = 2);
+
+    // Accès
+    unsigned int length() const { return (unsigned int)s.size(); }
+    const char* c_str() const { return s.c_str(); }
+    bool isEmpty() const { return s.empty(); }
+    bool reserve(unsigned int size) { s.reserve(size); return true; }
+    char charAt(unsigned int index) const { return index < s.size() ? s[index] : 0; }
+    void setCharAt(unsigned int index, char c) { if (index < s.size()) s[index] = c; }
+    char operator[](unsigned int index) const { return charAt(index); }
+    char& operator[](unsigned int index) { return s[index]; }
+
+    // Concaténation
+    bool concat(const String& str) { s += str.s; return true; }
+    bool concat(const char* cstr) { if (cstr) s += cstr; return cstr != nullptr; }
+    bool concat(const char* cstr, unsigned int len) { if (cstr) s.append(cstr, len); return cstr != nullptr; }
+    bool concat(char c) { s += c; return true; }
+    bool concat(unsigned char num) { return concat(String(num)); }
+    bool concat(int num) { return concat(String(num)); }
+    bool concat(unsigned int num) { return concat(String(num)); }
+    bool concat(long num) { return concat(String(num)); }
+    bool concat(unsigned long num) { return concat(String(num)); }
+    bool concat(long long num) { return concat(String(num)); }
+    bool concat(unsigned long long num) { return concat(String(num)); }
+    bool concat(float num) { return concat(String(num)); }
+    bool concat(double num) { return concat(String(num)); }
+
+    template <typename T>
+    String& operator+=(const T& rhs) { concat(rhs); return *this; }
+
+    // Comparaison
+    bool equals(const String& other) const { return s == other.s; }
+    bool equals(const char* cstr) const { return s == (cstr ? cstr : ""); }
+    bool equalsIgnoreCase(const String& other) const;
+    bool operator==(const String& other) const { return s == other.s; }
+    bool operator==(const char* cstr) const { return equals(cstr); }
+    bool operator!=(const String& other) const { return s != other.s; }
+    bool operator!=(const char* cstr) const { return !equals(cstr); }
+    bool operator<(const String& other) const { return s < other.s; }
+    int compareTo(const String& other) const { return s.compare(other.s); }
+    bool startsWith(const String& prefix) const { return s.compare(0, prefix.s.size(), prefix.s) == 0; }
+    bool startsWith(const String& prefix, unsigned int offset) const;
+    bool endsWith(const String& suffix) const;
+
+    // Recherche / extraction
+    int indexOf(char c, unsigned int from = 0) const;
+    int indexOf(const String& str, unsigned int from = 0) const;
+    int lastIndexOf(char c) const;
+    int lastIndexOf(const String& str) const;
+    String substring(unsigned int beginIndex) const;
+    String substring(unsigned int beginIndex, unsigned int endIndex) const;
+
+    // Modification
+    void replace(char find, char replacement);
+    void replace(const String& find, const String& replacement);
+    void remove(unsigned int index);
+    void remove(unsigned int index, unsigned int count);
+    void toLowerCase();
+    void toUpperCase();
+    void trim();
+    void clear() { s.clear(); }
+
+    // Conversion
+    long toInt() const;
+    float toFloat() const;
+    double toDouble() const;
+
+    const std::string& str() const { return s; }
+
+private:
+    std::string s;
+};
+
+template <typename T>
+inline String operator+(String lhs, const T& rhs) { lhs += rhs; return lhs; }
+inline String operator+(const char* lhs, const String& rhs) { String out(lhs); out += rhs; return out; }
+inline String operator+(char lhs, const String& rhs) { String out(lhs); out += rhs; return out; }
+inline bool operator==(const char* lhs, const String& rhs) { return rhs.equals(lhs); }
+inline bool operator!=(const char* lhs, const String& rhs) { return !rhs.equals(lhs); }
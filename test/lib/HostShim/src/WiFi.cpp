@@ -0,0 +1,21 @@
+// test/lib/HostShim/src/WiFi.cpp
+
+#include "WiFi.h"
+#include "HostSim.h"
+
+WiFiClass WiFi;
+
+wl_status_t WiFiClass::status()
+{
+    return HostSim::isWifiConnected() ? WL_CONNECTED : WL_DISCONNECTED;
+}
+
+int8_t WiFiClass::RSSI()
+{
+    return (int8_t)HostSim::getWifiRssi();
+}
+
+IPAddress WiFiClass::localIP()
+{
+    return HostSim::isWifiConnected() ? IPAddress(192, 168, 1, 150) : IPAddress();
+}
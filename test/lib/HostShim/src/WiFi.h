@@ -0,0 +1,27 @@
+// test/lib/HostShim/src/WiFi.h
+// État Wi-Fi lu dans HostSim (la machine d'états WiFiManager est remplacée
+// par WiFiManagerHost.cpp)
+
+#pragma once
+
+#include "Arduino.h"
+
+typedef enum {
+    WL_NO_SHIELD       = 255,
+    WL_IDLE_STATUS     = 0,
+    WL_NO_SSID_AVAIL   = 1,
+    WL_SCAN_COMPLETED  = 2,
+    WL_CONNECTED       = 3,
+    WL_CONNECT_FAILED  = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_DISCONNECTED    = 6
+} wl_status_t;
+
+class WiFiClass {
+public:
+    wl_status_t status();
+    int8_t RSSI();
+    IPAddress localIP();
+};
+
+extern WiFiClass WiFi;
@@ -0,0 +1,25 @@
+// test/lib/HostShim/src/WiFiManagerHost.cpp
+// WiFiManager hôte (Connectivity/WifiManager.cpp exclu de env:native) :
+// STA activé, connexion pilotée par HostSim::setWifiConnected(), pas d'AP
+
+#include "Connectivity/WifiManager.h"
+#include "HostSim.h"
+
+void WiFiManager::init() {}
+void WiFiManager::handle() {}
+void WiFiManager::disableAP() {}
+void WiFiManager::setSTAEnabled(bool enabled) { (void)enabled; }
+
+bool WiFiManager::isSTAEnabled()   { return true; }
+bool WiFiManager::isSTAConnected() { return HostSim::isWifiConnected(); }
+bool WiFiManager::isAPEnabled()    { return false; }
+
+String WiFiManager::getSTAStatus()
+{
+    return HostSim::isWifiConnected() ? "Connecté" : "Déconnecté";
+}
+
+String WiFiManager::getAPStatus()
+{
+    return "Désactivé";
+}
@@ -0,0 +1,6 @@
+// test/lib/HostShim/src/XPowersLib.h
+// Type PMU seul : PowerManager est remplacé par PowerManagerHost.cpp
+
+#pragma once
+
+class XPowersAXP2101 {};
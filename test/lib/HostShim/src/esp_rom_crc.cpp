@@ -0,0 +1,28 @@
+// test/lib/HostShim/src/esp_rom_crc.cpp
+
+#include "esp_rom_crc.h"
+
+static uint32_t table[256];
+static bool tableReady = false;
+
+static void buildTable()
+{
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t c = i;
+        for (int k = 0; k < 8; k++) {
+            c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+        }
+        table[i] = c;
+    }
+    tableReady = true;
+}
+
+extern "C" uint32_t esp_rom_crc32_le(uint32_t crc, const uint8_t* buf, uint32_t len)
+{
+    if (!tableReady) buildTable();
+    crc = ~crc;
+    while (len--) {
+        crc = table[(crc ^ *buf++) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
@@ -0,0 +1,17 @@
+// test/lib/HostShim/src/esp_rom_crc.h
+// CRC32 de la ROM ESP32 (polynôme 0xEDB88320, inversions internes :
+// résultat identique à zlib crc32())
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint32_t esp_rom_crc32_le(uint32_t crc, const uint8_t* buf, uint32_t len);
+
+#ifdef __cplusplus
+}
+#endif
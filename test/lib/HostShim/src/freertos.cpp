@@ -0,0 +1,85 @@
+// test/lib/HostShim/src/freertos.cpp
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "Arduino.h"
+
+// ─────────────────────────────────────────────
+// Tâches
+// ─────────────────────────────────────────────
+
+// Poignée factice non nulle : l'appelant croit sa tâche créée
+static int dummyTask;
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stackDepth,
+                                   void* param, UBaseType_t priority, TaskHandle_t* handle,
+                                   BaseType_t coreId)
+{
+    (void)fn; (void)name; (void)stackDepth; (void)param; (void)priority; (void)coreId;
+    if (handle) *handle = &dummyTask;
+    return pdPASS;
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    delay(ticks);
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return (TickType_t)millis();
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    (void)task;
+    return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticksToWait)
+{
+    (void)clearOnExit;
+    (void)ticksToWait;
+    return 0;
+}
+
+// ─────────────────────────────────────────────
+// Mutex
+// ─────────────────────────────────────────────
+
+struct HostSemaphore {
+    bool taken = false;
+};
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return new HostSemaphore();
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticksToWait)
+{
+    if (!sem) return pdFALSE;
+    if (sem->taken) {
+        if (ticksToWait == portMAX_DELAY) {
+            fprintf(stderr, "[HostShim] Interblocage : mutex repris par la même tâche\n");
+            abort();
+        }
+        delay(ticksToWait);
+        return pdFALSE;
+    }
+    sem->taken = true;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+    if (!sem || !sem->taken) return pdFALSE;
+    sem->taken = false;
+    return pdTRUE;
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem)
+{
+    delete sem;
+}
@@ -0,0 +1,32 @@
+// test/lib/HostShim/src/freertos/FreeRTOS.h
+// Types et macros FreeRTOS pour un hôte mono-tâche : les sections
+// critiques sont vides, aucune préemption ne peut les traverser
+
+#pragma once
+
+#include <stdint.h>
+
+typedef int          BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t     TickType_t;
+
+#define pdFALSE ((BaseType_t)0)
+#define pdTRUE  ((BaseType_t)1)
+#define pdPASS  pdTRUE
+#define pdFAIL  pdFALSE
+
+#define portMAX_DELAY      ((TickType_t)0xffffffffUL)
+#define portTICK_PERIOD_MS ((TickType_t)1)
+#define pdMS_TO_TICKS(ms)  ((TickType_t)(ms))
+
+typedef struct {
+    uint32_t owner;
+    uint32_t count;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED {0, 0}
+
+#define portENTER_CRITICAL(mux)     do { (mux)->count++; } while (0)
+#define portEXIT_CRITICAL(mux)      do { (mux)->count--; } while (0)
+#define portENTER_CRITICAL_ISR(mux) portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL_ISR(mux)  portEXIT_CRITICAL(mux)
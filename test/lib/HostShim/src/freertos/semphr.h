@@ -0,0 +1,15 @@
+// test/lib/HostShim/src/freertos/semphr.h
+// Mutex mono-tâche : une reprise sans libération est un interblocage
+// réel sur la cible, signalé ici par un abort()
+
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+struct HostSemaphore;
+typedef HostSemaphore* SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticksToWait);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem);
+void vSemaphoreDelete(SemaphoreHandle_t sem);
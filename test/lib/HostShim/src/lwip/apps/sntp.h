@@ -0,0 +1,15 @@
+// test/lib/HostShim/src/lwip/apps/sntp.h
+// SNTP simulé : configTzTime() lance une requête, terminée après la latence
+// NTP de HostSim si le Wi-Fi est connecté et le serveur joignable
+
+#pragma once
+
+typedef enum {
+    SNTP_SYNC_STATUS_RESET,
+    SNTP_SYNC_STATUS_COMPLETED,
+    SNTP_SYNC_STATUS_IN_PROGRESS
+} sntp_sync_status_t;
+
+void sntp_stop(void);
+void sntp_set_sync_status(sntp_sync_status_t status);
+sntp_sync_status_t sntp_get_sync_status(void);
@@ -0,0 +1,19 @@
+// test/lib/HostShim/src/sntp.cpp
+
+#include "lwip/apps/sntp.h"
+#include "HostSim.h"
+
+void sntp_stop(void)
+{
+    HostSim::sntpStop();
+}
+
+void sntp_set_sync_status(sntp_sync_status_t status)
+{
+    if (status == SNTP_SYNC_STATUS_RESET) HostSim::sntpReset();
+}
+
+sntp_sync_status_t sntp_get_sync_status(void)
+{
+    return HostSim::sntpPoll() ? SNTP_SYNC_STATUS_COMPLETED : SNTP_SYNC_STATUS_RESET;
+}
@@ -0,0 +1,307 @@
+// test/test_bench/test_main.cpp
+// Banc de performance du stockage sur l'hôte
+//
+// Génère BENCH_DAYS jours de données synthétiques multi-séries (une mesure
+// par série toutes les BENCH_PERIOD_S secondes, temps simulé), puis mesure
+// chaque opération de stockage en temps réel hôte :
+//   push, flush, scan complet (init), dernière valeur, requêtes de graphe
+//   (à froid par fenêtre, en cache, incrémentale) et getGraphCsv
+// Par opération : débit (enregistrements/s), octets/enregistrement,
+// p50/p99/max (PerfCounter, même format que GET /api/perf) et pic de tas
+// (heap_caps + new/delete, cf. HostHeap)
+//
+// Sortie JSON sur stdout et dans BENCH_OUTPUT (défaut .pio/bench_storage.json)
+//
+// pio test -e native -f test_bench
+// BENCH_DAYS=30 BENCH_PERIOD_S=300 pio test -e native -f test_bench
+
+#include <unity.h>
+#include <Arduino.h>
+#include <HostHeap.h>
+#include <HostSim.h>
+#include <PosixFS.h>
+
+#include "Storage/DataLogger.h"
+#include "Storage/FileSystem.h"
+#include "Storage/GraphCache.h"
+#include "Utils/Clock.h"
+#include "Utils/PerfCounter.h"
+
+static PosixFS benchFs(".pio/bench_fs");
+
+// ─────────────────────────────────────────────
+// Paramètres
+// ─────────────────────────────────────────────
+
+static uint32_t envOr(const char* name, uint32_t fallback)
+{
+    const char* v = getenv(name);
+    return (v && *v) ? (uint32_t)strtoul(v, nullptr, 10) : fallback;
+}
+
+static const DataId NUMERIC_SERIES[] = {
+    DataId::BatteryVoltage, DataId::BatteryPercent,
+    DataId::AirTemperature, DataId::AirHumidity,
+    DataId::SoilMoisture1,  DataId::SoilMoisture2,
+    DataId::WifiRssi,       DataId::CellularRssi
+};
+static constexpr size_t SERIES_COUNT = sizeof(NUMERIC_SERIES) / sizeof(NUMERIC_SERIES[0]);
+
+// Lot ajouté entre deux requêtes incrémentales (= FLUSH_SIZE du DataLogger)
+static constexpr uint32_t BATCH = 50;
+
+// ─────────────────────────────────────────────
+// Horloge : temps simulé pour les données, temps réel pour les mesures
+// ─────────────────────────────────────────────
+
+static time_t utcAtStart = HostSim::DEFAULT_UTC;
+static uint32_t startMs = 0;
+
+static uint32_t benchNowMs() { return millis(); }
+static bool     benchUtcValid() { return true; }
+static time_t   benchNowUtc() { return utcAtStart + (time_t)((millis() - startMs) / 1000); }
+static time_t   benchUtcFromRelative(uint32_t relMs)
+{
+    return utcAtStart + (time_t)((relMs - startMs) / 1000);
+}
+
+static const ClockSource benchClock = {
+    benchNowMs, benchUtcValid, benchNowUtc, benchUtcFromRelative
+};
+
+// ─────────────────────────────────────────────
+// Sortie JSON
+// ─────────────────────────────────────────────
+
+class StringPrint : public Print {
+public:
+    using Print::write;
+    size_t write(uint8_t c) override { text += (char)c; return 1; }
+    size_t write(const uint8_t* buf, size_t size) override
+    {
+        text.concat((const char*)buf, size);
+        return size;
+    }
+    String text;
+};
+
+static StringPrint json;
+static bool firstOp = true;
+
+static void writeOp(const char* name, const PerfCounter& perf, size_t peakHeap,
+                    double bytesPerRecord = -1.0)
+{
+    double seconds = perf.getTotalUs() / 1e6;
+    double rate = seconds > 0 ? perf.getItems() / seconds : 0.0;
+
+    json.printf("%s\n    \"%s\": {\"perf\":", firstOp ? "" : ",", name);
+    perf.writeJson(json);
+    json.printf(",\"recordsPerS\":%.0f,\"peakHeapBytes\":%lu", rate, (unsigned long)peakHeap);
+    if (bytesPerRecord >= 0) json.printf(",\"bytesPerRecord\":%.2f", bytesPerRecord);
+    json.print("}");
+    firstOp = false;
+}
+
+// Pic de tas d'une phase, au-dessus du niveau au début de la phase
+static size_t phaseBase = 0;
+static void beginPhase()
+{
+    HostHeap::resetPeak();
+    phaseBase = HostHeap::current();
+}
+static size_t phasePeak()
+{
+    return HostHeap::peak() - phaseBase;
+}
+
+// ─────────────────────────────────────────────
+// Génération
+// ─────────────────────────────────────────────
+
+// Valeur plausible : cycle journalier + bruit déterministe
+static float syntheticValue(size_t series, uint32_t sample)
+{
+    uint32_t h = (sample * 2654435761u) ^ (uint32_t)(series * 40503u);
+    float noise = (float)(h % 1000) / 1000.0f;
+    float day = sinf((float)(sample % 1440) * 0.00436f);
+    return 10.0f * (float)series + 5.0f * day + noise;
+}
+
+// items = enregistrements parcourus (scanned != 0, requête à froid)
+// ou lignes servies (requête en cache / incrémentale)
+static void measureQuery(PerfCounter& perf, DataId id, uint32_t daysBack,
+                         uint32_t& rows, uint32_t scanned = 0)
+{
+    GraphCache::Result r;
+    uint32_t t0 = micros();
+    TEST_ASSERT_TRUE(GraphCache::query(id, daysBack, r));
+    perf.record(micros() - t0, scanned ? scanned : r.rows);
+    rows = r.rows;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_storage_benchmark()
+{
+    const uint32_t days = envOr("BENCH_DAYS", 90);
+    const uint32_t periodS = envOr("BENCH_PERIOD_S", 60);
+    const char* outPath = getenv("BENCH_OUTPUT");
+    if (!outPath || !*outPath) outPath = ".pio/bench_storage.json";
+
+    HostSim::reset(0);
+    HostSim::setRealTime(true);
+    startMs = millis();
+    benchFs.clear();
+    FileSystem::setFs(benchFs);
+    Clock::setSource(&benchClock);
+    GraphCache::init();
+    DataLogger::clearHistory();
+    DataLogger::init();
+
+    const uint32_t samples = days * 86400UL / periodS;
+    const DataLoggerPerf& perf = DataLogger::getPerf();
+
+    // ── Ingestion : push + handle (flush tous les FLUSH_SIZE) ──
+    beginPhase();
+    size_t ingestBase = phaseBase;
+    size_t pushPeak = 0;
+    for (uint32_t s = 0; s < samples; s++) {
+        for (size_t k = 0; k < SERIES_COUNT; k++) {
+            DataLogger::push(DataType::Sensor, NUMERIC_SERIES[k], syntheticValue(k, s));
+            DataLogger::handle();
+        }
+        // Texte occasionnel (changement d'opérateur / IP)
+        if (s % 1440 == 0) {
+            DataLogger::push(DataType::System, DataId::CellularOperator,
+                             String(s % 2880 ? "Orange F" : "SFR"));
+        }
+        HostSim::advanceMs(periodS * 1000);
+    }
+    DataLogger::flush();
+    pushPeak = HostHeap::peak() - ingestBase;
+
+    TEST_ASSERT_EQUAL(0, DataLogger::getPendingCount());
+    TEST_ASSERT_EQUAL_UINT32(0, perf.flushFailures);
+    TEST_ASSERT_EQUAL_UINT32(0, perf.pendingDropped);
+
+    // Copie : les phases suivantes écrivent encore quelques lots
+    const PerfCounter ingestPush = perf.push;
+    const PerfCounter ingestFlush = perf.flush;
+    const uint64_t records = ingestFlush.getItems();
+    const double bytesPerRecord = records ? (double)perf.bytesWritten / records : 0.0;
+    const size_t fileBytes = DataLogger::getLogFileStats().sizeBytes;
+
+    // ── Scan complet : reconstruction au boot ──
+    beginPhase();
+    PerfCounter initScan;
+    uint32_t initStartUs = micros();
+    DataLogger::init();
+    initScan.record(micros() - initStartUs, (uint32_t)records);
+    size_t scanPeak = phasePeak();
+
+    // ── Dernière valeur (scan complet) ──
+    beginPhase();
+    PerfCounter lastRecord;
+    for (size_t k = 0; k < 3; k++) {
+        DataRecord rec;
+        uint32_t t0 = micros();
+        TEST_ASSERT_TRUE(DataLogger::getLastUtcRecord(NUMERIC_SERIES[k], rec));
+        lastRecord.record(micros() - t0, (uint32_t)records);
+    }
+    size_t lastPeak = phasePeak();
+
+    // ── Graphe à froid (parcours complet) par fenêtre ──
+    static const uint32_t WINDOWS[] = {1, 7, 30, 0};
+    static const char* WINDOW_NAMES[] = {
+        "queryCold1d", "queryCold7d", "queryCold30d", "queryColdAll"
+    };
+    PerfCounter cold[4];
+    size_t coldPeak[4];
+    uint32_t rows = 0;
+    for (size_t w = 0; w < 4; w++) {
+        beginPhase();
+        for (size_t k = 0; k < SERIES_COUNT; k++) {
+            GraphCache::invalidate();
+            measureQuery(cold[w], NUMERIC_SERIES[k], WINDOWS[w], rows, (uint32_t)records);
+        }
+        coldPeak[w] = phasePeak();
+    }
+    TEST_ASSERT_GREATER_THAN(0, rows);
+
+    // ── Graphe en cache (aucune lecture) ──
+    PerfCounter hit;
+    GraphCache::invalidate();
+    measureQuery(hit, DataId::AirTemperature, 30, rows);
+    hit = PerfCounter();
+    beginPhase();
+    for (int i = 0; i < 200; i++) {
+        measureQuery(hit, DataId::AirTemperature, 30, rows);
+    }
+    size_t hitPeak = phasePeak();
+
+    // ── Graphe incrémental : un lot ajouté entre deux requêtes ──
+    beginPhase();
+    PerfCounter incremental;
+    for (uint32_t i = 0; i < 50; i++) {
+        for (uint32_t k = 0; k < BATCH; k++) {
+            DataLogger::push(DataType::Sensor, DataId::AirTemperature,
+                             syntheticValue(2, samples + i * BATCH + k));
+            HostSim::advanceMs(periodS * 1000);
+        }
+        DataLogger::flush();
+        measureQuery(incremental, DataId::AirTemperature, 30, rows);
+    }
+    size_t incrementalPeak = phasePeak();
+
+    // ── getGraphCsv (requête + copie dans la String de réponse) ──
+    beginPhase();
+    PerfCounter graphCsv;
+    for (int i = 0; i < 20; i++) {
+        uint32_t t0 = micros();
+        String csv = DataLogger::getGraphCsv(DataId::AirTemperature, 30);
+        uint32_t elapsed = micros() - t0;
+        uint32_t lines = 0;
+        for (const char* p = csv.c_str(); *p; p++) lines += (*p == '\n');
+        graphCsv.record(elapsed, lines);
+    }
+    size_t graphCsvPeak = phasePeak();
+
+    // ── Rapport ──
+    json.printf("{\n  \"config\": {\"days\":%lu,\"periodS\":%lu,\"series\":%u,"
+                "\"records\":%llu,\"fileBytes\":%lu,\"bytesPerRecord\":%.2f},\n  \"ops\": {",
+                (unsigned long)days, (unsigned long)periodS, (unsigned)SERIES_COUNT + 1,
+                (unsigned long long)records, (unsigned long)fileBytes, bytesPerRecord);
+    writeOp("push", ingestPush, pushPeak);
+    writeOp("flush", ingestFlush, pushPeak, bytesPerRecord);
+    writeOp("initScan", initScan, scanPeak);
+    writeOp("lastRecord", lastRecord, lastPeak);
+    for (size_t w = 0; w < 4; w++) writeOp(WINDOW_NAMES[w], cold[w], coldPeak[w]);
+    writeOp("queryHit", hit, hitPeak);
+    writeOp("queryIncremental", incremental, incrementalPeak);
+    writeOp("graphCsv30d", graphCsv, graphCsvPeak);
+    json.printf(",\n    \"flash\": {\"bytesWritten\":%llu,\"fullPageWrites\":%lu,"
+                "\"partialPageWrites\":%lu,\"sectorsStarted\":%lu}",
+                (unsigned long long)perf.bytesWritten, (unsigned long)perf.fullPageWrites,
+                (unsigned long)perf.partialPageWrites, (unsigned long)perf.sectorsStarted);
+    json.print("\n  }\n}\n");
+
+    fputs(json.text.c_str(), stdout);
+    FILE* out = fopen(outPath, "w");
+    if (out) {
+        fputs(json.text.c_str(), out);
+        fclose(out);
+    }
+
+    HostSim::setRealTime(false);
+    Clock::setSource(nullptr);
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_storage_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,293 @@
+// test/test_codec/test_main.cpp
+// Trames binaires RecordCodec (uplink MQTT) : aller-retour encode → decode,
+// quantification (NaN, écrêtage), taille d'un lot périodique, trames
+// tronquées ou corrompues
+//
+// pio test -e native -f test_codec
+
+#include <unity.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "Storage/RecordCodec.h"
+
+// ─────────────────────────────────────────────
+// Outils
+// ─────────────────────────────────────────────
+
+// Échantillon décodé recopié (CodecSample::text pointe dans la trame)
+struct Decoded {
+    uint32_t    timestamp;
+    uint8_t     type;
+    uint8_t     id;
+    bool        isText;
+    int32_t     milli;
+    std::string text;
+};
+
+struct DecodeCtx {
+    const uint8_t*       frame;
+    size_t               len;
+    std::vector<Decoded> out;
+    bool                 textOutOfFrame = false;
+};
+
+static void collect(const CodecSample& s, void* ctx)
+{
+    DecodeCtx& c = *static_cast<DecodeCtx*>(ctx);
+    if (s.isText && s.textLen > 0 &&
+        ((const uint8_t*)s.text < c.frame || (const uint8_t*)s.text + s.textLen > c.frame + c.len)) {
+        c.textOutOfFrame = true;
+        return;
+    }
+    c.out.push_back({ s.timestamp, s.type, s.id, s.isText, s.milli,
+                      s.isText ? std::string(s.text, s.textLen) : std::string() });
+}
+
+static CodecSample numeric(uint32_t ts, uint8_t id, float value, uint8_t type = 0)
+{
+    CodecSample s;
+    s.timestamp = ts;
+    s.type      = type;
+    s.id        = id;
+    s.milli     = RecordCodec::quantize(value);
+    return s;
+}
+
+static CodecSample text(uint32_t ts, uint8_t id, const char* value, uint8_t type = 3)
+{
+    CodecSample s;
+    s.timestamp = ts;
+    s.type      = type;
+    s.id        = id;
+    s.isText    = true;
+    s.text      = value;
+    s.textLen   = (uint16_t)strlen(value);
+    return s;
+}
+
+// Ordre attendu après décodage : groupes par première apparition,
+// ordre d'origine à l'intérieur d'un groupe
+static std::vector<const CodecSample*> groupOrder(const std::vector<CodecSample>& in)
+{
+    std::vector<const CodecSample*> order;
+    std::vector<bool> done(in.size(), false);
+    for (size_t i = 0; i < in.size(); i++) {
+        if (done[i]) continue;
+        for (size_t k = i; k < in.size(); k++) {
+            if (in[k].id == in[i].id && in[k].type == in[i].type && in[k].isText == in[i].isText) {
+                order.push_back(&in[k]);
+                done[k] = true;
+            }
+        }
+    }
+    return order;
+}
+
+// Lot périodique type : 4 mesures toutes les 30 s pendant 100 cycles + un texte
+static std::vector<CodecSample> periodicBatch()
+{
+    std::vector<CodecSample> batch;
+    for (int i = 0; i < 100; i++) {
+        for (uint8_t id = 0; id < 4; id++) {
+            batch.push_back(numeric(1700000000 + i * 30, id, 3.9f + 0.001f * (i % 5) + id));
+        }
+    }
+    batch.push_back(text(1700000100, 16, "Orange \"F\""));
+    return batch;
+}
+
+void setUp() {}
+void tearDown() {}
+
+// ─────────────────────────────────────────────
+// Quantification
+// ─────────────────────────────────────────────
+
+void test_quantize_keeps_nan_distinct_from_zero()
+{
+    TEST_ASSERT_EQUAL_INT32(RecordCodec::MILLI_NAN, RecordCodec::quantize(NAN));
+    TEST_ASSERT_TRUE(isnan(RecordCodec::dequantize(RecordCodec::MILLI_NAN)));
+
+    TEST_ASSERT_EQUAL_INT32(0, RecordCodec::quantize(0.0f));
+    TEST_ASSERT_EQUAL_INT32(-2500, RecordCodec::quantize(-2.5f));
+    TEST_ASSERT_EQUAL_INT32(3901, RecordCodec::quantize(3.901f));
+    TEST_ASSERT_FLOAT_WITHIN(0.0005f, 3.901f, RecordCodec::dequantize(3901));
+
+    // Écrêtage : jamais confondu avec NaN
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, RecordCodec::quantize(1e9f));
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN + 1, RecordCodec::quantize(-1e9f));
+    TEST_ASSERT_FALSE(isnan(RecordCodec::dequantize(RecordCodec::quantize(-INFINITY))));
+}
+
+// ─────────────────────────────────────────────
+// Aller-retour
+// ─────────────────────────────────────────────
+
+void test_round_trip_mixed_groups()
+{
+    std::vector<CodecSample> in = {
+        numeric(1700000300, 2, 21.5f),
+        text(1700000300, 16, "Orange \"F\", 4G"),
+        numeric(1700000000, 5, -12.25f),             // baseTs = plus ancien
+        numeric(1700000330, 2, 19.0f),               // Δvaleur négatif
+        numeric(1700000290, 2, NAN),                 // Δtimestamp négatif, NaN
+        numeric(1700000360, 2, 20.0f),               // Après NaN
+        numeric(1700000030, 5, 1e9f),                // Écrêté haut
+        numeric(1700000060, 5, -1e9f),               // Écrêté bas
+        text(1700000400, 16, ""),
+        numeric(1700000400, 2, 20.0f, 1),            // Même id, autre type
+        text(1700000500, 17, "\"\"\n,;\xC3\xA9"),
+    };
+
+    uint8_t frame[256];
+    size_t len = RecordCodec::encode(in.data(), in.size(), frame, sizeof(frame));
+    TEST_ASSERT_GREATER_THAN(0, len);
+
+    DecodeCtx ctx{ frame, len, {} };
+    TEST_ASSERT_TRUE(RecordCodec::decode(frame, len, collect, &ctx));
+    TEST_ASSERT_FALSE(ctx.textOutOfFrame);
+
+    std::vector<const CodecSample*> expected = groupOrder(in);
+    TEST_ASSERT_EQUAL(expected.size(), ctx.out.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        const CodecSample& e = *expected[i];
+        const Decoded& d = ctx.out[i];
+        TEST_ASSERT_EQUAL_UINT32(e.timestamp, d.timestamp);
+        TEST_ASSERT_EQUAL_UINT8(e.type, d.type);
+        TEST_ASSERT_EQUAL_UINT8(e.id, d.id);
+        TEST_ASSERT_EQUAL(e.isText, d.isText);
+        if (e.isText) {
+            TEST_ASSERT_EQUAL(e.textLen, d.text.size());
+            TEST_ASSERT_EQUAL_MEMORY(e.text, d.text.data(), e.textLen);
+        } else {
+            TEST_ASSERT_EQUAL_INT32(e.milli, d.milli);
+        }
+    }
+
+    // NaN survit au codage différentiel, sans décaler la valeur suivante
+    TEST_ASSERT_TRUE(isnan(RecordCodec::dequantize(ctx.out[2].milli)));
+    TEST_ASSERT_FLOAT_WITHIN(0.0005f, 20.0f, RecordCodec::dequantize(ctx.out[3].milli));
+}
+
+void test_empty_batch()
+{
+    uint8_t frame[16];
+    size_t len = RecordCodec::encode(nullptr, 0, frame, sizeof(frame));
+    TEST_ASSERT_EQUAL(4, len);
+
+    DecodeCtx ctx{ frame, len, {} };
+    TEST_ASSERT_TRUE(RecordCodec::decode(frame, len, collect, &ctx));
+    TEST_ASSERT_EQUAL(0, ctx.out.size());
+}
+
+// 401 échantillons → 840 octets, plus de 10× plus compact que les lignes CSV
+void test_periodic_batch_size()
+{
+    std::vector<CodecSample> batch = periodicBatch();
+    TEST_ASSERT_EQUAL(401, batch.size());
+
+    uint8_t frame[2048];
+    size_t len = RecordCodec::encode(batch.data(), batch.size(), frame, sizeof(frame));
+    TEST_ASSERT_EQUAL(840, len);
+
+    size_t csvBytes = 0;
+    char line[64];
+    for (const CodecSample& s : batch) {
+        csvBytes += s.isText
+            ? (size_t)snprintf(line, sizeof(line), "%lu,%d,%d,1,\"%.*s\"\n", (unsigned long)s.timestamp,
+                               s.type, s.id, (int)s.textLen, s.text)
+            : (size_t)snprintf(line, sizeof(line), "%lu,%d,%d,0,%.3f\n", (unsigned long)s.timestamp,
+                               s.type, s.id, RecordCodec::dequantize(s.milli));
+    }
+    TEST_ASSERT_GREATER_THAN(10 * len, csvBytes);
+
+    DecodeCtx ctx{ frame, len, {} };
+    TEST_ASSERT_TRUE(RecordCodec::decode(frame, len, collect, &ctx));
+    TEST_ASSERT_EQUAL(401, ctx.out.size());
+}
+
+// ─────────────────────────────────────────────
+// Trames invalides
+// ─────────────────────────────────────────────
+
+void test_encode_reports_short_buffer()
+{
+    std::vector<CodecSample> batch = periodicBatch();
+    uint8_t frame[2048];
+    size_t len = RecordCodec::encode(batch.data(), batch.size(), frame, sizeof(frame));
+
+    for (size_t size = 0; size < len; size++) {
+        TEST_ASSERT_EQUAL(0, RecordCodec::encode(batch.data(), batch.size(), frame, size));
+    }
+}
+
+void test_truncated_frames_rejected()
+{
+    std::vector<CodecSample> batch = periodicBatch();
+    uint8_t frame[2048];
+    size_t len = RecordCodec::encode(batch.data(), batch.size(), frame, sizeof(frame));
+
+    // Chaque préfixe strict (copié : aucun octet lisible au-delà)
+    for (size_t cut = 0; cut < len; cut++) {
+        std::vector<uint8_t> prefix(frame, frame + cut);
+        DecodeCtx ctx{ prefix.data(), cut, {} };
+        TEST_ASSERT_FALSE(RecordCodec::decode(prefix.data(), cut, collect, &ctx));
+        TEST_ASSERT_FALSE(ctx.textOutOfFrame);
+    }
+
+    // Octet en trop
+    frame[len] = 0;
+    TEST_ASSERT_FALSE(RecordCodec::decode(frame, len + 1, nullptr, nullptr));
+}
+
+void test_corrupt_frames_rejected()
+{
+    CodecSample sample = text(1700000000, 16, "abc");
+    uint8_t frame[32];
+    size_t len = RecordCodec::encode(&sample, 1, frame, sizeof(frame));
+    TEST_ASSERT_EQUAL(16, len);     // C5 01 [baseTs ×5] 01 | 10 07 01 | 00 03 "abc"
+
+    uint8_t bad[32];
+
+    memcpy(bad, frame, len);
+    bad[0] ^= 0xFF;                                     // Magic
+    TEST_ASSERT_FALSE(RecordCodec::decode(bad, len, nullptr, nullptr));
+
+    memcpy(bad, frame, len);
+    bad[1] = RecordCodec::VERSION + 1;                  // Version
+    TEST_ASSERT_FALSE(RecordCodec::decode(bad, len, nullptr, nullptr));
+
+    memcpy(bad, frame, len);
+    bad[len - 4] = 0x7F;                                // Longueur de texte > trame
+    DecodeCtx ctx{ bad, len, {} };
+    TEST_ASSERT_FALSE(RecordCodec::decode(bad, len, collect, &ctx));
+    TEST_ASSERT_EQUAL(0, ctx.out.size());
+
+    // Nombre de groupes annoncé sans groupes
+    const uint8_t groupsOnly[] = { RecordCodec::MAGIC, RecordCodec::VERSION, 0x00, 0x05 };
+    TEST_ASSERT_FALSE(RecordCodec::decode(groupsOnly, sizeof(groupsOnly), nullptr, nullptr));
+
+    // Varint de plus de 5 octets
+    const uint8_t longVarint[] = { RecordCodec::MAGIC, RecordCodec::VERSION,
+                                   0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x01, 0x00 };
+    TEST_ASSERT_FALSE(RecordCodec::decode(longVarint, sizeof(longVarint), nullptr, nullptr));
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_quantize_keeps_nan_distinct_from_zero);
+    RUN_TEST(test_round_trip_mixed_groups);
+    RUN_TEST(test_empty_batch);
+    RUN_TEST(test_periodic_batch_size);
+    RUN_TEST(test_encode_reports_short_buffer);
+    RUN_TEST(test_truncated_frames_rejected);
+    RUN_TEST(test_corrupt_frames_rejected);
+    return UNITY_END();
+}
@@ -0,0 +1,410 @@
+// test/test_fuzz/test_main.cpp
+// Fuzzing des entrées non fiables : chemin de réception modem (CellularEvent :
+// octets → lignes, classification, dispatch URC ; parseurs AT AtParser) et
+// décodeur de trames RecordCodec
+//
+// Une entrée est traitée trois fois :
+//   - flux d'octets UART → CellularEvent::onByte → processChar ; chaque ligne
+//     dispatchée et chaque URC abonnée passent dans tous les parseurs
+//   - ligne brute (tronquée au premier '\0') → tous les parseurs
+//   - trame RecordCodec → decode ; trame acceptée réencodée puis redécodée
+// Invariants vérifiés : ligne dispatchée bornée, sans \r \n NUL ni espace
+// de bord, type cohérent ; parseurs dans leurs plages documentées ; texte
+// décodé dans la trame ; aller-retour decode → encode → decode identique
+//
+// Deux modes :
+//   - pio test -e native -f test_fuzz : rejeu du corpus (test/fuzz/corpus)
+//     puis FUZZ_ITERATIONS mutations déterministes ; débit (lignes/s) et
+//     violations rapportés, entrée fautive écrite dans .pio/fuzz_failure.bin
+//   - pio test -e fuzz -f test_fuzz --without-testing (clang, -DHOST_LIBFUZZER) :
+//     cible libFuzzer, .pio/build/fuzz/program test/fuzz/corpus/*
+
+#include <unity.h>
+#include <Arduino.h>
+#include <dirent.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "Connectivity/AtParser.h"
+#include "Connectivity/CellularEvent.h"
+#include "Storage/RecordCodec.h"
+
+// ─────────────────────────────────────────────
+// Invariants
+// ─────────────────────────────────────────────
+
+#ifdef HOST_LIBFUZZER
+#define FUZZ_CHECK(cond) do { if (!(cond)) __builtin_trap(); } while (0)
+#else
+static uint32_t violations = 0;
+static const char* firstViolation = nullptr;
+#define FUZZ_CHECK(cond) do { if (!(cond)) { if (!violations++) firstViolation = #cond; } } while (0)
+#endif
+
+static uint64_t linesSeen = 0;
+static uint64_t urcSeen = 0;
+
+static void checkParsers(const char* line)
+{
+    long v;
+    AtParser::parseIntField(line, v);
+
+    int stat = AtParser::parseCeregStat(line);
+    FUZZ_CHECK(stat >= -1 && stat <= 5);
+
+    int att = AtParser::parseCgatt(line);
+    FUZZ_CHECK(att >= -1 && att <= 1);
+
+    int csq = AtParser::parseCsq(line);
+    FUZZ_CHECK((csq >= 0 && csq <= 31) || csq == 99);
+
+    String op = AtParser::parseCopsOperator(line);
+    FUZZ_CHECK(op.length() <= 31);
+
+    IPAddress ip = AtParser::parseCnactIP(line);
+    (void)ip;
+
+    AtParser::isPdpDeactivated(line);
+
+    // 0 ou une date entre 1970 et 2199 (± fuseau de 14 h)
+    time_t cclk = AtParser::parseCclk(line);
+    FUZZ_CHECK(cclk == 0 || (cclk >= -14 * 3600 && cclk < 7258118400LL + 14 * 3600));
+
+    time_t psuttz = AtParser::parsePsuttz(line);
+    FUZZ_CHECK(psuttz >= 0 && psuttz < 7258118400LL);
+
+    bool numeric = AtParser::isNumericLine(line);
+    bool echo = AtParser::isEchoOrUrc(line);
+    FUZZ_CHECK(!(numeric && echo));
+}
+
+static void onLine(CellularLineType type, const char* line)
+{
+    linesSeen++;
+    size_t len = strlen(line);
+
+    FUZZ_CHECK(len > 0 && len < 256);
+    FUZZ_CHECK(strpbrk(line, "\r\n") == nullptr);
+    FUZZ_CHECK(line[0] != ' ' && line[0] != '\t');
+    FUZZ_CHECK(line[len - 1] != ' ' && line[len - 1] != '\t');
+    if (type == CellularLineType::OK)     FUZZ_CHECK(strcmp(line, "OK") == 0);
+    if (type == CellularLineType::PROMPT) FUZZ_CHECK(line[0] == '>');
+
+    checkParsers(line);
+}
+
+static void onUrc(const char* line, const char* args)
+{
+    urcSeen++;
+    FUZZ_CHECK(args >= line && args <= line + strlen(line));
+    checkParsers(args);
+}
+
+// ─────────────────────────────────────────────
+// Trames RecordCodec
+// ─────────────────────────────────────────────
+
+struct CodecFrame {
+    const uint8_t* data;
+    size_t size;
+    std::vector<CodecSample> samples;
+};
+
+static uint64_t framesDecoded = 0;
+
+static void onSample(const CodecSample& s, void* ctx)
+{
+    CodecFrame& frame = *static_cast<CodecFrame*>(ctx);
+    if (s.isText) {
+        FUZZ_CHECK((const uint8_t*)s.text >= frame.data);
+        FUZZ_CHECK((const uint8_t*)s.text + s.textLen <= frame.data + frame.size);
+    }
+    frame.samples.push_back(s);
+}
+
+static bool sameSample(const CodecSample& a, const CodecSample& b)
+{
+    if (a.timestamp != b.timestamp || a.id != b.id || a.type != b.type || a.isText != b.isText) return false;
+    if (!a.isText) return a.milli == b.milli;
+    return a.textLen == b.textLen && memcmp(a.text, b.text, a.textLen) == 0;
+}
+
+static void checkCodec(const uint8_t* data, size_t size)
+{
+    CodecFrame frame{ data, size, {} };
+    if (!RecordCodec::decode(data, size, onSample, &frame)) return;
+    framesDecoded++;
+
+    // Réencodage : groupes fusionnés par (id, type, nature), ordre interne conservé
+    std::vector<CodecSample> expected;
+    std::vector<bool> done(frame.samples.size(), false);
+    size_t bound = 16;
+    for (size_t i = 0; i < frame.samples.size(); i++) {
+        const CodecSample& s = frame.samples[i];
+        bound += 12 + (s.isText ? s.textLen : 0);
+        if (done[i]) continue;
+        for (size_t k = i; k < frame.samples.size(); k++) {
+            const CodecSample& o = frame.samples[k];
+            if (o.id == s.id && o.type == s.type && o.isText == s.isText) {
+                expected.push_back(o);
+                done[k] = true;
+            }
+        }
+    }
+
+    std::vector<uint8_t> out(bound);
+    size_t len = RecordCodec::encode(frame.samples.data(), frame.samples.size(), out.data(), out.size());
+    FUZZ_CHECK(len > 0 && len <= out.size());
+    if (len == 0) return;
+
+    CodecFrame again{ out.data(), len, {} };
+    FUZZ_CHECK(RecordCodec::decode(out.data(), len, onSample, &again));
+    FUZZ_CHECK(again.samples.size() == expected.size());
+    for (size_t i = 0; i < expected.size() && i < again.samples.size(); i++) {
+        FUZZ_CHECK(sameSample(again.samples[i], expected[i]));
+    }
+}
+
+static void fuzzInit()
+{
+    CellularEvent::init();
+    CellularEvent::setLineCallback(onLine);
+    CellularEvent::enableLineParsing(true);
+
+    // Préfixes du firmware (CellularManager, ManagerUTC) et URC courantes
+    static const char* const PREFIXES[] = {
+        "+APP PDP:", "*PSUTTZ:", "+CTZV:", "+CMTI:", "+CEREG:", "+CPIN:"
+    };
+    for (const char* prefix : PREFIXES) {
+        CellularEvent::registerUrcHandler(prefix, onUrc);
+    }
+}
+
+static void fuzzOne(const uint8_t* data, size_t size)
+{
+    // Flux UART ; '\n' final : la dernière ligne est dispatchée
+    for (size_t i = 0; i < size; i++) {
+        CellularEvent::onByte(data[i]);
+    }
+    CellularEvent::onByte('\n');
+
+    // Ligne brute
+    std::string line((const char*)data, size);
+    checkParsers(line.c_str());
+
+    checkCodec(data, size);
+}
+
+#ifdef HOST_LIBFUZZER
+
+// ─────────────────────────────────────────────
+// Cible libFuzzer
+// ─────────────────────────────────────────────
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
+{
+    static bool ready = false;
+    if (!ready) {
+        fuzzInit();
+        ready = true;
+    }
+    fuzzOne(data, size);
+    return 0;
+}
+
+void setUp() {}
+void tearDown() {}
+
+#else
+
+// ─────────────────────────────────────────────
+// Corpus et mutations déterministes (Unity)
+// ─────────────────────────────────────────────
+
+typedef std::vector<uint8_t> Input;
+
+static std::vector<Input> loadCorpus()
+{
+    const char* root = getenv("FUZZ_CORPUS");
+    if (!root || !*root) root = "test/fuzz/corpus";
+
+    std::vector<Input> corpus;
+    static const char* const TARGETS[] = { "cellular_event", "at_parsers", "record_codec" };
+    for (const char* target : TARGETS) {
+        std::string dirPath = std::string(root) + "/" + target;
+        DIR* dir = opendir(dirPath.c_str());
+        if (!dir) continue;
+        while (struct dirent* entry = readdir(dir)) {
+            if (entry->d_name[0] == '.') continue;
+            FILE* f = fopen((dirPath + "/" + entry->d_name).c_str(), "rb");
+            if (!f) continue;
+            Input in;
+            uint8_t buf[512];
+            size_t n;
+            while ((n = fread(buf, 1, sizeof(buf), f)) > 0) in.insert(in.end(), buf, buf + n);
+            fclose(f);
+            corpus.push_back(in);
+        }
+        closedir(dir);
+    }
+    return corpus;
+}
+
+static uint32_t rngState = 0x2545F491;
+
+static uint32_t nextRandom()
+{
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 17;
+    rngState ^= rngState << 5;
+    return rngState;
+}
+
+// Octets « intéressants » pour les parseurs de lignes AT et les trames
+// RecordCodec (magic, version, bit de continuation varint)
+static const uint8_t DICTIONARY[] = {
+    '\r', '\n', '\0', ' ', '\t', '>', ',', ':', '"', '+', '*', '/', '-', '0', '9', 0xFF,
+    RecordCodec::MAGIC, RecordCodec::VERSION, 0x80
+};
+
+static Input mutate(const std::vector<Input>& corpus)
+{
+    Input in = corpus[nextRandom() % corpus.size()];
+    uint32_t rounds = 1 + nextRandom() % 4;
+    for (uint32_t r = 0; r < rounds; r++) {
+        size_t pos = in.empty() ? 0 : nextRandom() % (in.size() + 1);
+        switch (nextRandom() % 7) {
+        case 0:     // Bit inversé
+            if (!in.empty()) in[pos % in.size()] ^= (uint8_t)(1u << (nextRandom() % 8));
+            break;
+        case 1:     // Octet du dictionnaire inséré
+            in.insert(in.begin() + pos, DICTIONARY[nextRandom() % sizeof(DICTIONARY)]);
+            break;
+        case 2:     // Octet supprimé
+            if (!in.empty()) in.erase(in.begin() + pos % in.size());
+            break;
+        case 3:     // Chiffres (débordements d'entiers)
+            in.insert(in.begin() + pos, 10 + nextRandom() % 12, (uint8_t)('0' + nextRandom() % 10));
+            break;
+        case 4: {   // Greffe d'une autre entrée
+            const Input& other = corpus[nextRandom() % corpus.size()];
+            in.insert(in.begin() + pos, other.begin(), other.end());
+            break;
+        }
+        case 5:     // Ligne trop longue (LINE_BUFFER_SIZE = 256)
+            in.insert(in.begin() + pos, 240 + nextRandom() % 40, 'A');
+            break;
+        default:    // Bruit UART
+            for (int i = 0; i < 8; i++) in.insert(in.begin() + pos, (uint8_t)nextRandom());
+            break;
+        }
+    }
+    return in;
+}
+
+static void saveFailure(const Input& in)
+{
+    FILE* f = fopen(".pio/fuzz_failure.bin", "wb");
+    if (!f) return;
+    fwrite(in.data(), 1, in.size(), f);
+    fclose(f);
+}
+
+void setUp()
+{
+    violations = 0;
+    firstViolation = nullptr;
+    fuzzInit();
+}
+
+void tearDown() {}
+
+// Valeurs connues (format SIM7080 AT Command Manual)
+void test_parsers_known_answers()
+{
+    TEST_ASSERT_EQUAL(1, AtParser::parseCeregStat("+CEREG: 0,1"));
+    TEST_ASSERT_EQUAL(-1, AtParser::parseCeregStat("+CEREG: 0,"));
+    TEST_ASSERT_EQUAL(1, AtParser::parseCgatt("+CGATT: 1"));
+    TEST_ASSERT_EQUAL(21, AtParser::parseCsq("+CSQ: 21,99"));
+    TEST_ASSERT_EQUAL(99, AtParser::parseCsq("+CSQ: ,x"));
+    String op = AtParser::parseCopsOperator("+COPS: 0,0,\"Orange F\",7");
+    TEST_ASSERT_EQUAL_STRING("Orange F", op.c_str());
+    String ip = AtParser::parseCnactIP("+CNACT: 0,1,\"10.12.3.4\"").toString();
+    TEST_ASSERT_EQUAL_STRING("10.12.3.4", ip.c_str());
+    ip = AtParser::parseCnactIP("+CNACT: 0,1,\"10.12.3.4.5\"").toString();
+    TEST_ASSERT_EQUAL_STRING("0.0.0.0", ip.c_str());
+    TEST_ASSERT_TRUE(AtParser::isPdpDeactivated("0,DEACTIVE"));
+    TEST_ASSERT_FALSE(AtParser::isPdpDeactivated("1,DEACTIVE"));
+    TEST_ASSERT_FALSE(AtParser::isPdpDeactivated("x,DEACTIVE"));
+
+    // 01:00 locale en UTC+1 (4 quarts d'heure) = 2026-01-01T00:00:00Z
+    TEST_ASSERT_EQUAL(1767225600, AtParser::parseCclk("+CCLK: \"26/01/01,01:00:00+04\""));
+    TEST_ASSERT_EQUAL(1767225600, AtParser::parsePsuttz("2026,1,1,0,0,0,\"+4\",0"));
+    TEST_ASSERT_EQUAL(0, AtParser::parseCclk("+CCLK: \"2147483647/01/01,00:00:00+04\""));
+    TEST_ASSERT_EQUAL(0, AtParser::parseCclk("+CCLK: \"26/01/01,01:00:00+2147483647\""));
+
+    TEST_ASSERT_TRUE(AtParser::isNumericLine("89331042181176213580"));
+    TEST_ASSERT_TRUE(AtParser::isEchoOrUrc("AT+CCID"));
+    TEST_ASSERT_FALSE(AtParser::isNumericLine("+CCID: 8933"));
+}
+
+void test_corpus_replay()
+{
+    std::vector<Input> corpus = loadCorpus();
+    TEST_ASSERT_GREATER_THAN(0, corpus.size());
+
+    const uint64_t framesBase = framesDecoded;
+    for (const Input& in : corpus) {
+        fuzzOne(in.data(), in.size());
+        if (violations) {
+            saveFailure(in);
+            break;
+        }
+    }
+    TEST_ASSERT_EQUAL_MESSAGE(0, violations, firstViolation);
+    TEST_ASSERT_GREATER_THAN(0, framesDecoded - framesBase);   // Corpus record_codec chargé
+}
+
+void test_mutations()
+{
+    std::vector<Input> corpus = loadCorpus();
+    TEST_ASSERT_GREATER_THAN(0, corpus.size());
+
+    const char* env = getenv("FUZZ_ITERATIONS");
+    const uint32_t iterations = (env && *env) ? (uint32_t)strtoul(env, nullptr, 10) : 200000;
+
+    const uint64_t linesBase = linesSeen;
+    uint64_t bytes = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations && !violations; i++) {
+        Input in = mutate(corpus);
+        bytes += in.size();
+        fuzzOne(in.data(), in.size());
+        if (violations) saveFailure(in);
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const uint64_t lines = linesSeen - linesBase;
+
+    printf("{\"inputs\":%lu,\"bytes\":%llu,\"lines\":%llu,\"urc\":%llu,\"frames\":%llu,\"linesPerS\":%.0f,"
+           "\"overflows\":%lu,\"violations\":%lu}\n",
+           (unsigned long)iterations, (unsigned long long)bytes, (unsigned long long)lines,
+           (unsigned long long)urcSeen, (unsigned long long)framesDecoded, seconds > 0 ? lines / seconds : 0.0,
+           (unsigned long)CellularEvent::getBufferOverflows(), (unsigned long)violations);
+
+    TEST_ASSERT_EQUAL_MESSAGE(0, violations, firstViolation);
+    TEST_ASSERT_GREATER_THAN(0, CellularEvent::getBufferOverflows());
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_parsers_known_answers);
+    RUN_TEST(test_corpus_replay);
+    RUN_TEST(test_mutations);
+    return UNITY_END();
+}
+
+#endif
@@ -0,0 +1,452 @@
+// test/test_modem/test_main.cpp
+// CellularManager et SmsManager face à un SIM7080G scripté (ModemEmulator)
+//
+// Câblage et tâches de main.cpp (poll 20 ms, handle 2 s, SMS 2 s), en temps
+// virtuel. Les tests s'enchaînent sur le même modem (l'état statique des
+// gestionnaires n'est pas réinitialisable) :
+//   1. mise en service complète, ordre des commandes, durée de connexion
+//   2. URC et bruit UART en rafale pendant les échanges
+//   3. ligne trop longue terminée par un faux "OK" pendant un pending
+//   4. réponse CGATT après le timeout : reconnexion, réponse tardive ignorée
+//   5. URC "+APP PDP: 0,DEACTIVE" : réactivation du bearer
+//   6. SMS : CMGF → CMGS → prompt → texte + Ctrl+Z, refus réseau puis succès
+//   7. modem muet : ERROR, recovery PWRKEY, MODEM_INIT, fast path
+// Budget : chaque handle()/poll() mesuré ; seul testAT() de MODEM_INIT
+// (bloquant, documenté) peut dépasser BUDGET_MS. Durées en temps virtuel :
+// attentes modem et yield() comptés, pas le CPU de l'hôte (voir test_bench).
+//
+// Rapport JSON sur stdout et dans MODEM_OUTPUT (défaut .pio/modem_report.json)
+// MODEM_LOG=1 : journal du firmware sur la sortie standard
+//
+// pio test -e native -f test_modem
+
+#include <unity.h>
+#include <Arduino.h>
+#include <HostSim.h>
+#include <ModemEmulator.h>
+#include <string>
+
+#include "Connectivity/CellularEvent.h"
+#include "Connectivity/CellularManager.h"
+#include "Connectivity/CellularStream.h"
+#include "Connectivity/SmsManager.h"
+#include "Core/TaskManager.h"
+#include "Utils/Logger.h"
+
+static ModemEmulator modem;
+
+// ─────────────────────────────────────────────
+// Script nominal
+// ─────────────────────────────────────────────
+
+static constexpr const char* OPERATOR = "Orange F";
+static constexpr const char* SMS_NUMBER = "+33600000000";
+
+static void scriptHealthyModem()
+{
+    modem.on("AT", "OK");
+    modem.on("AT+CPIN?", "+CPIN: READY\nOK");
+    modem.on("AT+CCID", "89330123456789012345\nOK");
+    modem.on("AT+GSN", "861234567890123\nOK");
+    modem.on("AT+CIMI", "208011234567890\nOK");
+    modem.on("AT+CLTS=1", "OK");
+    modem.on("AT+CFUN=0", "OK", 300);
+    modem.on("AT+CNMP=*", "OK");
+    modem.on("AT+CMNB=*", "OK");
+    modem.on("AT+CGDCONT=*", "OK");
+    modem.on("AT+CNCFG=*", "OK");
+    modem.on("AT+CFUN=1", "OK", 200);
+    modem.on("AT+CNETLIGHT=1", "OK");
+    modem.on("AT+CEREG?", "+CEREG: 0,1\nOK");
+    modem.on("AT+CNACT=0,1", "OK", 1000);
+    modem.on("AT+CGATT?", "+CGATT: 1\nOK");
+    modem.on("AT+COPS?", "+COPS: 0,0,\"Orange F\",7\nOK", 150);
+    modem.on("AT+CNACT?", "+CNACT: 0,1,\"10.45.3.7\"\n+CNACT: 1,0,\"0.0.0.0\"\nOK");
+    modem.on("AT+CSQ", "+CSQ: 18,99\nOK");
+    modem.on("AT+CMGF=1", "OK", 40);
+    modem.on("AT+CMGS=*", ">\n+CMGS: 42\nOK", 60);
+}
+
+// ─────────────────────────────────────────────
+// Mesure du budget (tâches de main.cpp)
+// ─────────────────────────────────────────────
+
+struct BudgetStats {
+    uint32_t handleCalls = 0;
+    uint32_t handleMaxMs = 0;       // Hors testAT() de MODEM_INIT
+    uint32_t pollMaxMs = 0;
+    uint32_t overruns = 0;          // handle()/poll() > BUDGET_MS hors MODEM_INIT
+    uint32_t initOverruns = 0;      // testAT() bloquant au démarrage
+    uint32_t initMaxMs = 0;
+    uint32_t smsHandleMaxMs = 0;
+};
+
+static BudgetStats budget;
+static bool logToStdout = false;
+
+// Un handle() pendant lequel le modem a reçu "AT" exécute testAT() (MODEM_INIT) :
+// les autres états passent par la file AT, envoyée depuis poll()
+static bool sentTestAt(size_t fromIndex)
+{
+    const std::vector<std::string>& log = modem.commands();
+    for (size_t i = fromIndex; i < log.size(); i++) {
+        if (log[i] == "AT") return true;
+    }
+    return false;
+}
+
+static void registerTasks()
+{
+    TaskManager::init();
+
+    TaskManager::addTask([]() {
+        CellularEvent::poll();
+        uint32_t t0 = millis();
+        CellularManager::poll();
+        uint32_t dt = millis() - t0;
+        if (dt > budget.pollMaxMs) budget.pollMaxMs = dt;
+        if (dt > CellularManager::BUDGET_MS) budget.overruns++;
+    }, 20UL);
+
+    TaskManager::addTask([]() {
+        size_t before = modem.commands().size();
+        uint32_t t0 = millis();
+        CellularManager::handle();
+        uint32_t dt = millis() - t0;
+        budget.handleCalls++;
+        if (sentTestAt(before)) {
+            if (dt > budget.initMaxMs) budget.initMaxMs = dt;
+            if (dt > CellularManager::BUDGET_MS) budget.initOverruns++;
+            return;
+        }
+        if (dt > budget.handleMaxMs) budget.handleMaxMs = dt;
+        if (dt > CellularManager::BUDGET_MS) budget.overruns++;
+    }, 2000UL);
+
+    TaskManager::addTask([]() {
+        uint32_t t0 = millis();
+        SmsManager::handle();
+        uint32_t dt = millis() - t0;
+        if (dt > budget.smsHandleMaxMs) budget.smsHandleMaxMs = dt;
+    }, 2000UL);
+
+    // Tâche de vidage du Logger (pas de tâche FreeRTOS sur l'hôte)
+    TaskManager::addTask([]() {
+        if (logToStdout) Logger::flush();
+    }, 100UL);
+}
+
+// ─────────────────────────────────────────────
+// Boucle
+// ─────────────────────────────────────────────
+
+static constexpr uint32_t STEP_MS = 1;
+
+static uint64_t simMs() { return HostSim::elapsedUs() / 1000; }
+
+static void runFor(uint32_t ms)
+{
+    const uint64_t end = simMs() + ms;
+    while (simMs() < end) {
+        TaskManager::handle();
+        HostSim::advanceMs(STEP_MS);
+    }
+}
+
+// true si cond() devient vraie avant timeoutMs
+template <typename Cond>
+static bool runUntil(Cond cond, uint32_t timeoutMs)
+{
+    const uint64_t end = simMs() + timeoutMs;
+    while (simMs() < end) {
+        if (cond()) return true;
+        TaskManager::handle();
+        HostSim::advanceMs(STEP_MS);
+    }
+    return cond();
+}
+
+// Rang de la première commande correspondant au motif (-1 si absente)
+static long indexOf(const char* pattern)
+{
+    const std::vector<std::string>& log = modem.commands();
+    for (size_t i = 0; i < log.size(); i++) {
+        if (ModemEmulator::matches(pattern, log[i])) return (long)i;
+    }
+    return -1;
+}
+
+// ─────────────────────────────────────────────
+// Rapport
+// ─────────────────────────────────────────────
+
+static uint64_t bringUpMs = 0;
+static uint32_t bringUpCommands = 0;
+static uint32_t recoveryMs = 0;
+
+static void writeReport()
+{
+    char buf[1024];
+    int n = snprintf(buf, sizeof(buf),
+        "{\n"
+        "  \"bringUp\": {\"ms\":%llu,\"commands\":%lu},\n"
+        "  \"budget\": {\"budgetMs\":%lu,\"handleCalls\":%lu,\"handleMaxMs\":%lu,\"pollMaxMs\":%lu,"
+        "\"overruns\":%lu,\"modemInitOverruns\":%lu,\"modemInitMaxMs\":%lu,"
+        "\"firmwareMaxMs\":%lu,\"firmwareOverruns\":%lu},\n"
+        "  \"sms\": {\"handleMaxMs\":%lu},\n"
+        "  \"recovery\": {\"ms\":%lu},\n"
+        "  \"uart\": {\"lineOverflows\":%lu,\"linesReceived\":%lu,\"rxOverflows\":%lu}\n"
+        "}\n",
+        (unsigned long long)bringUpMs, (unsigned long)bringUpCommands,
+        (unsigned long)CellularManager::BUDGET_MS, (unsigned long)budget.handleCalls,
+        (unsigned long)budget.handleMaxMs, (unsigned long)budget.pollMaxMs,
+        (unsigned long)budget.overruns, (unsigned long)budget.initOverruns,
+        (unsigned long)budget.initMaxMs,
+        (unsigned long)CellularManager::getHandleMaxDurationMs(),
+        (unsigned long)CellularManager::getBudgetOverruns(),
+        (unsigned long)budget.smsHandleMaxMs, (unsigned long)recoveryMs,
+        (unsigned long)CellularEvent::getBufferOverflows(),
+        (unsigned long)CellularEvent::getLinesReceived(),
+        (unsigned long)CellularStream::instance().getOverflows());
+    if (n < 0) return;
+
+    fputs(buf, stdout);
+    const char* outPath = getenv("MODEM_OUTPUT");
+    if (!outPath || !*outPath) outPath = ".pio/modem_report.json";
+    FILE* out = fopen(outPath, "w");
+    if (out) {
+        fputs(buf, out);
+        fclose(out);
+    }
+}
+
+// ─────────────────────────────────────────────
+// Tests
+// ─────────────────────────────────────────────
+
+void setUp() {}
+void tearDown() {}
+
+void test_bring_up()
+{
+    HostSim::reset(0);
+    logToStdout = getenv("MODEM_LOG") != nullptr;
+    if (logToStdout) Logger::begin(Serial, Logger::Level::DEBUG);
+
+    modem.reset();
+    scriptHealthyModem();
+    // Recherche réseau : deux CEREG "searching" avant l'enregistrement
+    modem.on("AT+CEREG?", "+CEREG: 0,2\nOK");
+
+    // Ordre de setup() (main.cpp)
+    CellularEvent::init();
+    CellularStream::instance().setByteCallback(CellularEvent::onByte);
+    CellularEvent::setLineCallback(CellularManager::onModemLine);
+    CellularEvent::enableLineParsing(true);
+    CellularManager::init();
+    CellularStream::instance().begin(modem);     // Serial1 → modem scripté
+    SmsManager::init();
+    registerTasks();
+
+    const uint64_t start = simMs();
+    TEST_ASSERT_TRUE(runUntil([]() { return modem.countCommand("AT+CEREG?") >= 2; }, 60000));
+    modem.on("AT+CEREG?", "+CEREG: 0,1\nOK");
+    TEST_ASSERT_TRUE(runUntil([]() { return CellularManager::isConnected(); }, 60000));
+    bringUpMs = simMs() - start;
+    bringUpCommands = (uint32_t)modem.commands().size();
+
+    // Séquence : SIM, identité, configuration Cat-M, enregistrement, bearer, état
+    const char* order[] = {
+        "AT", "AT+CPIN?", "AT+CCID", "AT+GSN", "AT+CIMI", "AT+CLTS=1",
+        "AT+CFUN=0", "AT+CNMP=*", "AT+CMNB=*", "AT+CGDCONT=*", "AT+CNCFG=*", "AT+CFUN=1",
+        "AT+CEREG?", "AT+CNACT=0,1", "AT+CGATT?", "AT+COPS?", "AT+CNACT?", "AT+CSQ"
+    };
+    long prev = -1;
+    for (const char* cmd : order) {
+        long idx = indexOf(cmd);
+        TEST_ASSERT_TRUE_MESSAGE(idx > prev, cmd);
+        prev = idx;
+    }
+    TEST_ASSERT_EQUAL_UINT32(1, modem.countCommand("AT+CFUN=0"));
+
+    // Stabilisation 2,5 s + deux CEREG espacés d'un cycle + CNACT 1 s
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(15000, (uint32_t)bringUpMs);
+
+    String op = CellularManager::getOperator();
+    TEST_ASSERT_EQUAL_STRING(OPERATOR, op.c_str());
+    String ip = CellularManager::getLocalIP().toString();
+    TEST_ASSERT_EQUAL_STRING("10.45.3.7", ip.c_str());
+    TEST_ASSERT_EQUAL_INT(18, CellularManager::getSignalQuality());
+
+    // Modem qui répond dès le premier AT : aucun dépassement, testAT compris
+    TEST_ASSERT_EQUAL_UINT32(0, budget.overruns + budget.initOverruns);
+    TEST_ASSERT_EQUAL_UINT32(0, CellularManager::getBudgetOverruns());
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(CellularManager::BUDGET_MS, CellularManager::getHandleMaxDurationMs());
+}
+
+// Rafales d'URC et d'octets quelconques, y compris pendant les CSQ/CGATT périodiques
+void test_urc_and_garbage_storm()
+{
+    static const char* URCS[] = {
+        "+CEREG: 1", "*PSUTTZ: 26/01/01,12:00:00\",\"+04\",0", "+APP PDP: 0,ACTIVE",
+        "+APP PDP: 1,DEACTIVE", "SMS Ready", "+CPIN: READY", "RDY", "+CSQ: 7,99", "> ",
+    };
+    const size_t ceregBefore = modem.countCommand("AT+CEREG?");
+    const size_t cgattBefore = modem.countCommand("AT+CGATT?");
+    const uint32_t linesBefore = CellularEvent::getLinesReceived();
+
+    uint32_t x = 0x2545F491;
+    for (uint32_t t = 0; t < 60000; t += 37) {
+        x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+        if (x % 3 == 0) {
+            modem.urc(URCS[(x >> 8) % (sizeof(URCS) / sizeof(URCS[0]))], t);
+        } else {
+            // Bruit sans fin de ligne : absorbé par la ligne suivante ("\r\n" de tête)
+            uint8_t noise[24];
+            size_t len = 1 + (x >> 4) % sizeof(noise);
+            for (size_t i = 0; i < len; i++) {
+                x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+                noise[i] = (uint8_t)x == '\n' ? 0 : (uint8_t)x;
+            }
+            modem.inject(noise, len, t);
+        }
+    }
+    runFor(62000);
+
+    TEST_ASSERT_TRUE(CellularManager::isConnected());
+    TEST_ASSERT_EQUAL_UINT32(ceregBefore, modem.countCommand("AT+CEREG?"));   // Aucune reconnexion
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(cgattBefore + 6, modem.countCommand("AT+CGATT?"));
+    TEST_ASSERT_GREATER_THAN_UINT32(linesBefore + 500, CellularEvent::getLinesReceived());
+    TEST_ASSERT_EQUAL_INT(18, CellularManager::getSignalQuality());  // "+CSQ: 7,99" non sollicité ignoré
+    TEST_ASSERT_EQUAL_UINT32(0, budget.overruns);
+}
+
+// Ligne de 300 octets finissant par "OK" pendant AT+CSQ : pas de faux succès
+void test_overlong_line_during_pending()
+{
+    modem.on("AT+CSQ", "+CSQ: 25,99\nOK", 1500);
+    const size_t csqBefore = modem.countCommand("AT+CSQ");
+    const uint32_t overflowsBefore = CellularEvent::getBufferOverflows();
+
+    TEST_ASSERT_TRUE(runUntil([csqBefore]() { return modem.countCommand("AT+CSQ") > csqBefore; }, 20000));
+    std::string flood = "\r\n" + std::string(300, 'x') + "OK\r\n";
+    modem.inject(flood.c_str(), 100);
+
+    runFor(3000);
+    TEST_ASSERT_EQUAL_UINT32(overflowsBefore + 1, CellularEvent::getBufferOverflows());
+    // Le pending a attendu la vraie réponse
+    TEST_ASSERT_EQUAL_INT(25, CellularManager::getSignalQuality());
+    TEST_ASSERT_TRUE(CellularManager::isConnected());
+
+    modem.on("AT+CSQ", "+CSQ: 18,99\nOK");
+    runFor(10000);
+    TEST_ASSERT_EQUAL_INT(18, CellularManager::getSignalQuality());
+    TEST_ASSERT_EQUAL_UINT32(0, budget.overruns);
+}
+
+// CGATT répond après le timeout (2 s) : connexion considérée perdue, puis rétablie
+void test_late_reply_reconnects()
+{
+    modem.on("AT+CGATT?", "+CGATT: 1\nOK", 2500);
+    const size_t ceregBefore = modem.countCommand("AT+CEREG?");
+    const size_t cgattBefore = modem.countCommand("AT+CGATT?");
+
+    TEST_ASSERT_TRUE(runUntil([]() { return !CellularManager::isConnected(); }, 20000));
+    TEST_ASSERT_EQUAL_UINT32(cgattBefore + 1, modem.countCommand("AT+CGATT?"));
+    modem.on("AT+CGATT?", "+CGATT: 1\nOK");
+
+    TEST_ASSERT_TRUE(runUntil([]() { return CellularManager::isConnected(); }, 30000));
+    TEST_ASSERT_GREATER_THAN_UINT32(ceregBefore, modem.countCommand("AT+CEREG?"));
+
+    runFor(20000);
+    TEST_ASSERT_TRUE(CellularManager::isConnected());
+    TEST_ASSERT_EQUAL_UINT32(0, budget.overruns);
+}
+
+// Bearer désactivé par le réseau : seul le contexte 0 déclenche la reconnexion
+void test_bearer_loss_urc()
+{
+    const size_t cnactBefore = modem.countCommand("AT+CNACT=0,1");
+
+    modem.urc("+APP PDP: 1,DEACTIVE");
+    runFor(5000);
+    TEST_ASSERT_TRUE(CellularManager::isConnected());
+    TEST_ASSERT_EQUAL_UINT32(cnactBefore, modem.countCommand("AT+CNACT=0,1"));
+
+    modem.urc("+APP PDP: 0,DEACTIVE");
+    TEST_ASSERT_TRUE(runUntil([]() { return !CellularManager::isConnected(); }, 5000));
+    modem.urc("+APP PDP: 0,ACTIVE", 1200);
+    TEST_ASSERT_TRUE(runUntil([]() { return CellularManager::isConnected(); }, 30000));
+    TEST_ASSERT_EQUAL_UINT32(cnactBefore + 1, modem.countCommand("AT+CNACT=0,1"));
+    TEST_ASSERT_EQUAL_UINT32(0, budget.overruns);
+}
+
+// SMS : refus réseau (+CMS ERROR) au premier envoi, succès au cycle suivant
+void test_sms_flow()
+{
+    const String message = "Alerte serre : 41.5C";
+    modem.on("AT+CMGS=*", ">\n+CMS ERROR: 500", 60);
+    const size_t cmgsBefore = modem.countCommand("AT+CMGS=*");
+
+    SmsManager::send(SMS_NUMBER, message);
+    TEST_ASSERT_TRUE(runUntil([cmgsBefore]() { return modem.countCommand("AT+CMGS=*") > cmgsBefore; }, 10000));
+    modem.on("AT+CMGS=*", ">\n+CMGS: 42\nOK", 60);
+
+    TEST_ASSERT_TRUE(runUntil([]() { return SmsManager::queueSize() == 0; }, 30000));
+    TEST_ASSERT_EQUAL_UINT32(cmgsBefore + 2, modem.countCommand("AT+CMGS=*"));
+    TEST_ASSERT_EQUAL_UINT32(cmgsBefore + 2, modem.countCommand("AT+CMGS=\"+33600000000\""));
+    TEST_ASSERT_EQUAL_STRING(message.c_str(), modem.lastPayload().c_str());
+    TEST_ASSERT_FALSE(SmsManager::isBusy());
+
+    // Ticket rendu : la surveillance reprend
+    const size_t csqBefore = modem.countCommand("AT+CSQ");
+    runFor(10000);
+    TEST_ASSERT_GREATER_THAN_UINT32(csqBefore, modem.countCommand("AT+CSQ"));
+    TEST_ASSERT_EQUAL_UINT32(0, budget.overruns);
+}
+
+// Modem muet : NETWORK_WAIT (120 s), ERROR (5 min), recovery PWRKEY,
+// MODEM_INIT contre un modem toujours muet, puis retour par le fast path
+void test_dead_modem_recovery()
+{
+    const size_t cfunBefore = modem.countCommand("AT+CFUN=0");
+    const uint64_t start = simMs();
+
+    modem.setSilent(true);
+    TEST_ASSERT_TRUE(runUntil([]() { return !CellularManager::isConnected(); }, 30000));
+    TEST_ASSERT_TRUE(runUntil([]() { return budget.initOverruns >= 2; }, 10UL * 60UL * 1000UL));
+    modem.setSilent(false);
+
+    TEST_ASSERT_TRUE(runUntil([]() { return CellularManager::isConnected(); }, 60000));
+    recoveryMs = (uint32_t)(simMs() - start);
+
+    // Empreinte de configuration inchangée : pas de NETWORK_CONFIG
+    TEST_ASSERT_EQUAL_UINT32(cfunBefore, modem.countCommand("AT+CFUN=0"));
+
+    // Seul testAT() (boot/recovery) dépasse le budget : testAT(1000) peut
+    // commencer son dernier waitResponse(200) juste avant l'échéance
+    static constexpr uint32_t TEST_AT_MAX_MS = 1000 + 200 + 20;
+    TEST_ASSERT_EQUAL_UINT32(0, budget.overruns);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(CellularManager::BUDGET_MS, budget.handleMaxMs);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(CellularManager::BUDGET_MS, budget.pollMaxMs);
+    TEST_ASSERT_EQUAL_UINT32(budget.initOverruns, CellularManager::getBudgetOverruns());
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(TEST_AT_MAX_MS, budget.initMaxMs);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(TEST_AT_MAX_MS, CellularManager::getHandleMaxDurationMs());
+
+    writeReport();
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_bring_up);
+    RUN_TEST(test_urc_and_garbage_storm);
+    RUN_TEST(test_overlong_line_during_pending);
+    RUN_TEST(test_late_reply_reconnects);
+    RUN_TEST(test_bearer_loss_urc);
+    RUN_TEST(test_sms_flow);
+    RUN_TEST(test_dead_modem_recovery);
+    return UNITY_END();
+}
@@ -0,0 +1,393 @@
+// test/test_soak/test_main.cpp
+// Endurance en temps virtuel : SOAK_DAYS jours (défaut 30) de fonctionnement
+//
+// TaskManager pilote ManagerUTC, EventManager et DataLogger avec les périodes
+// de main.cpp, contre l'horloge, le réseau (Wi-Fi / SNTP) et la flash simulés
+// de HostSim. Le scénario enchaîne (jours depuis le départ) :
+//   0 j  – 6 h   Wi-Fi absent : UTC invalide, PENDING déborde
+//   6 h          Wi-Fi + NTP : synchro, réparation et flush du PENDING
+//   8 h  – 40 h  NTP injoignable : expiration UTC à 25 h (dérive inconnue)
+//   5 j  – 6 j   activité réduite : flush par FLUSH_TIMEOUT_MS (1 h)
+//   10 j         rebouclage de millis() (départ à 2^32 − 10 j)
+//   12 j – 20 j  NTP injoignable : expiration à 7 j (dérive connue)
+// Horloge locale décalée de DRIFT_PPM par rapport à l'UTC vraie.
+//
+// Rapport JSON (débit, pertes, latence de durabilité, UTC) sur stdout et dans
+// SOAK_OUTPUT (défaut .pio/soak_report.json)
+//
+// pio test -e native -f test_soak
+
+#include <unity.h>
+#include <Arduino.h>
+#include <HostSim.h>
+#include <PosixFS.h>
+#include <chrono>
+#include <string>
+
+#include "Config/TimingConfig.h"
+#include "Connectivity/CellularEvent.h"
+#include "Connectivity/ManagerUTC.h"
+#include "Core/EventManager.h"
+#include "Core/TaskManager.h"
+#include "Core/TaskManagerMonitor.h"
+#include "Storage/DataLogger.h"
+#include "Storage/FileSystem.h"
+#include "Utils/Clock.h"
+#include "Utils/PerfCounter.h"
+
+static PosixFS soakFs(".pio/test_soak_fs");
+
+// ─────────────────────────────────────────────
+// Scénario
+// ─────────────────────────────────────────────
+
+static constexpr uint64_t HOUR_MS = 3600ULL * 1000ULL;
+static constexpr uint64_t DAY_MS  = 24ULL * HOUR_MS;
+
+static constexpr uint32_t STEP_MS     = 250;                    // Pas de la boucle (tâche Wi-Fi de main.cpp)
+static constexpr uint32_t START_MS    = (uint32_t)(0x100000000ULL - 10ULL * DAY_MS);
+static constexpr double   DRIFT_PPM   = 40.0;
+static constexpr uint32_t QUIET_PROBE_MS = 10UL * 60UL * 1000UL; // Une mesure / 10 min
+
+struct Phase {
+    uint64_t fromMs;
+    uint64_t toMs;
+};
+
+static constexpr Phase WIFI_DOWN     = { 0,            6 * HOUR_MS };
+static constexpr Phase NTP_OUTAGE_1  = { 8 * HOUR_MS,  40 * HOUR_MS };
+static constexpr Phase QUIET         = { 5 * DAY_MS,   6 * DAY_MS };
+static constexpr Phase NTP_OUTAGE_2  = { 12 * DAY_MS,  20 * DAY_MS };
+static constexpr uint64_t WRAP_MS    = 0x100000000ULL - START_MS;
+
+static bool inPhase(const Phase& p, uint64_t t) { return t >= p.fromMs && t < p.toMs; }
+
+// ─────────────────────────────────────────────
+// Observation
+// ─────────────────────────────────────────────
+
+static uint64_t simMs() { return HostSim::elapsedUs() / 1000; }
+
+// Enregistrements devenus durables : lecture incrémentale de /datalog.csv
+struct DurableTracker {
+    std::string path;
+    long        offset = 0;
+    std::string partial;
+    uint64_t    records = 0;
+    PerfCounter latencyS;          // Âge à l'écriture (s), toutes phases
+    uint32_t    quietMaxLatencyS = 0;
+    uint32_t    lastTs = 0;
+    uint32_t    wrapBackwardTs = 0;     // Horodatages décroissants autour du rebouclage
+};
+
+static DurableTracker durable;
+
+static void collectDurable()
+{
+    FILE* f = fopen(durable.path.c_str(), "rb");
+    if (!f) return;
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    if (size <= durable.offset) {
+        fclose(f);
+        return;
+    }
+    std::string chunk((size_t)(size - durable.offset), '\0');
+    fseek(f, durable.offset, SEEK_SET);
+    size_t got = fread(&chunk[0], 1, chunk.size(), f);
+    fclose(f);
+    chunk.resize(got);
+    durable.offset += (long)got;
+
+    const uint64_t t = simMs();
+    const uint32_t trueNowS = (uint32_t)(HostSim::trueUtcMs() / 1000);
+    const bool nearWrap = t + HOUR_MS >= WRAP_MS && t < WRAP_MS + HOUR_MS;
+
+    durable.partial += chunk;
+    size_t start = 0;
+    size_t nl;
+    while ((nl = durable.partial.find('\n', start)) != std::string::npos) {
+        const char* line = durable.partial.c_str() + start;
+        start = nl + 1;
+        if (*line == '#' || *line == '\n') continue;   // Trailer de bloc
+
+        uint32_t ts = (uint32_t)strtoul(line, nullptr, 10);
+        uint32_t ageS = trueNowS > ts ? trueNowS - ts : 0;
+        durable.records++;
+        durable.latencyS.record(ageS);
+        if (inPhase(QUIET, t) && ageS > durable.quietMaxLatencyS) durable.quietMaxLatencyS = ageS;
+        if (nearWrap && ts < durable.lastTs) durable.wrapBackwardTs++;
+        durable.lastTs = ts;
+    }
+    durable.partial.erase(0, start);
+}
+
+// Validité UTC : instants d'expiration mesurés depuis la dernière synchro
+struct UtcTracker {
+    bool     valid = false;
+    uint32_t ntpRequests = 0;
+    uint64_t lastSyncMs = 0;
+    uint64_t firstSyncMs = 0;
+    uint32_t syncs = 0;
+    uint32_t expiries = 0;
+    uint64_t expiryAfterMs[4] = {};
+    int64_t  maxErrorMs = 0;
+    uint32_t droppedWhileValid = 0;
+};
+
+static UtcTracker utc;
+
+static void observeUtc(uint32_t droppedBefore)
+{
+    const uint64_t t = simMs();
+    const bool nowValid = ManagerUTC::isUtcValid();
+    const uint32_t requests = HostSim::getNtpRequestCount();
+
+    // Synchro NTP aboutie : requête émise, NTP joignable, UTC valide
+    if (requests != utc.ntpRequests && nowValid &&
+        !inPhase(NTP_OUTAGE_1, t) && !inPhase(NTP_OUTAGE_2, t)) {
+        if (utc.syncs == 0) utc.firstSyncMs = t;
+        utc.lastSyncMs = t;
+        utc.syncs++;
+    }
+    utc.ntpRequests = requests;
+
+    if (utc.valid && !nowValid) {
+        if (utc.expiries < 4) utc.expiryAfterMs[utc.expiries] = t - utc.lastSyncMs;
+        utc.expiries++;
+    }
+    utc.valid = nowValid;
+
+    if (nowValid) {
+        int64_t err = (int64_t)ManagerUTC::nowUtc() * 1000 - HostSim::trueUtcMs();
+        if (err < 0) err = -err;
+        // Résolution de nowUtc() : 1 s
+        if (err > utc.maxErrorMs) utc.maxErrorMs = err;
+        utc.droppedWhileValid += DataLogger::getPerf().pendingDropped - droppedBefore;
+    }
+}
+
+// ─────────────────────────────────────────────
+// Charge de main.cpp (tâches batterie et Wi-Fi → DataLogger)
+// ─────────────────────────────────────────────
+
+static PerfCounter eventManagerIntervalMs;
+static uint32_t lastEventManagerMs = 0;
+static uint32_t monitorWarnings = 0;
+
+static void registerTasks()
+{
+    TaskManager::init();
+
+    TaskManager::addTask([]() { ManagerUTC::handle(); }, 2000UL);
+
+    TaskManager::addTask([]() {
+        uint32_t now = millis();
+        if (lastEventManagerMs != 0) eventManagerIntervalMs.record(now - lastEventManagerMs);
+        lastEventManagerMs = now;
+
+        EventManager::handle();
+
+        // Avertissement verrouillé : compté puis acquitté (interface web)
+        if (TaskManagerMonitor::isWarningActive()) {
+            monitorWarnings++;
+            TaskManagerMonitor::acknowledgeWarning();
+        }
+    }, EVENT_MANAGER_PERIOD_MS);
+
+    TaskManager::addTask([]() {
+        uint32_t dropped = DataLogger::getPerf().pendingDropped;
+        DataLogger::handle();
+        collectDurable();
+        observeUtc(dropped);
+    }, 30000UL);
+
+    TaskManager::addTask([]() {
+        if (inPhase(QUIET, simMs())) return;
+        DataLogger::push(DataType::Battery, DataId::BatteryVoltage, EventManager::getBatteryVoltage());
+        DataLogger::push(DataType::Battery, DataId::BatteryPercent, (float)EventManager::getBatteryPercent());
+        DataLogger::push(DataType::Battery, DataId::Charging, EventManager::isCharging() ? 1.0f : 0.0f);
+        DataLogger::push(DataType::Battery, DataId::ExternalPower,
+                         EventManager::isExternalPowerPresent() ? 1.0f : 0.0f);
+    }, POWER_MANAGER_UPDATE_INTERVAL_MS);
+
+    TaskManager::addTask([]() {
+        if (inPhase(QUIET, simMs())) return;
+        DataLogger::push(DataType::System, DataId::WifiStaEnabled, EventManager::isStaEnabled() ? 1.0f : 0.0f);
+        DataLogger::push(DataType::System, DataId::WifiStaConnected, EventManager::isStaConnected() ? 1.0f : 0.0f);
+        DataLogger::push(DataType::System, DataId::WifiApEnabled, 0.0f);
+        DataLogger::push(DataType::System, DataId::WifiRssi,
+                         EventManager::isStaConnected() ? (float)EventManager::getRssi() : -100.0f);
+    }, WIFI_STATUS_UPDATE_INTERVAL_MS);
+
+    // Activité réduite : une mesure toutes les 10 min (< FLUSH_SIZE par heure)
+    TaskManager::addTask([]() {
+        if (!inPhase(QUIET, simMs())) return;
+        DataLogger::push(DataType::Sensor, DataId::AirTemperature,
+                         18.0f + (float)((simMs() / QUIET_PROBE_MS) % 10));
+    }, QUIET_PROBE_MS);
+}
+
+// Réseau simulé selon la phase courante
+static void applyScenario(uint64_t t)
+{
+    HostSim::setWifiConnected(!inPhase(WIFI_DOWN, t));
+    HostSim::setNtpReachable(!inPhase(NTP_OUTAGE_1, t) && !inPhase(NTP_OUTAGE_2, t));
+
+    // Batterie : cycle journalier de charge solaire
+    uint32_t hourOfDay = (uint32_t)((t / HOUR_MS) % 24);
+    bool charging = hourOfDay >= 9 && hourOfDay < 17;
+    int percent = charging ? 60 + (int)hourOfDay : 80 - (int)((hourOfDay + 7) % 24);
+    HostSim::setBattery(3.5f + percent * 0.007f, percent, charging);
+    HostSim::setWifiRssi(-60 - (int)(hourOfDay % 7));
+}
+
+// ─────────────────────────────────────────────
+// Rapport
+// ─────────────────────────────────────────────
+
+static void writeReport(uint32_t days, double wallS, uint64_t pushed)
+{
+    const DataLoggerPerf& perf = DataLogger::getPerf();
+    const double simS = (double)simMs() / 1000.0;
+
+    char buf[2048];
+    int n = snprintf(buf, sizeof(buf),
+        "{\n"
+        "  \"config\": {\"days\":%lu,\"stepMs\":%lu,\"driftPpm\":%.1f,\"startMs\":%lu},\n"
+        "  \"throughput\": {\"pushed\":%llu,\"durable\":%llu,\"recordsPerSimHour\":%.1f,"
+        "\"flushes\":%lu,\"wallS\":%.2f,\"speedup\":%.0f},\n"
+        "  \"loss\": {\"pendingDropped\":%lu,\"droppedWhileUtcValid\":%lu,\"pendingAtEnd\":%lu,"
+        "\"flushFailures\":%lu,\"lossPct\":%.3f},\n"
+        "  \"durableLatencyS\": {\"p50\":%lu,\"p99\":%lu,\"max\":%lu,\"quietMax\":%lu},\n"
+        "  \"utc\": {\"syncs\":%lu,\"ntpRequests\":%lu,\"expiries\":%lu,"
+        "\"expiry1AfterH\":%.3f,\"expiry2AfterH\":%.3f,\"maxErrorMs\":%lld,\"driftPpm\":%.2f},\n"
+        "  \"scheduler\": {\"eventManagerP50Ms\":%lu,\"eventManagerP99Ms\":%lu,"
+        "\"eventManagerMaxMs\":%lu,\"monitorWarnings\":%lu}\n"
+        "}\n",
+        (unsigned long)days, (unsigned long)STEP_MS, DRIFT_PPM, (unsigned long)START_MS,
+        (unsigned long long)pushed, (unsigned long long)durable.records,
+        durable.records * 3600.0 / simS, (unsigned long)perf.flush.getCalls(), wallS, simS / wallS,
+        (unsigned long)perf.pendingDropped, (unsigned long)utc.droppedWhileValid,
+        (unsigned long)DataLogger::getPendingCount(), (unsigned long)perf.flushFailures,
+        pushed ? 100.0 * perf.pendingDropped / pushed : 0.0,
+        (unsigned long)durable.latencyS.percentileUs(50), (unsigned long)durable.latencyS.percentileUs(99),
+        (unsigned long)durable.latencyS.getMaxUs(), (unsigned long)durable.quietMaxLatencyS,
+        (unsigned long)utc.syncs, (unsigned long)utc.ntpRequests, (unsigned long)utc.expiries,
+        utc.expiryAfterMs[0] / 3600000.0, utc.expiryAfterMs[1] / 3600000.0,
+        (long long)utc.maxErrorMs, ManagerUTC::getDriftPpm(),
+        (unsigned long)eventManagerIntervalMs.percentileUs(50),
+        (unsigned long)eventManagerIntervalMs.percentileUs(99),
+        (unsigned long)eventManagerIntervalMs.getMaxUs(), (unsigned long)monitorWarnings);
+    if (n < 0) return;
+
+    fputs(buf, stdout);
+    const char* outPath = getenv("SOAK_OUTPUT");
+    if (!outPath || !*outPath) outPath = ".pio/soak_report.json";
+    FILE* out = fopen(outPath, "w");
+    if (out) {
+        fputs(buf, out);
+        fclose(out);
+    }
+}
+
+// ─────────────────────────────────────────────
+// Test
+// ─────────────────────────────────────────────
+
+void setUp()
+{
+    HostSim::reset(START_MS);
+    HostSim::setTrueUtc(HostSim::DEFAULT_UTC);
+    HostSim::setDriftPpm(DRIFT_PPM);
+    HostSim::setPmuDetected(true);
+    soakFs.clear();
+    FileSystem::setFs(soakFs);
+    Clock::setSource(nullptr);
+}
+
+void tearDown() {}
+
+void test_soak_virtual_days()
+{
+    const char* env = getenv("SOAK_DAYS");
+    const uint32_t days = (env && *env) ? (uint32_t)strtoul(env, nullptr, 10) : 30;
+
+    durable.path = std::string(soakFs.root()) + "/datalog.csv";
+    // Ordre de setup() / loopInit() (main.cpp)
+    DataLogger::clearHistory();
+    DataLogger::init();
+    CellularEvent::init();          // Trie URC prêt avant ManagerUTC::init()
+    TaskManagerMonitor::init();
+    EventManager::init();
+    ManagerUTC::init();
+    applyScenario(0);
+    EventManager::prime();
+    registerTasks();
+
+    const uint32_t pushBase = DataLogger::getPerf().push.getCalls();
+    const auto wallStart = std::chrono::steady_clock::now();
+
+    const uint64_t endMs = days * DAY_MS;
+    while (simMs() < endMs) {
+        applyScenario(simMs());
+        TaskManager::handle();
+        HostSim::advanceMs(STEP_MS);
+    }
+
+    const double wallS = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    const uint64_t pushed = DataLogger::getPerf().push.getCalls() - pushBase;
+    writeReport(days, wallS, pushed);
+
+    const DataLoggerPerf& perf = DataLogger::getPerf();
+
+    // Conservation : tout enregistrement poussé est durable, compté perdu ou encore en attente
+    TEST_ASSERT_EQUAL_UINT64(pushed, durable.records + perf.pendingDropped + DataLogger::getPendingCount());
+    TEST_ASSERT_EQUAL_UINT32(0, perf.flushFailures);
+
+    // Débordement de PENDING uniquement pendant l'UTC invalide
+    TEST_ASSERT_GREATER_THAN_UINT32(0, perf.pendingDropped);
+    TEST_ASSERT_EQUAL_UINT32(0, utc.droppedWhileValid);
+
+    // Première synchro peu après le retour du Wi-Fi (stabilité réseau 1 min)
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(1, utc.syncs);
+    TEST_ASSERT_UINT64_WITHIN(2 * 60 * 1000, WIFI_DOWN.toMs + 60 * 1000, utc.firstSyncMs);
+
+    // Expiration à 25 h sans synchro (dérive encore inconnue)
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(1, utc.expiries);
+    TEST_ASSERT_UINT64_WITHIN(60 * 1000, 25 * HOUR_MS, utc.expiryAfterMs[0]);
+
+    // Erreur bornée tant que l'UTC est valide : au pire la dérive non
+    // corrigée sur 25 h, plus la résolution de nowUtc() (1 s)
+    TEST_ASSERT_LESS_OR_EQUAL_INT64((int64_t)(DRIFT_PPM * 25 * 3600 / 1000) + 1500, utc.maxErrorMs);
+
+    // NTP injoignable : au plus un essai par heure, pas d'essai à chaque tick
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(days * 24 * 2, utc.ntpRequests);
+
+    if (days > 6) {
+        // Activité réduite : durable au plus tard FLUSH_TIMEOUT_MS (+ période de la tâche)
+        TEST_ASSERT_GREATER_THAN_UINT32(0, durable.quietMaxLatencyS);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(3600 + 30 + 2, durable.quietMaxLatencyS);
+    }
+
+    if (days > 11) {
+        // Rebouclage de millis() : aucun horodatage en arrière, tâches régulières
+        TEST_ASSERT_EQUAL_UINT32(0, durable.wrapBackwardTs);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(EVENT_MANAGER_MAX_PERIOD_MS + 10000, eventManagerIntervalMs.getMaxUs());
+    }
+
+    if (days > 20) {
+        // Dérive connue : expiration repoussée à 7 jours
+        TEST_ASSERT_GREATER_OR_EQUAL_UINT32(2, utc.expiries);
+        TEST_ASSERT_UINT64_WITHIN(60 * 1000, 7 * DAY_MS, utc.expiryAfterMs[1]);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_soak_virtual_days);
+    return UNITY_END();
+}
@@ -0,0 +1,435 @@
+// test/test_storage/test_main.cpp
+// Moteur de stockage sur l'hôte : DataLogger / GraphCache / FileSystem
+// au-dessus d'un PosixFS et d'une horloge injectée (Clock::setSource)
+//
+// pio test -e native -f test_storage
+
+#include <unity.h>
+#include <Arduino.h>
+#include <PosixFS.h>
+#include <HostSim.h>
+#include <esp_rom_crc.h>
+#include <string>
+#include <vector>
+
+#include "Storage/CsvLogReader.h"
+#include "Storage/DataLogger.h"
+#include "Storage/FileSystem.h"
+#include "Storage/GraphCache.h"
+#include "Utils/Clock.h"
+
+static PosixFS testFs(".pio/test_storage_fs");
+
+// ─────────────────────────────────────────────
+// Horloge de test : millis() simulé + UTC réglable
+// ─────────────────────────────────────────────
+
+static bool     utcValid = true;
+static time_t   utcAtEpoch = HostSim::DEFAULT_UTC;   // UTC quand millis() == epochMs
+static uint32_t epochMs = 0;
+
+static uint32_t testNowMs() { return millis(); }
+static bool     testUtcValid() { return utcValid; }
+static time_t   testNowUtc() { return utcAtEpoch + (time_t)((millis() - epochMs) / 1000); }
+static time_t   testUtcFromRelative(uint32_t relMs)
+{
+    return utcAtEpoch - (time_t)((int32_t)(epochMs - relMs) / 1000);
+}
+
+static const ClockSource testClock = {
+    testNowMs, testUtcValid, testNowUtc, testUtcFromRelative
+};
+
+// ─────────────────────────────────────────────
+// Outils
+// ─────────────────────────────────────────────
+
+static std::string readLog()
+{
+    std::string out;
+    File f = testFs.open("/datalog.csv", FILE_READ);
+    if (!f) return out;
+    uint8_t buf[512];
+    size_t n;
+    while ((n = f.read(buf, sizeof(buf))) > 0) out.append((const char*)buf, n);
+    f.close();
+    return out;
+}
+
+static void appendRaw(const char* text)
+{
+    File f = testFs.open("/datalog.csv", FILE_APPEND);
+    f.write((const uint8_t*)text, strlen(text));
+    f.close();
+}
+
+static std::vector<std::string> splitLines(const std::string& text)
+{
+    std::vector<std::string> lines;
+    size_t start = 0;
+    while (start < text.size()) {
+        size_t nl = text.find('\n', start);
+        if (nl == std::string::npos) nl = text.size();
+        lines.push_back(text.substr(start, nl - start));
+        start = nl + 1;
+    }
+    return lines;
+}
+
+// Vérifie chaque trailer "#B,seq,len,crc" contre les octets qui le précèdent
+static uint32_t checkBlocks(const std::string& text)
+{
+    uint32_t blocks = 0;
+    size_t pos = 0;
+    while ((pos = text.find("#B,", pos)) != std::string::npos) {
+        unsigned long seq, crc;
+        unsigned len;
+        TEST_ASSERT_EQUAL(3, sscanf(text.c_str() + pos, "#B,%lu,%u,%lx", &seq, &len, &crc));
+        TEST_ASSERT_EQUAL_UINT32(blocks, seq);
+        TEST_ASSERT_LESS_OR_EQUAL(pos, len);
+        uint32_t actual = esp_rom_crc32_le(0, (const uint8_t*)text.data() + pos - len, len);
+        TEST_ASSERT_EQUAL_HEX32(crc, actual);
+        blocks++;
+        pos++;
+    }
+    return blocks;
+}
+
+static void pushSeries(DataId id, int count, float base, uint32_t stepMs)
+{
+    for (int i = 0; i < count; i++) {
+        DataLogger::push(DataType::Sensor, id, base + i);
+        HostSim::advanceMs(stepMs);
+    }
+}
+
+void setUp()
+{
+    HostSim::reset(1000);
+    utcValid = true;
+    utcAtEpoch = HostSim::DEFAULT_UTC;
+    epochMs = millis();
+
+    testFs.clear();
+    testFs.setCapacity(0);
+    testFs.failWritesAfter(-1);
+    FileSystem::setFs(testFs);
+    Clock::setSource(&testClock);
+
+    GraphCache::init();
+    DataLogger::clearHistory();
+    DataLogger::init();
+}
+
+void tearDown()
+{
+    Clock::setSource(nullptr);
+}
+
+// ─────────────────────────────────────────────
+// Écriture
+// ─────────────────────────────────────────────
+
+void test_flush_writes_block_with_valid_crc()
+{
+    pushSeries(DataId::AirTemperature, 50, 20.0f, 1000);
+    TEST_ASSERT_EQUAL(50, DataLogger::getPendingCount());
+
+    DataLogger::handle();   // FLUSH_SIZE atteint
+
+    TEST_ASSERT_EQUAL(0, DataLogger::getPendingCount());
+    std::string log = readLog();
+    std::vector<std::string> lines = splitLines(log);
+    TEST_ASSERT_EQUAL(51, lines.size());
+    TEST_ASSERT_EQUAL_STRING("1767225600,1,4,0,20.000", lines[0].c_str());
+    TEST_ASSERT_EQUAL_STRING("1767225649,1,4,0,69.000", lines[49].c_str());
+    TEST_ASSERT_EQUAL(1, checkBlocks(log));
+}
+
+void test_text_values_are_quoted_and_read_back()
+{
+    DataLogger::push(DataType::System, DataId::CellularOperator, String("Orange \"F\""));
+    DataLogger::flush();
+
+    std::string log = readLog();
+    TEST_ASSERT_TRUE(log.find("1,\"Orange \"\"F\"\"\"\n") != std::string::npos);
+
+    DataRecord rec;
+    TEST_ASSERT_TRUE(DataLogger::getLastUtcRecord(DataId::CellularOperator, rec));
+    TEST_ASSERT_EQUAL_STRING("Orange \"F\"", std::get<String>(rec.value).c_str());
+}
+
+void test_flush_by_timeout_after_one_hour()
+{
+    pushSeries(DataId::SoilMoisture1, 3, 40.0f, 1000);
+    DataLogger::handle();
+    TEST_ASSERT_EQUAL(3, DataLogger::getPendingCount());
+
+    HostSim::advanceMs(3600000);
+    DataLogger::handle();
+    TEST_ASSERT_EQUAL(0, DataLogger::getPendingCount());
+    TEST_ASSERT_EQUAL(4, splitLines(readLog()).size());
+}
+
+void test_relative_records_repaired_when_utc_becomes_valid()
+{
+    utcValid = false;
+    uint32_t pushMs = millis();
+    DataLogger::push(DataType::Sensor, DataId::AirHumidity, 55.0f);
+    DataLogger::flush();
+    TEST_ASSERT_EQUAL(1, DataLogger::getPendingCount());   // Pas d'écriture sans UTC
+
+    // UTC acquis 10 min plus tard
+    HostSim::advanceMs(600000);
+    utcValid = true;
+    epochMs = millis();
+    DataLogger::handle();
+    DataLogger::flush();
+
+    TEST_ASSERT_EQUAL(0, DataLogger::getPendingCount());
+    DataRecord rec;
+    TEST_ASSERT_TRUE(DataLogger::getLastUtcRecord(DataId::AirHumidity, rec));
+    TEST_ASSERT_EQUAL_UINT32(testUtcFromRelative(pushMs), rec.timestamp);
+    TEST_ASSERT_EQUAL_UINT32(HostSim::DEFAULT_UTC - 600, rec.timestamp);
+}
+
+// ─────────────────────────────────────────────
+// Pannes
+// ─────────────────────────────────────────────
+
+void test_failed_flush_keeps_records_and_block_number()
+{
+    uint32_t failuresBefore = DataLogger::getPerf().flushFailures;
+    testFs.failWritesAfter(100);
+    pushSeries(DataId::AirTemperature, 50, 10.0f, 1000);
+    DataLogger::handle();
+
+    TEST_ASSERT_EQUAL(failuresBefore + 1, DataLogger::getPerf().flushFailures);
+    TEST_ASSERT_EQUAL(50, DataLogger::getPendingCount());
+    TEST_ASSERT_EQUAL(0, readLog().size());                // Bloc incomplet retiré
+
+    testFs.failWritesAfter(-1);
+    DataLogger::handle();
+    TEST_ASSERT_EQUAL(0, DataLogger::getPendingCount());
+    TEST_ASSERT_EQUAL(1, checkBlocks(readLog()));           // Toujours le bloc 0
+}
+
+void test_partition_full_keeps_records()
+{
+    pushSeries(DataId::AirTemperature, 50, 10.0f, 1000);
+    DataLogger::handle();
+    size_t used = testFs.usedBytes();
+
+    testFs.setCapacity(used + 200);
+    uint32_t failuresBefore = DataLogger::getPerf().flushFailures;
+    pushSeries(DataId::AirTemperature, 50, 60.0f, 1000);
+    DataLogger::handle();
+
+    TEST_ASSERT_EQUAL(failuresBefore + 1, DataLogger::getPerf().flushFailures);
+    TEST_ASSERT_EQUAL(50, DataLogger::getPendingCount());
+}
+
+// Rollback impossible (la recopie échoue aussi) : rien n'est ajouté derrière
+// les octets déchirés tant que la fin n'a pas été ramenée au dernier bloc
+void test_failed_rollback_blocks_appends_until_repaired()
+{
+    pushSeries(DataId::AirTemperature, 50, 10.0f, 1000);
+    DataLogger::handle();
+    const size_t cleanSize = readLog().size();
+
+    testFs.failWritesAfter(100);
+    pushSeries(DataId::AirTemperature, 50, 60.0f, 1000);
+    DataLogger::handle();
+    const size_t tornSize = readLog().size();
+    TEST_ASSERT_GREATER_THAN(cleanSize, tornSize);         // Troncature échouée
+    uint32_t versionTorn = DataLogger::getDataVersion();
+
+    pushSeries(DataId::AirTemperature, 50, 110.0f, 1000);
+    DataLogger::handle();
+    TEST_ASSERT_EQUAL(tornSize, readLog().size());         // Aucun ajout
+    TEST_ASSERT_EQUAL(100, DataLogger::getPendingCount());
+
+    testFs.failWritesAfter(-1);
+    DataLogger::flush();
+    TEST_ASSERT_EQUAL(0, DataLogger::getPendingCount());
+    TEST_ASSERT_GREATER_THAN(versionTorn, DataLogger::getDataVersion());
+
+    std::string text = readLog();
+    TEST_ASSERT_EQUAL(3, checkBlocks(text));
+    std::vector<std::string> lines = splitLines(text);
+    TEST_ASSERT_EQUAL(150 + 3, lines.size());
+    for (const std::string& line : lines) {
+        if (line[0] == '#') continue;
+        int fields = 1;
+        for (char c : line) fields += c == ',';
+        TEST_ASSERT_EQUAL(5, fields);                      // Aucune ligne recollée
+    }
+}
+
+void test_torn_block_truncated_at_boot()
+{
+    pushSeries(DataId::AirTemperature, 50, 10.0f, 1000);
+    DataLogger::handle();
+    size_t goodSize = readLog().size();
+
+    // Coupure pendant le flush suivant : lignes sans trailer, dernière coupée
+    appendRaw("1767225700,1,4,0,1.000\n1767225701,1,4,0,2.0");
+
+    DataLogger::init();
+    TEST_ASSERT_EQUAL(goodSize, readLog().size());
+    TEST_ASSERT_EQUAL_UINT32(strlen("1767225700,1,4,0,1.000\n1767225701,1,4,0,2.0"),
+                             DataLogger::getPerf().recoveredBytes);
+
+    // Numérotation reprise après le dernier bloc valide
+    pushSeries(DataId::AirTemperature, 50, 70.0f, 1000);
+    DataLogger::handle();
+    TEST_ASSERT_EQUAL(2, checkBlocks(readLog()));
+}
+
+void test_corrupt_last_block_falls_back_to_previous()
+{
+    pushSeries(DataId::AirTemperature, 50, 10.0f, 1000);
+    DataLogger::handle();
+    size_t firstBlockEnd = readLog().size();
+    pushSeries(DataId::AirTemperature, 50, 60.0f, 1000);
+    DataLogger::handle();
+
+    // Un octet du second bloc altéré : CRC faux
+    std::string log = readLog();
+    log[firstBlockEnd + 3] = log[firstBlockEnd + 3] == '1' ? '2' : '1';
+    File f = testFs.open("/datalog.csv", FILE_WRITE);
+    f.write((const uint8_t*)log.data(), log.size());
+    f.close();
+
+    DataLogger::init();
+    TEST_ASSERT_EQUAL(firstBlockEnd, readLog().size());
+}
+
+// ─────────────────────────────────────────────
+// Lecture
+// ─────────────────────────────────────────────
+
+void test_init_rebuilds_last_values_from_flash()
+{
+    DataLogger::push(DataType::Sensor, DataId::SoilMoisture2, 33.5f);
+    DataLogger::flush();
+
+    DataLogger::clearHistory();     // Efface aussi le fichier : on le réécrit
+    appendRaw("1767230000,1,7,0,41.250\n");
+    DataLogger::init();
+
+    LastDataForWeb last;
+    TEST_ASSERT_TRUE(DataLogger::hasLastDataForWeb(DataId::SoilMoisture2, last));
+    TEST_ASSERT_TRUE(last.utc_valid);
+    TEST_ASSERT_EQUAL_UINT32(1767230000, last.t_utc);
+    TEST_ASSERT_FLOAT_WITHIN(0.001, 41.25, std::get<float>(last.value));
+}
+
+void test_graph_window_and_incremental_refresh()
+{
+    // 3 jours, un point par heure
+    for (int h = 0; h < 72; h++) {
+        DataLogger::push(DataType::Sensor, DataId::AirTemperature, (float)h);
+        HostSim::advanceMs(3600000);
+        DataLogger::handle();
+    }
+    DataLogger::flush();
+
+    uint32_t missesBefore = GraphCache::getMissCount();
+    GraphCache::Result r;
+    TEST_ASSERT_TRUE(GraphCache::query(DataId::AirTemperature, 1, r));
+    TEST_ASSERT_EQUAL_UINT32(missesBefore + 1, GraphCache::getMissCount());
+    TEST_ASSERT_UINT32_WITHIN(1, 24, r.rows);
+
+    // Requête identique : servie sans lecture
+    uint32_t hitsBefore = GraphCache::getHitCount();
+    TEST_ASSERT_TRUE(GraphCache::query(DataId::AirTemperature, 1, r));
+    TEST_ASSERT_EQUAL_UINT32(hitsBefore + 1, GraphCache::getHitCount());
+
+    // Données ajoutées : lecture incrémentale
+    uint32_t appendsBefore = GraphCache::getAppendCount();
+    DataLogger::push(DataType::Sensor, DataId::AirTemperature, 99.0f);
+    DataLogger::flush();
+    TEST_ASSERT_TRUE(GraphCache::query(DataId::AirTemperature, 0, r));
+    TEST_ASSERT_EQUAL_UINT32(73, r.rows);
+    TEST_ASSERT_TRUE(GraphCache::query(DataId::AirTemperature, 1, r));
+    TEST_ASSERT_EQUAL_UINT32(appendsBefore + 1, GraphCache::getAppendCount());
+
+    String csv = DataLogger::getGraphCsv(DataId::AirTemperature, 1);
+    TEST_ASSERT_TRUE(csv.startsWith("timestamp,value\n"));
+    TEST_ASSERT_TRUE(csv.endsWith(",99.00\n"));
+}
+
+void test_graph_empty_while_utc_invalid()
+{
+    pushSeries(DataId::AirTemperature, 5, 1.0f, 1000);
+    DataLogger::flush();
+
+    utcValid = false;
+    GraphCache::Result r;
+    TEST_ASSERT_TRUE(GraphCache::query(DataId::AirTemperature, 1, r));
+    TEST_ASSERT_EQUAL_UINT32(0, r.rows);
+
+    utcValid = true;
+    TEST_ASSERT_TRUE(GraphCache::query(DataId::AirTemperature, 1, r));
+    TEST_ASSERT_EQUAL_UINT32(5, r.rows);
+}
+
+void test_csv_reader_skips_malformed_lines()
+{
+    appendRaw("1767225600,1,4,0,1.500\n"
+              "garbage\n"
+              "#B,0,10,deadbeef\n"
+              "1767225601,1,4,1,\"a,\"\"b\"\"\"\n"
+              "1767225602,1,4\n");
+
+    struct Seen { int numeric = 0; int text = 0; std::string lastText; } seen;
+    File f = testFs.open("/datalog.csv", FILE_READ);
+    uint32_t n = CsvLogReader::forEach(f, [](const CsvRecord& rec, void* ctx) {
+        Seen& s = *static_cast<Seen*>(ctx);
+        if (rec.isText) {
+            s.text++;
+            s.lastText.assign(rec.text, rec.textLen);
+        } else {
+            s.numeric++;
+        }
+        return true;
+    }, &seen);
+    f.close();
+
+    TEST_ASSERT_EQUAL(2, n);
+    TEST_ASSERT_EQUAL(1, seen.numeric);
+    TEST_ASSERT_EQUAL(1, seen.text);
+    TEST_ASSERT_EQUAL_STRING("a,\"b\"", seen.lastText.c_str());
+}
+
+void test_host_crc_matches_rom_reference()
+{
+    // Valeur de contrôle CRC-32 (IEEE) : "123456789" → 0xCBF43926
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926, esp_rom_crc32_le(0, (const uint8_t*)"123456789", 9));
+    // Calcul par morceaux identique (PageWriter enchaîne les appels)
+    uint32_t crc = esp_rom_crc32_le(0, (const uint8_t*)"1234", 4);
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926, esp_rom_crc32_le(crc, (const uint8_t*)"56789", 5));
+}
+
+int main(int argc, char** argv)
+{
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_host_crc_matches_rom_reference);
+    RUN_TEST(test_flush_writes_block_with_valid_crc);
+    RUN_TEST(test_text_values_are_quoted_and_read_back);
+    RUN_TEST(test_flush_by_timeout_after_one_hour);
+    RUN_TEST(test_relative_records_repaired_when_utc_becomes_valid);
+    RUN_TEST(test_failed_flush_keeps_records_and_block_number);
+    RUN_TEST(test_partition_full_keeps_records);
+    RUN_TEST(test_failed_rollback_blocks_appends_until_repaired);
+    RUN_TEST(test_torn_block_truncated_at_boot);
+    RUN_TEST(test_corrupt_last_block_falls_back_to_previous);
+    RUN_TEST(test_init_rebuilds_last_values_from_flash);
+    RUN_TEST(test_graph_window_and_incremental_refresh);
+    RUN_TEST(test_graph_empty_while_utc_invalid);
+    RUN_TEST(test_csv_reader_skips_malformed_lines);
+    return UNITY_END();
+}
@@ -0,0 +1,258 @@
+// Tableau de bord : coquille statique (cache navigateur) + valeurs /api/status
+
+function toggleSta(cb) {
+  const params = new URLSearchParams();
+  if (cb.checked) {
+    params.append('state', '1');
+  }
+  fetch('/wifi-toggle', { method: 'POST', body: params });
+}
+
+function toggleAp(cb) {
+  if (!cb.checked) {
+    fetch('/ap-toggle', { method: 'POST', body: new URLSearchParams() });
+  }
+}
+
+function toggleGsm(cb) {
+  const params = new URLSearchParams();
+  if (cb.checked) {
+    params.append('state', '1');
+  }
+  fetch('/gsm-toggle', { method: 'POST', body: params });
+}
+
+// ─────────────────────────────────────────────
+// Valeurs courantes
+// ─────────────────────────────────────────────
+
+function formatUtc(t) {
+  const d = new Date(t * 1000);
+  const p = n => String(n).padStart(2, '0');
+  return p(d.getDate()) + '/' + p(d.getMonth() + 1) + '/' + p(d.getFullYear() % 100) +
+         ' ' + p(d.getHours()) + ':' + p(d.getMinutes());
+}
+
+function formatSince(ms) {
+  let s = Math.floor(ms / 1000);
+  let m = Math.floor(s / 60); s %= 60;
+  let h = Math.floor(m / 60); m %= 60;
+  return 'Depuis ' + (h ? h + 'h ' : '') + (m ? m + 'm ' : '') + s + 's';
+}
+
+// Horodatage : UTC si valide, sinon âge relatif (incrémenté chaque seconde)
+function setTime(id, t) {
+  const e = document.getElementById(id);
+  e.classList.remove('age');
+  if (!t) {
+    e.textContent = '';
+  } else if (t.utc !== undefined) {
+    e.textContent = formatUtc(t.utc);
+  } else {
+    e.classList.add('age');
+    e.dataset.ageMs = t.ageMs;
+    e.textContent = formatSince(t.ageMs);
+  }
+}
+
+function setText(id, text) {
+  document.getElementById(id).textContent = text;
+}
+
+function formatUptime(secs) {
+  const days = Math.floor(secs / 86400); secs %= 86400;
+  const hours = Math.floor(secs / 3600); secs %= 3600;
+  const mins = Math.floor(secs / 60); secs %= 60;
+  return days + 'j ' + hours + 'h ' + mins + 'm ' + secs + 's';
+}
+
+function render(s) {
+  // Wi-Fi
+  const w = s.wifi;
+  setText('staStatus',
+    !w.staEnabled ? 'Désactivé' :
+    (w.staConnected && w.rssi !== null ? 'Connecté (' + w.rssi + ' dBm)' :
+     w.staConnected ? 'Connecté' : 'Recherche réseau...'));
+  setText('staSsid', w.ssid);
+  setText('staIp', w.staIp);
+  setTime('wifiTime', w.time);
+  document.getElementById('staSwitch').checked = w.staEnabled;
+
+  setText('apStatus', w.apEnabled ? 'Actif' : 'Désactivé');
+  setText('apIp', w.apIp);
+  setTime('apTime', w.time);
+  const ap = document.getElementById('apSwitch');
+  ap.checked = w.apEnabled;
+  ap.disabled = !w.apEnabled;
+
+  // GSM
+  const g = s.gsm;
+  const details = [];
+  if (!g.enabled) {
+    setText('gsmStatus', 'Désactivé');
+  } else if (!g.connected) {
+    setText('gsmStatus', 'Recherche réseau...');
+  } else {
+    setText('gsmStatus', g.dbm !== null ? 'Connecté (' + g.dbm + ' dBm)' : 'Connecté');
+    if (g.operator) details.push('Opérateur : ' + g.operator);
+    if (g.ip) details.push('IP : ' + g.ip);
+  }
+  const gd = document.getElementById('gsmDetails');
+  gd.textContent = '';
+  details.forEach((line, i) => {
+    if (i) gd.appendChild(document.createElement('br'));
+    gd.appendChild(document.createTextNode(line));
+  });
+  gd.style.display = details.length ? '' : 'none';
+  setTime('gsmTime', g.time);
+  document.getElementById('gsmSwitch').checked = g.enabled;
+
+  // Alimentation
+  const p = s.power;
+  setText('externalPower', p.external === null ? '' : (p.external ? 'Oui' : 'Non'));
+  setTime('externalPowerTime', p.time);
+
+  const b = s.battery;
+  setText('batteryLine', (b.voltage === null ? '0.00' : b.voltage.toFixed(2)) + ' V' +
+                         (b.percent !== null ? ' (' + b.percent + ' %)' : ''));
+  setTime('batteryTime', b.time);
+  setText('charging', b.charging === null ? '' : (b.charging ? 'En charge' : 'Pas en charge'));
+
+  setText('uptime', formatUptime(s.uptimeS));
+}
+
+// État courant (dernier /api/status + deltas reçus en direct)
+let status = null;
+
+function refreshStatus() {
+  fetch('/api/status', { cache: 'no-store' })
+    .then(response => response.json())
+    .then(s => { status = s; render(s); })
+    .catch(() => {});
+}
+
+// ─────────────────────────────────────────────
+// Push live (Server-Sent Events) : un delta par DataId modifié
+// Indices = ordre de l'enum DataId (Storage/DataLogger.h)
+// ─────────────────────────────────────────────
+
+function signalTodBm(signal) {
+  return (signal === 99 || signal < 0 || signal > 31) ? null : -113 + 2 * signal;
+}
+
+const APPLY_DELTA = {
+  0:  (s, v, t) => { s.battery.voltage = v; s.battery.time = t; },   // BatteryVoltage
+  1:  (s, v)    => { s.battery.percent = Math.trunc(v); },           // BatteryPercent
+  2:  (s, v)    => { s.battery.charging = v > 0.5; },                // Charging
+  3:  (s, v, t) => { s.power.external = v > 0.5; s.power.time = t; },// ExternalPower
+  10: (s, v, t) => { s.wifi.staEnabled = v > 0.5; s.wifi.time = t; },
+  11: (s, v, t) => { s.wifi.staConnected = v > 0.5; s.wifi.time = t; },
+  12: (s, v, t) => { s.wifi.apEnabled = v > 0.5; s.wifi.time = t; },
+  13: (s, v)    => { s.wifi.rssi = Math.trunc(v); },
+  14: (s, v, t) => { s.gsm.enabled = v > 0.5; s.gsm.time = t; },
+  15: (s, v, t) => { s.gsm.connected = v > 0.5; s.gsm.time = t; },
+  16: (s, v)    => { s.gsm.operator = v; },
+  17: (s, v)    => { s.gsm.ip = v; },
+  18: (s, v)    => { s.gsm.dbm = signalTodBm(Math.trunc(v)); },
+};
+
+let live = false;
+
+function startLive() {
+  if (!window.EventSource) return;
+  const source = new EventSource('/events');
+  source.onopen = () => { live = true; };
+  source.onerror = () => { live = false; };   // Reconnexion automatique du navigateur
+  source.addEventListener('d', e => {
+    if (!status) return;
+    const d = JSON.parse(e.data);
+    const apply = APPLY_DELTA[d.i];
+    if (apply) {
+      apply(status, d.v, d.t);
+      render(status);
+    }
+  });
+}
+
+// ─────────────────────────────────────────────
+// Graphique batterie
+// ─────────────────────────────────────────────
+
+function showBatteryGraph() {
+  const container = document.getElementById('graphContainer');
+  const loading = document.getElementById('graphLoading');
+  const canvas = document.getElementById('batteryChart');
+  
+  container.style.display = 'block';
+  loading.style.display = 'block';
+  canvas.style.display = 'none';
+  
+  fetch('/graphdata')
+    .then(response => response.text())
+    .then(csv => {
+      loading.style.display = 'none';
+      canvas.style.display = 'block';
+      
+      // Parser le CSV
+      const lines = csv.trim().split('\n');
+      const times = [];
+      const values = [];
+      
+      for (let i = 1; i < lines.length; i++) {  // Skip header
+        const parts = lines[i].split(',');
+        if (parts.length >= 2) {
+          times.push(parseInt(parts[0]));
+          values.push(parseFloat(parts[1]));
+        }
+      }
+      
+      // Tracé local (plot.js), aucune bibliothèque externe
+      linePlot(canvas, {
+        title: 'Historique tension batterie (30 derniers jours)',
+        label: 'Tension batterie (V)',
+        color: '#1976d2',
+        fill: 'rgba(25, 118, 210, 0.1)',
+        x: times,
+        y: values,
+        yMin: 3.0,
+        yMax: 4.5,
+        xTicks: 5,
+        formatX: t => new Date(t * 1000).toLocaleDateString('fr-FR', {
+          day: '2-digit',
+          month: '2-digit',
+          hour: '2-digit',
+          minute: '2-digit'
+        })
+      });
+    })
+    .catch(error => {
+      loading.textContent = 'Erreur de chargement : ' + error;
+    });
+}
+
+function hideGraph() {
+  document.getElementById('graphContainer').style.display = 'none';
+}
+
+setInterval(() => {
+  document.querySelectorAll('.age').forEach(e => {
+    let ms = parseInt(e.dataset.ageMs);
+    ms += 1000;
+    e.dataset.ageMs = ms;
+    e.textContent = formatSince(ms);
+  });
+}, 1000);
+
+// Valeurs initiales puis push live ; sondage de secours toutes les 30 s
+// sans flux, toutes les 5 min avec (horodatages, durée de fonctionnement)
+refreshStatus();
+startLive();
+
+let lastPollMs = Date.now();
+setInterval(() => {
+  const period = live ? 300000 : 30000;
+  if (Date.now() - lastPollMs >= period) {
+    lastPollMs = Date.now();
+    refreshStatus();
+  }
+}, 5000);
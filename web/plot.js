@@ -0,0 +1,134 @@
+// Traceur de courbes minimal (canvas) : remplace Chart.js (CDN)
+// Fonctionne hors ligne sur le point d'accès local, ~2 Ko gzip
+//
+// linePlot(canvas, {
+//   title, label, color, fill,            // apparence
+//   x: [timestamps s], y: [valeurs],      // données (x croissant)
+//   yMin, yMax,                           // bornes suggérées (élargies si besoin)
+//   xTicks: 6, formatX: t => '...'        // graduations temporelles
+// })
+
+function linePlot(canvas, opt) {
+  const dpr = window.devicePixelRatio || 1;
+  const width = canvas.clientWidth || canvas.parentNode.clientWidth || 300;
+  const height = Math.round(width * 0.55);
+
+  canvas.width = width * dpr;
+  canvas.height = height * dpr;
+  canvas.style.height = height + 'px';
+
+  const ctx = canvas.getContext('2d');
+  ctx.setTransform(dpr, 0, 0, dpr, 0, 0);
+  ctx.clearRect(0, 0, width, height);
+  ctx.font = '12px Arial';
+
+  const text = '#333';
+  const grid = 'rgba(0,0,0,0.1)';
+  const pad = { left: 42, right: 10, top: opt.title ? 28 : 10, bottom: 36 };
+  const plotW = width - pad.left - pad.right;
+  const plotH = height - pad.top - pad.bottom;
+
+  if (opt.title) {
+    ctx.fillStyle = text;
+    ctx.textAlign = 'center';
+    ctx.fillText(opt.title, width / 2, 16);
+  }
+
+  const n = Math.min(opt.x.length, opt.y.length);
+  if (n === 0) {
+    ctx.fillStyle = text;
+    ctx.textAlign = 'center';
+    ctx.fillText('Aucune donnée', width / 2, height / 2);
+    return;
+  }
+
+  // Échelles (bornes suggérées élargies aux données)
+  let yMin = opt.yMin !== undefined ? opt.yMin : Infinity;
+  let yMax = opt.yMax !== undefined ? opt.yMax : -Infinity;
+  for (let i = 0; i < n; i++) {
+    if (opt.y[i] < yMin) yMin = opt.y[i];
+    if (opt.y[i] > yMax) yMax = opt.y[i];
+  }
+  if (yMax === yMin) { yMax += 1; yMin -= 1; }
+
+  const xMin = opt.x[0];
+  const xMax = opt.x[n - 1] > xMin ? opt.x[n - 1] : xMin + 1;
+
+  const px = t => pad.left + (t - xMin) / (xMax - xMin) * plotW;
+  const py = v => pad.top + (1 - (v - yMin) / (yMax - yMin)) * plotH;
+
+  // Graduations Y (pas "rond")
+  const rawStep = (yMax - yMin) / 5;
+  const mag = Math.pow(10, Math.floor(Math.log10(rawStep)));
+  const step = [1, 2, 5, 10].map(m => m * mag).find(s => s >= rawStep);
+  const decimals = Math.max(0, -Math.floor(Math.log10(step)));
+
+  ctx.textAlign = 'right';
+  ctx.textBaseline = 'middle';
+  for (let v = Math.ceil(yMin / step) * step; v <= yMax + step * 1e-6; v += step) {
+    const y = py(v);
+    ctx.strokeStyle = grid;
+    ctx.beginPath();
+    ctx.moveTo(pad.left, y);
+    ctx.lineTo(pad.left + plotW, y);
+    ctx.stroke();
+    ctx.fillStyle = text;
+    ctx.fillText(v.toFixed(decimals), pad.left - 6, y);
+  }
+
+  // Graduations X
+  const xTicks = opt.xTicks || 6;
+  const formatX = opt.formatX || (t => String(t));
+  ctx.textAlign = 'center';
+  ctx.textBaseline = 'top';
+  for (let k = 0; k <= xTicks; k++) {
+    const t = xMin + (xMax - xMin) * k / xTicks;
+    const x = px(t);
+    ctx.strokeStyle = grid;
+    ctx.beginPath();
+    ctx.moveTo(x, pad.top);
+    ctx.lineTo(x, pad.top + plotH);
+    ctx.stroke();
+    ctx.fillStyle = text;
+    ctx.fillText(formatX(t), x, pad.top + plotH + 6);
+  }
+
+  // Courbe (points décimés au pixel près)
+  const color = opt.color || '#1976d2';
+  const path = new Path2D();
+  let lastX = -1;
+  let firstX = null;
+  let endX = 0;
+  for (let i = 0; i < n; i++) {
+    const x = px(opt.x[i]);
+    if (i !== n - 1 && Math.abs(x - lastX) < 0.5) continue;
+    const y = py(opt.y[i]);
+    if (firstX === null) { path.moveTo(x, y); firstX = x; } else { path.lineTo(x, y); }
+    lastX = x;
+    endX = x;
+  }
+
+  if (opt.fill) {
+    const area = new Path2D(path);
+    area.lineTo(endX, pad.top + plotH);
+    area.lineTo(firstX, pad.top + plotH);
+    area.closePath();
+    ctx.fillStyle = opt.fill;
+    ctx.fill(area);
+  }
+
+  ctx.strokeStyle = color;
+  ctx.lineWidth = 2;
+  ctx.lineJoin = 'round';
+  ctx.stroke(path);
+
+  // Légende
+  if (opt.label) {
+    ctx.fillStyle = color;
+    ctx.fillRect(pad.left, height - 12, 10, 10);
+    ctx.fillStyle = text;
+    ctx.textAlign = 'left';
+    ctx.textBaseline = 'bottom';
+    ctx.fillText(opt.label, pad.left + 14, height - 1);
+  }
+}